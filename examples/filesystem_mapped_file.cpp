@@ -0,0 +1,49 @@
+/*!
+    \file filesystem_mapped_file.cpp
+    \brief Filesystem memory-mapped file example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/filesystem.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    const char buffer[] = "The quick brown fox jumps over the lazy dog";
+
+    // Create an empty file
+    CppCommon::MappedFile file("example.txt");
+    CppCommon::File::WriteEmpty(file);
+
+    // Map the file for writing and grow it
+    file.Map(true);
+    file.Resize(std::strlen(buffer));
+
+    // Write buffer into the mapped file
+    file.Write(buffer, std::strlen(buffer));
+
+    // Flush and unmap the file
+    file.Flush();
+    file.Unmap();
+
+    // Map the file for reading with a sequential access advice
+    file.Map(false);
+    file.Advise(CppCommon::MappedFileAdvice::SEQUENTIAL);
+
+    std::cout << "File size: " << file.size() << std::endl;
+    std::cout << "File content: " << std::string((const char*)file.data(), file.size()) << std::endl;
+    std::cout << "Count of 'o' letters: " << std::count(file.data(), file.data() + file.size(), 'o') << std::endl;
+
+    // Unmap the file
+    file.Unmap();
+
+    // Remove file
+    CppCommon::File::Remove(file);
+
+    return 0;
+}
@@ -14,5 +14,6 @@ int main(int argc, char** argv)
 {
     std::cout << "Total RAM: " << CppCommon::Memory::RamTotal() << " bytes" << std::endl;
     std::cout << "Free RAM: " << CppCommon::Memory::RamFree() << " bytes" << std::endl;
+    std::cout << "Process RAM: " << CppCommon::Memory::RamProcess() << " bytes" << std::endl;
     return 0;
 }
@@ -0,0 +1,53 @@
+/*!
+    \file memory_profiler.cpp
+    \brief Memory allocation profiler example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/allocator_profiler.h"
+#include "memory/memory_profiler_new.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+void Allocate(std::vector<std::string>& strings)
+{
+    for (int i = 0; i < 10000; ++i)
+        strings.emplace_back(std::string(100 + i % 1000, 'x'));
+}
+
+int main(int argc, char** argv)
+{
+    // Sample every 64 KiB of allocated memory in average
+    CppCommon::MemoryProfiler::SetSamplingInterval(64 * 1024);
+    CppCommon::MemoryProfiler::Enable();
+
+    // Profile global new/delete operators
+    std::vector<std::string> strings;
+    Allocate(strings);
+
+    // Profile allocations of the custom memory manager
+    CppCommon::DefaultMemoryManager auxiliary;
+    CppCommon::ProfilerMemoryManager<CppCommon::DefaultMemoryManager> manager(auxiliary);
+    CppCommon::ProfilerAllocator<std::pair<const int, int>, CppCommon::DefaultMemoryManager> alloc(manager);
+    {
+        std::map<int, int, std::less<int>, decltype(alloc)> map(alloc);
+        for (int i = 0; i < 10000; ++i)
+            map[i] = i;
+    }
+
+    CppCommon::MemoryProfiler::Disable();
+
+    // Show allocation statistics
+    std::cout << CppCommon::MemoryProfiler::GetStatistics();
+
+    // Dump sampled call stacks in the folded stacks format (use flamegraph.pl to build a flame graph)
+    std::cout << "Folded stacks:" << std::endl;
+    CppCommon::MemoryProfiler::DumpFlameGraph(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*!
+    \file memory_shared.cpp
+    \brief Shared memory allocator example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/hashmap.h"
+#include "memory/allocator_shared.h"
+
+#include <iostream>
+
+// Lookup table shared between processes
+typedef CppCommon::SharedAllocator<std::pair<int, int>> LookupAllocator;
+typedef CppCommon::HashMap<int, int, std::hash<int>, std::equal_to<int>, LookupAllocator> LookupTable;
+
+int main(int argc, char** argv)
+{
+    // Create or open a shared memory buffer
+    CppCommon::SharedMemory buffer("shared_allocator_example", 1024 * 1024);
+
+    // Create or open the shared memory manager
+    CppCommon::SharedMemoryManager& manager = CppCommon::SharedMemoryManager::Attach(buffer);
+
+    if (buffer.owner())
+    {
+        // Create the lookup table in the shared memory and publish it
+        CppCommon::SharedAllocator<LookupTable> alloc(manager);
+        LookupTable* table = alloc.Create(128, -1, std::hash<int>(), std::equal_to<int>(), LookupAllocator(manager));
+        manager.SetRoot(table);
+        std::cout << "Lookup table created!" << std::endl;
+    }
+    else
+        std::cout << "Lookup table opened!" << std::endl;
+
+    LookupTable& table = *(LookupTable*)manager.root();
+
+    // Show help message
+    std::cout << "Please enter a number to increment its counter in the shared lookup table (several processes support). Enter '0' to exit..." << std::endl;
+
+    // Perform number input
+    int key;
+    while ((std::cin >> key) && (key != 0))
+    {
+        // Modification of the shared lookup table must be synchronized between processes by the user
+        int value = ++table.emplace(key, 0).first->second;
+        std::cout << "Counter[" << key << "] = " << value << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*!
+    \file threads_adaptive_mutex.cpp
+    \brief Adaptive mutex synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/adaptive_mutex.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Press Enter to stop..." << std::endl;
+
+    CppCommon::AdaptiveMutex lock;
+
+    // Start some threads
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        threads.emplace_back([&lock, &stop, thread]()
+        {
+            while (!stop)
+            {
+                // Use locker with adaptive mutex to protect the output
+                CppCommon::Locker<CppCommon::AdaptiveMutex> locker(lock);
+
+                std::cout << "Random value from thread " << thread << ": " << rand() << std::endl;
+            }
+        });
+    }
+
+    // Wait for input
+    std::cin.get();
+
+    // Stop threads
+    stop = true;
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
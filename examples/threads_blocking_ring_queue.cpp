@@ -0,0 +1,60 @@
+/*!
+    \file threads_blocking_ring_queue.cpp
+    \brief Blocking ring queue adapter example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/blocking_ring_queue.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create blocking ring queue adapter
+    CppCommon::BlockingRingQueue<int> queue(1024);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue]()
+    {
+        int item;
+
+        do
+        {
+            // Dequeue the item or end consume
+            if (!queue.Dequeue(item))
+                break;
+
+            // Consume the item
+            std::cout << "Your entered number: " << item << std::endl;
+        } while (item != 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Enqueue the item or end produce
+        if (!queue.Enqueue(item))
+            break;
+
+        if (item == 0)
+        {
+            // Close the blocking ring queue
+            queue.Close();
+            break;
+        }
+    }
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    return 0;
+}
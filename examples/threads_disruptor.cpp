@@ -0,0 +1,68 @@
+/*!
+    \file threads_disruptor.cpp
+    \brief Disruptor ring buffer with consumer graph example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/disruptor.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+struct Event
+{
+    int number;
+    int square;
+};
+
+int main(int argc, char** argv)
+{
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Create disruptor ring buffer
+    CppCommon::Disruptor<Event> disruptor(1024);
+
+    // Build two stages pipeline: the second stage processes items after the first one
+    auto& calculator = disruptor.AddConsumer();
+    auto& printer = disruptor.AddConsumer({ &calculator });
+
+    // Start the first stage thread
+    auto stage1 = std::thread([&calculator]()
+    {
+        // Calculate squares of entered numbers in place
+        while (calculator.Consume([](Event& event, int64_t sequence, bool end_of_batch) { event.square = event.number * event.number; }) > 0);
+    });
+
+    // Start the second stage thread
+    auto stage2 = std::thread([&printer]()
+    {
+        // Print entered numbers with their squares
+        while (printer.Consume([](Event& event, int64_t sequence, bool end_of_batch) { std::cout << "Your entered number: " << event.number << ", its square: " << event.square << std::endl; }) > 0);
+    });
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int number = std::stoi(line);
+
+        // Publish the entered number or end produce
+        if (!disruptor.Produce([number](Event& event, int64_t sequence) { event.number = number; }))
+            break;
+
+        if (number == 0)
+            break;
+    }
+
+    // Close the disruptor
+    disruptor.Close();
+
+    // Wait for stages threads
+    stage1.join();
+    stage2.join();
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*!
+    \file threads_event_count.cpp
+    \brief Event count synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/event_count.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter the count of items to produce. Enter '0' to exit...";
+
+    int concurrency = 4;
+
+    std::atomic<int> items(0);
+    std::atomic<bool> stop(false);
+
+    CppCommon::EventCount event;
+
+    // Try to consume one produced item
+    auto consume = [&items]()
+    {
+        int available = items.load();
+        while (available > 0)
+            if (items.compare_exchange_weak(available, available - 1))
+                return true;
+        return false;
+    };
+
+    // Start some consumer threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&event, &stop, &consume, thread]()
+        {
+            // Consume all produced items before stop
+            for (;;)
+            {
+                if (consume())
+                {
+                    std::cout << "Thread " << thread << " consumed an item!" << std::endl;
+                    continue;
+                }
+
+                // Prepare to wait, re-check the condition and commit the wait
+                uint32_t key = event.PrepareWait();
+                if (consume())
+                {
+                    event.CancelWait();
+                    std::cout << "Thread " << thread << " consumed an item!" << std::endl;
+                    continue;
+                }
+                if (stop)
+                {
+                    event.CancelWait();
+                    break;
+                }
+                event.CommitWait(key);
+            }
+        });
+    }
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "0")
+            break;
+
+        int count = std::atoi(line.c_str());
+        if (count <= 0)
+        {
+            std::cout << help << std::endl;
+            continue;
+        }
+
+        // Produce items and notify the same count of consumers
+        items += count;
+        event.Notify(count);
+    }
+
+    // Stop consumer threads
+    stop = true;
+    event.NotifyAll();
+
+    // Wait for all threads
+    for (auto& thread : threads)
+        thread.join();
+
+    return 0;
+}
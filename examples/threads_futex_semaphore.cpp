@@ -0,0 +1,66 @@
+/*!
+    \file threads_futex_semaphore.cpp
+    \brief Futex semaphore synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/futex_semaphore.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter '+' to lock, '-' to unlock and '*' to unlock all locked resources of the semaphore. Enter '0' to exit...";
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    // Assume we have four resources
+    int resources = 4;
+
+    // Create semaphore for our resources
+    CppCommon::FutexSemaphore semaphore(resources);
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "+")
+        {
+            if (semaphore.TryLock())
+                std::cout << "Semaphore successfully locked!" << std::endl;
+            else
+                std::cout << "Failed to lock semaphore! Semaphore resources exceeded..." << std::endl;
+        }
+        else if (line == "-")
+        {
+            if (semaphore.available() < semaphore.resources())
+            {
+                semaphore.Unlock();
+                std::cout << "Semaphore successfully unlocked!" << std::endl;
+            }
+            else
+                std::cout << "Failed to unlock semaphore! Semaphore is fully unlocked..." << std::endl;
+        }
+        else if (line == "*")
+        {
+            int locked = semaphore.resources() - semaphore.available();
+            if (locked > 0)
+            {
+                semaphore.Unlock(locked);
+                std::cout << "Semaphore successfully unlocked " << locked << " resources!" << std::endl;
+            }
+            else
+                std::cout << "Failed to unlock semaphore! Semaphore is fully unlocked..." << std::endl;
+        }
+        else if (line == "0")
+            break;
+        else
+            std::cout << help << std::endl;
+    }
+
+    return 0;
+}
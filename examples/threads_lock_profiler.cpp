@@ -0,0 +1,71 @@
+/*!
+    \file threads_lock_profiler.cpp
+    \brief Lock contention profiler example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/critical_section.h"
+#include "threads/lock_profiler.h"
+#include "threads/rw_lock.h"
+#include "threads/thread.h"
+
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Sample call stacks of 3 slowest waits of each lock site
+    CppCommon::LockProfiler::SetStackTraces(3);
+    CppCommon::LockProfiler::Enable();
+
+    CppCommon::ProfiledLock<CppCommon::CriticalSection> counter_lock("counter");
+    CppCommon::ProfiledLock<CppCommon::RWLock> cache_lock("cache");
+
+    int counter = 0;
+    std::map<int, int> cache;
+
+    // Start worker threads
+    std::vector<std::thread> workers;
+    for (int worker = 0; worker < 4; ++worker)
+    {
+        workers.emplace_back([&, worker]()
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                // Short critical section
+                {
+                    CppCommon::Locker<CppCommon::ProfiledLock<CppCommon::CriticalSection>> locker(counter_lock);
+                    ++counter;
+                }
+
+                // Mostly read cache with rare long updates
+                if ((i % 100) == 0)
+                {
+                    CppCommon::WriteLocker<CppCommon::ProfiledLock<CppCommon::RWLock>> locker(cache_lock);
+                    cache[worker * 1000 + i] = i;
+                    CppCommon::Thread::Sleep(1);
+                }
+                else
+                {
+                    CppCommon::ReadLocker<CppCommon::ProfiledLock<CppCommon::RWLock>> locker(cache_lock);
+                    cache.find(i);
+                }
+            }
+        });
+    }
+
+    // Wait for all worker threads
+    for (auto& worker : workers)
+        worker.join();
+
+    CppCommon::LockProfiler::Disable();
+
+    // Dump lock sites statistics from the most contended one
+    CppCommon::LockProfiler::Dump(std::cout);
+
+    return 0;
+}
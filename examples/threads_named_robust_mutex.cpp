@@ -0,0 +1,58 @@
+/*!
+    \file threads_named_robust_mutex.cpp
+    \brief Named robust mutex synchronization primitive example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/named_robust_mutex.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    std::string help = "Please enter '+' to lock and '-' to unlock the named robust mutex (several processes support). Enter '0' to exit...";
+
+    // Show help message
+    std::cout << help << std::endl;
+
+    // Create named robust mutex
+    CppCommon::NamedRobustMutex mutex("named_robust_mutex_example");
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "+")
+        {
+            if (mutex.TryLock())
+            {
+                std::cout << "Mutex successfully locked!" << std::endl;
+                if (mutex.recovered())
+                    std::cout << "Mutex was recovered from the dead owner process!" << std::endl;
+            }
+            else
+                std::cout << "Failed to lock mutex!" << std::endl;
+        }
+        else if (line == "-")
+        {
+            try
+            {
+                mutex.Unlock();
+                std::cout << "Mutex successfully unlocked!" << std::endl;
+            }
+            catch (const CppCommon::SystemException&)
+            {
+                std::cout << "Failed to unlock mutex!" << std::endl;
+            }
+        }
+        else if (line == "0")
+            break;
+        else
+            std::cout << help << std::endl;
+    }
+
+    return 0;
+}
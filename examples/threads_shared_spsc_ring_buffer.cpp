@@ -0,0 +1,53 @@
+/*!
+    \file threads_shared_spsc_ring_buffer.cpp
+    \brief Shared memory single producer / single consumer wait-free ring buffer example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Create or open the shared memory ring buffer
+    CppCommon::SharedSPSCRingBuffer buffer("shared_spsc_ring_buffer_example", 4096);
+
+    // The first process consumes text, the second one produces
+    if (buffer.owner())
+    {
+        std::cout << "Waiting for text from another process..." << std::endl;
+
+        // Dequeue chunks until the ring buffer is closed
+        char chunk[4096];
+        size_t size;
+        while (buffer.Dequeue(chunk, size = sizeof(chunk)))
+            std::cout << std::string(chunk, size);
+
+        return 0;
+    }
+
+    std::cout << "Please enter some text (several processes support). Enter '#' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        // Close the ring buffer to stop the consumer process
+        if (line == "#")
+        {
+            buffer.Close();
+            break;
+        }
+
+        // Enqueue the line and wake up the consumer process
+        line += "\n";
+        if (!buffer.Enqueue(line.data(), line.size()))
+            break;
+    }
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*!
+    \file threads_shared_spsc_ring_queue.cpp
+    \brief Shared memory single producer / single consumer wait-free ring queue example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_spsc_ring_queue.h"
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    // Create or open the shared memory ring queue
+    CppCommon::SharedSPSCRingQueue<int> queue("shared_spsc_ring_queue_example", 1024);
+
+    // The first process consumes items, the second one produces
+    if (queue.owner())
+    {
+        std::cout << "Waiting for integer numbers from another process..." << std::endl;
+
+        // Dequeue items until the ring queue is closed
+        int item;
+        while (queue.Dequeue(item))
+            std::cout << "Received number: " << item << std::endl;
+
+        return 0;
+    }
+
+    std::cout << "Please enter some integer numbers (several processes support). Enter '0' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+
+        // Close the ring queue to stop the consumer process
+        if (item == 0)
+        {
+            queue.Close();
+            break;
+        }
+
+        // Enqueue the item and wake up the consumer process
+        if (!queue.Enqueue(item))
+            break;
+    }
+
+    return 0;
+}
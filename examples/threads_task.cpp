@@ -0,0 +1,67 @@
+/*!
+    \file threads_task.cpp
+    \brief Coroutine task example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_wait_queue.h"
+#include "threads/scheduler.h"
+
+#include <iostream>
+#include <string>
+
+CppCommon::Task<int> Square(int item)
+{
+    co_return item * item;
+}
+
+CppCommon::Task<> Consume(CppCommon::Scheduler& scheduler, CppCommon::AsyncWaitQueue<int>& queue)
+{
+    // Move the consumer coroutine to the scheduler
+    co_await scheduler.Schedule();
+
+    // Consume items until the queue is closed
+    int item;
+    while (co_await queue.Dequeue(item))
+        std::cout << "Square(" << item << ") = " << co_await Square(item) << std::endl;
+}
+
+CppCommon::Task<> Produce(CppCommon::AsyncWaitQueue<int>& queue, int item)
+{
+    co_await queue.Enqueue(item);
+}
+
+int main(int argc, char** argv)
+{
+    // Create coroutine scheduler on top of the work-stealing thread pool
+    CppCommon::WorkStealingPool pool;
+    CppCommon::PoolScheduler scheduler(pool);
+
+    // Create awaitable wait queue
+    CppCommon::AsyncWaitQueue<int> queue;
+
+    // Spawn the consumer coroutine
+    scheduler.Spawn(Consume(scheduler, queue));
+
+    std::cout << "Please enter some integer numbers. Enter '0' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+        if (item == 0)
+            break;
+
+        // Enqueue the item with the producer coroutine
+        Produce(queue, item).Get();
+    }
+
+    // Close the wait queue and wait for the consumer coroutine
+    queue.Close();
+    pool.Wait();
+
+    return 0;
+}
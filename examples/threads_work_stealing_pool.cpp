@@ -0,0 +1,54 @@
+/*!
+    \file threads_work_stealing_pool.cpp
+    \brief Work-stealing thread pool example
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/work_stealing_pool.h"
+
+#include <iostream>
+#include <string>
+
+uint64_t Fibonacci(CppCommon::WorkStealingPool& pool, int n)
+{
+    // Calculate small numbers sequentially
+    if (n < 20)
+        return (n < 2) ? n : Fibonacci(pool, n - 1) + Fibonacci(pool, n - 2);
+
+    // Fork/join calculation of big numbers
+    uint64_t x, y;
+    pool.Invoke([&]() { x = Fibonacci(pool, n - 1); }, [&]() { y = Fibonacci(pool, n - 2); });
+    return x + y;
+}
+
+int main(int argc, char** argv)
+{
+    // Create work-stealing thread pool
+    CppCommon::WorkStealingPool pool;
+
+    std::cout << "Work-stealing pool workers: " << pool.workers() << std::endl;
+    std::cout << "Please enter some integer numbers to calculate Fibonacci numbers. Enter '0' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int item = std::stoi(line);
+        if (item <= 0)
+            break;
+
+        // Submit the calculation task into the pool
+        pool.Submit([&pool, item]()
+        {
+            uint64_t result = Fibonacci(pool, item);
+            std::cout << "Fibonacci(" << item << ") = " << result << std::endl;
+        });
+
+        // Wait for the calculation
+        pool.Wait();
+    }
+
+    return 0;
+}
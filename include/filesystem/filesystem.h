@@ -12,6 +12,7 @@
 #include "filesystem/directory.h"
 #include "filesystem/exceptions.h"
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 #include "filesystem/path.h"
 #include "filesystem/symlink.h"
 
@@ -0,0 +1,212 @@
+/*!
+    \file mapped_file.h
+    \brief Filesystem memory-mapped file definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+#define CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+
+#include "common/reader.h"
+#include "common/writer.h"
+#include "filesystem/path.h"
+
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Memory-mapped file access pattern advice
+enum class MappedFileAdvice
+{
+    NORMAL,     //!< No special treatment
+    SEQUENTIAL, //!< Expect sequential access (aggressive read-ahead, early reclaim of read pages)
+    RANDOM,     //!< Expect random access (disable read-ahead)
+    WILLNEED,   //!< Expect access in the near future (prefetch pages)
+    DONTNEED    //!< Do not expect access in the near future (release pages)
+};
+
+//! Filesystem memory-mapped file
+/*!
+    Memory-mapped file maps a window of the file into the process address
+    space for read-only or read-write access. Mapped data is accessed
+    directly with data() pointer without any system calls or intermediate
+    buffers, which allows to scan huge files at memory bandwidth.
+
+    Mapped window could be moved over the file with Remap() method and
+    the file could be grown or shrunk with Resize() method. Window offset
+    is not required to be aligned to the page size.
+
+    Memory-mapped file also implements Reader and Writer interfaces over
+    the mapped window with an internal position. Writing is limited with
+    the mapped window size, so resize the file before writing new data.
+
+    Not thread-safe.
+
+    https://en.wikipedia.org/wiki/Memory-mapped_file
+*/
+class MappedFile : public Path, public Reader, public Writer
+{
+public:
+    //! Initialize memory-mapped file with an empty path
+    MappedFile();
+    //! Initialize memory-mapped file with a given path
+    /*!
+        \param path - File path
+    */
+    MappedFile(const Path& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& file) noexcept;
+    virtual ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& file) noexcept;
+
+    //! Check if the file mapped
+    explicit operator bool() const noexcept { return IsMapped(); }
+
+    //! Get the mapped window data
+    uint8_t* data() noexcept;
+    //! Get the constant mapped window data
+    const uint8_t* data() const noexcept;
+    //! Get the mapped window offset in the file
+    uint64_t offset() const noexcept;
+    //! Get the mapped window size
+    size_t size() const noexcept;
+    //! Get the current read/write position in the mapped window
+    size_t position() const noexcept;
+    //! Get the current file size
+    uint64_t file_size() const;
+
+    //! Is the file mapped?
+    bool IsMapped() const noexcept;
+    //! Is the file mapped for writing?
+    bool IsWritable() const noexcept;
+
+    //! Map the file into the memory
+    /*!
+        If the file is not exist or the mapped window is out of the file
+        bounds the method will raise a filesystem exception!
+
+        \param write - Write mode (default is false)
+        \param offset - Mapped window offset (default is 0)
+        \param size - Mapped window size, zero means up to the end of the file (default is 0)
+        \param populate - Populate (prefault) mapped pages in advance (default is false)
+    */
+    void Map(bool write = false, uint64_t offset = 0, size_t size = 0, bool populate = false);
+    //! Remap the mapped window to the new file range
+    /*!
+        If the file is not mapped or the new mapped window is out of the file
+        bounds the method will raise a filesystem exception!
+
+        The read/write position is reset to zero.
+
+        \param offset - Mapped window offset
+        \param size - Mapped window size, zero means up to the end of the file (default is 0)
+    */
+    void Remap(uint64_t offset, size_t size = 0);
+    //! Resize the mapped file
+    /*!
+        Resize the file to the given size and remap the current window up
+        to the new end of the file. If the file is not mapped for writing
+        the method will raise a filesystem exception!
+
+        The read/write position is kept (limited with the new window size),
+        so writing could be continued after the file is grown.
+
+        \param size - File size
+    */
+    void Resize(uint64_t size);
+    //! Unmap the file
+    /*!
+        If the file is not mapped the method will raise a filesystem exception!
+    */
+    void Unmap();
+
+    //! Advise the system about the access pattern of the mapped window range
+    /*!
+        Advice is only a hint, unsupported advices are ignored.
+
+        \param advice - Access pattern advice
+        \param offset - Range offset in the mapped window (default is 0)
+        \param size - Range size, zero means up to the end of the mapped window (default is 0)
+    */
+    void Advise(MappedFileAdvice advice, size_t offset = 0, size_t size = 0);
+    //! Prefetch the mapped window range into the memory
+    /*!
+        \param offset - Range offset in the mapped window (default is 0)
+        \param size - Range size, zero means up to the end of the mapped window (default is 0)
+    */
+    void Prefetch(size_t offset = 0, size_t size = 0)
+    { Advise(MappedFileAdvice::WILLNEED, offset, size); }
+
+    //! Read a bytes buffer from the current position of the mapped window
+    /*!
+        If the file is not mapped the method will raise a filesystem exception!
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+    using Reader::ReadAllBytes;
+    using Reader::ReadAllText;
+    using Reader::ReadAllLines;
+
+    //! Write a byte buffer into the current position of the mapped window
+    /*!
+        If the file is not mapped for writing the method will raise
+        a filesystem exception!
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes (limited with the mapped window size)
+    */
+    size_t Write(const void* buffer, size_t size) override;
+
+    using Writer::Write;
+
+    //! Seek into the mapped window
+    /*!
+        \param position - Read/write position in the mapped window
+    */
+    void Seek(size_t position);
+
+    //! Flush the whole mapped window to the physical file on a disk
+    void Flush() override { Flush(0, 0, false); }
+    //! Flush the mapped window range to the physical file on a disk
+    /*!
+        If the file is not mapped for writing the method will raise
+        a filesystem exception!
+
+        \param offset - Range offset in the mapped window
+        \param size - Range size, zero means up to the end of the mapped window
+        \param async - Schedule asynchronous flush and return immediately (default is false)
+    */
+    void Flush(size_t offset, size_t size, bool async = false);
+
+    //! Swap two instances
+    void swap(MappedFile& file) noexcept;
+    friend void swap(MappedFile& file1, MappedFile& file2) noexcept;
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 88;
+    static const size_t StorageAlign = 8;
+    std::aligned_storage<StorageSize, StorageAlign>::type _storage;
+};
+
+/*! \example filesystem_mapped_file.cpp Filesystem memory-mapped file example */
+
+} // namespace CppCommon
+
+#include "mapped_file.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
@@ -146,6 +146,8 @@ private:
     // Free block
     FreeBlock* _free_block;
 
+    //! Check if the given block is too big for the memory pool chunk
+    bool IsHugeBlock(size_t size) const noexcept;
     //! Calculate the align adjustment of the given buffer
     size_t AlignAdjustment(const void* address, size_t alignment);
     //! Calculate the align adjustment of the given buffer with header
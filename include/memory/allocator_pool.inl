@@ -45,7 +45,7 @@ inline void* PoolMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t al
     assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
 
     // Allocate huge blocks using the auxiliary memory manager
-    if (size > _chunk)
+    if (IsHugeBlock(size))
     {
         void* result = _auxiliary.malloc(size, alignment);
         if (result != nullptr)
@@ -204,7 +204,7 @@ inline void PoolMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
     assert((ptr != nullptr) && "Deallocated block must be valid!");
 
     // Deallocate huge blocks using the auxiliary memory manager
-    if (size > _chunk)
+    if (IsHugeBlock(size))
     {
         _auxiliary.free(ptr, size);
 
@@ -352,6 +352,13 @@ inline void PoolMemoryManager<TAuxMemoryManager>::clear()
     _free_block = nullptr;
 }
 
+template <class TAuxMemoryManager>
+inline bool PoolMemoryManager<TAuxMemoryManager>::IsHugeBlock(size_t size) const noexcept
+{
+    // Block must fit into the memory pool chunk together with its header and alignment adjustment
+    return (size + sizeof(AllocBlock) + alignof(std::max_align_t)) > _chunk;
+}
+
 template <class TAuxMemoryManager>
 inline size_t PoolMemoryManager<TAuxMemoryManager>::AlignAdjustment(const void* address, size_t alignment)
 {
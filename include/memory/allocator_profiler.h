@@ -0,0 +1,89 @@
+/*!
+    \file allocator_profiler.h
+    \brief Profiler memory allocator definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_PROFILER_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_PROFILER_H
+
+#include "allocator.h"
+#include "memory_profiler.h"
+
+namespace CppCommon {
+
+//! Profiler memory manager class
+/*!
+    Profiler memory manager forwards all allocations to the auxiliary memory
+    manager and records them in the memory allocation profiler. It could wrap
+    any other memory manager (default, heap, arena, pool, etc.) to profile
+    its allocations.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class ProfilerMemoryManager
+{
+public:
+    //! Initialize profiler memory manager with an auxiliary memory manager
+    /*!
+        \param auxiliary - Auxiliary memory manager
+    */
+    explicit ProfilerMemoryManager(TAuxMemoryManager& auxiliary) noexcept : _allocated(0), _allocations(0), _auxiliary(auxiliary) {}
+    ProfilerMemoryManager(const ProfilerMemoryManager&) = delete;
+    ProfilerMemoryManager(ProfilerMemoryManager&&) = delete;
+    ~ProfilerMemoryManager() noexcept { reset(); }
+
+    ProfilerMemoryManager& operator=(const ProfilerMemoryManager&) = delete;
+    ProfilerMemoryManager& operator=(ProfilerMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+};
+
+//! Profiler memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using ProfilerAllocator = Allocator<T, ProfilerMemoryManager<TAuxMemoryManager>, nothrow>;
+
+/*! \example memory_profiler.cpp Memory allocation profiler example */
+
+} // namespace CppCommon
+
+#include "allocator_profiler.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_PROFILER_H
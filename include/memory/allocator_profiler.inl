@@ -0,0 +1,55 @@
+/*!
+    \file allocator_profiler.inl
+    \brief Profiler memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline void* ProfilerMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    void* result = _auxiliary.malloc(size, alignment);
+    if (result != nullptr)
+    {
+        // Update allocation statistics
+        _allocated += size;
+        ++_allocations;
+
+        // Record the allocation in the profiler
+        MemoryProfiler::RecordAllocation(size);
+    }
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void ProfilerMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        _auxiliary.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+
+        // Record the deallocation in the profiler
+        MemoryProfiler::RecordDeallocation(size);
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void ProfilerMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
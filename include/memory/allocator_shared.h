@@ -0,0 +1,247 @@
+/*!
+    \file allocator_shared.h
+    \brief Shared memory allocator definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
+
+#include "allocator.h"
+#include "offset_ptr.h"
+
+#include "system/shared_memory.h"
+#include "threads/locker.h"
+#include "threads/spin_lock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <thread>
+
+namespace CppCommon {
+
+//! Shared memory manager class
+/*!
+    Shared memory manager places its own state into the beginning of the given
+    memory buffer (usually a shared memory block) and allocates memory blocks
+    from the rest of the buffer using an address ordered free-list with the
+    first-fit strategy and coalescing of joint free blocks.
+
+    All internal links are stored as offsets, so the same memory buffer could
+    be mapped at different addresses in different processes. Use the shared
+    memory allocator (which uses offset pointers) to build containers inside
+    the buffer and the root object to publish the top-level container to other
+    processes.
+
+    Stored objects must not contain raw pointers or references, virtual tables
+    and stateful hashers or comparators, because they are not valid in other
+    processes.
+
+    Thread-safe and process-safe.
+*/
+class SharedMemoryManager
+{
+public:
+    SharedMemoryManager(const SharedMemoryManager&) = delete;
+    SharedMemoryManager(SharedMemoryManager&&) = delete;
+    ~SharedMemoryManager() = delete;
+
+    SharedMemoryManager& operator=(const SharedMemoryManager&) = delete;
+    SharedMemoryManager& operator=(SharedMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated.load(std::memory_order_relaxed); }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations.load(std::memory_order_relaxed); }
+
+    //! Managed buffer capacity in bytes (including the manager state)
+    size_t capacity() const noexcept { return _capacity; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _capacity; }
+
+    //! Get the root object (nullptr if the root object was not published)
+    void* root() const noexcept;
+    //! Publish the root object
+    /*!
+        Root object must be allocated by the current memory manager.
+
+        \param ptr - Pointer to the root object
+    */
+    void SetRoot(void* ptr) noexcept;
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+    //! Create a new shared memory manager in the given buffer
+    /*!
+        \param buffer - Memory buffer
+        \param capacity - Memory buffer capacity
+        \return Shared memory manager placed in the beginning of the buffer
+    */
+    static SharedMemoryManager& Create(void* buffer, size_t capacity);
+    //! Open an existing shared memory manager in the given buffer
+    /*!
+        Will block until the shared memory manager is initialized by its creator.
+
+        \param buffer - Memory buffer
+        \return Shared memory manager placed in the beginning of the buffer
+    */
+    static SharedMemoryManager& Open(void* buffer);
+    //! Create or open the shared memory manager in the given shared memory block
+    /*!
+        The owner of the shared memory block creates a new shared memory manager,
+        all other users open the existing one.
+
+        \param shared - Shared memory block
+        \return Shared memory manager placed in the beginning of the shared memory block
+    */
+    static SharedMemoryManager& Attach(SharedMemory& shared);
+
+private:
+    // Allocated block
+    struct AllocBlock
+    {
+        size_t size;
+        size_t adjustment;
+    };
+    // Free block
+    struct FreeBlock
+    {
+        size_t size;
+        OffsetPtr<FreeBlock> next;
+    };
+
+    // Shared memory manager signature
+    static const uint32_t SIGNATURE = 0x4D4D4853; // "SHMM"
+
+    std::atomic<uint32_t> _signature;
+    SpinLock _lock;
+    size_t _capacity;
+    std::atomic<size_t> _allocated;
+    std::atomic<size_t> _allocations;
+    std::atomic<ptrdiff_t> _root;
+    OffsetPtr<FreeBlock> _free_block;
+
+    SharedMemoryManager(size_t capacity) noexcept;
+
+    //! Calculate the align adjustment of the given buffer with header
+    static size_t AlignAdjustment(const void* address, size_t alignment, size_t header);
+};
+
+//! Shared memory allocator class
+/*!
+    Shared memory allocator implements standard allocator interface with
+    offset pointers and allocates memory from the shared memory manager.
+    It is used to build containers (e.g. std::vector or HashMap) inside
+    the shared memory block.
+
+    Thread-safe and process-safe.
+*/
+template <typename T, bool nothrow = false>
+class SharedAllocator
+{
+    template <typename U, bool flag>
+    friend class SharedAllocator;
+
+public:
+    //! Element type
+    typedef T value_type;
+    //! Pointer to element
+    typedef OffsetPtr<T> pointer;
+    //! Reference to element
+    typedef T& reference;
+    //! Pointer to constant element
+    typedef OffsetPtr<const T> const_pointer;
+    //! Reference to constant element
+    typedef const T& const_reference;
+    //! Pointer to void
+    typedef OffsetPtr<void> void_pointer;
+    //! Pointer to constant void
+    typedef OffsetPtr<const void> const_void_pointer;
+    //! Quantities of elements
+    typedef size_t size_type;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+
+    //! Initialize allocator with a given shared memory manager
+    /*!
+        \param manager - Shared memory manager
+    */
+    explicit SharedAllocator(SharedMemoryManager& manager) noexcept : _manager(&manager) {}
+    template <typename U>
+    SharedAllocator(const SharedAllocator<U, nothrow>& alloc) noexcept : _manager(alloc._manager) {}
+    SharedAllocator(const SharedAllocator& alloc) noexcept : _manager(alloc._manager) {}
+    ~SharedAllocator() noexcept = default;
+
+    template <typename U>
+    SharedAllocator& operator=(const SharedAllocator<U, nothrow>& alloc) noexcept
+    { _manager = alloc._manager; return *this; }
+    SharedAllocator& operator=(const SharedAllocator& alloc) noexcept
+    { _manager = alloc._manager; return *this; }
+
+    //! Get the shared memory manager
+    SharedMemoryManager& manager() const noexcept { return *_manager; }
+
+    //! Get the maximum number of elements, that could potentially be allocated by the allocator
+    /*!
+        \return The number of elements that might be allocated as maximum by a call to the allocate() method
+    */
+    size_type max_size() const noexcept { return _manager->max_size() / sizeof(T); }
+
+    //! Allocate a block of storage suitable to contain the given count of elements
+    /*!
+        \param num - Number of elements to be allocated
+        \return An offset pointer to the initial element in the block of storage
+    */
+    pointer allocate(size_type num);
+    //! Release a block of storage previously allocated
+    /*!
+        \param ptr - Offset pointer to a block of storage
+        \param num - Number of releasing elements
+    */
+    void deallocate(pointer ptr, size_type num);
+
+    //! Create a single element object
+    /*!
+        \param args - Arguments to initialize the construced element with
+    */
+    template <class... Args>
+    T* Create(Args&&... args);
+    //! Release a single element object
+    /*!
+        \param ptr - Pointer to the object to be released
+    */
+    void Release(T* ptr);
+
+    //! Rebind allocator
+    template <typename TOther> struct rebind { using other = SharedAllocator<TOther, nothrow>; };
+
+private:
+    OffsetPtr<SharedMemoryManager> _manager;
+};
+
+/*! \example memory_shared.cpp Shared memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_shared.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
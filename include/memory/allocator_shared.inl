@@ -0,0 +1,299 @@
+/*!
+    \file allocator_shared.inl
+    \brief Shared memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable: 4127) // C4127: conditional expression is constant
+#endif
+
+namespace CppCommon {
+
+inline SharedMemoryManager::SharedMemoryManager(size_t capacity) noexcept
+    : _signature(0),
+      _capacity(capacity),
+      _allocated(0),
+      _allocations(0),
+      _root(0)
+{
+    reset();
+}
+
+inline void* SharedMemoryManager::root() const noexcept
+{
+    ptrdiff_t offset = _root.load(std::memory_order_acquire);
+    return (offset != 0) ? ((uint8_t*)this + offset) : nullptr;
+}
+
+inline void SharedMemoryManager::SetRoot(void* ptr) noexcept
+{
+    assert(((ptr == nullptr) || (((uint8_t*)ptr > (uint8_t*)this) && ((uint8_t*)ptr < ((uint8_t*)this + _capacity)))) && "Root object must be allocated by the current memory manager!");
+
+    _root.store((ptr != nullptr) ? ((uint8_t*)ptr - (uint8_t*)this) : 0, std::memory_order_release);
+}
+
+inline void* SharedMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    Locker<SpinLock> locker(_lock);
+
+    FreeBlock* prev_free_block = nullptr;
+    FreeBlock* current_free_block = _free_block.get();
+
+    while (current_free_block != nullptr)
+    {
+        // Calculate memory adjustment including the allocation header
+        size_t adjustment = AlignAdjustment(current_free_block, alignment, sizeof(AllocBlock));
+
+        // Calculate aligned block size keeping the next free block aligned
+        size_t aligned_size = size + adjustment;
+        if ((aligned_size % alignof(FreeBlock)) > 0)
+            aligned_size += alignof(FreeBlock) - (aligned_size % alignof(FreeBlock));
+
+        // If there is no enough free space in the current free block use the next one
+        if (current_free_block->size < aligned_size)
+        {
+            prev_free_block = current_free_block;
+            current_free_block = current_free_block->next.get();
+            continue;
+        }
+
+        // Allocate from the remaining memory in the current free block
+        FreeBlock* next_free_block;
+        if ((current_free_block->size - aligned_size) < sizeof(FreeBlock))
+        {
+            // Increase allocation size instead of creating a new free block
+            aligned_size = current_free_block->size;
+            next_free_block = current_free_block->next.get();
+        }
+        else
+        {
+            // Create a new free block containing remaining memory
+            next_free_block = (FreeBlock*)((uint8_t*)current_free_block + aligned_size);
+            next_free_block->size = current_free_block->size - aligned_size;
+            new (&next_free_block->next) OffsetPtr<FreeBlock>(current_free_block->next);
+        }
+
+        // Update the free blocks list
+        if (prev_free_block != nullptr)
+            prev_free_block->next = next_free_block;
+        else
+            _free_block = next_free_block;
+
+        // Calculate the aligned address
+        uint8_t* aligned = (uint8_t*)current_free_block + adjustment;
+
+        // Create a new allocated block
+        AllocBlock* alloc_block = (AllocBlock*)(aligned - sizeof(AllocBlock));
+        alloc_block->size = aligned_size;
+        alloc_block->adjustment = adjustment;
+
+        // Update allocation statistics
+        _allocated.fetch_add(size, std::memory_order_relaxed);
+        _allocations.fetch_add(1, std::memory_order_relaxed);
+
+        return aligned;
+    }
+
+    // Out of memory...
+    return nullptr;
+}
+
+inline void SharedMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+    assert((((uint8_t*)ptr > (uint8_t*)this) && ((uint8_t*)ptr < ((uint8_t*)this + _capacity))) && "Deallocated block must be allocated by the current memory manager!");
+
+    Locker<SpinLock> locker(_lock);
+
+    AllocBlock* alloc_block = (AllocBlock*)((uint8_t*)ptr - sizeof(AllocBlock));
+
+    FreeBlock* block = (FreeBlock*)((uint8_t*)ptr - alloc_block->adjustment);
+    size_t block_size = alloc_block->size;
+
+    // Find the place of the block in the address ordered free blocks list
+    FreeBlock* prev_free_block = nullptr;
+    FreeBlock* next_free_block = _free_block.get();
+    while ((next_free_block != nullptr) && (next_free_block < block))
+    {
+        prev_free_block = next_free_block;
+        next_free_block = next_free_block->next.get();
+    }
+
+    // Insert a new free block
+    block->size = block_size;
+    new (&block->next) OffsetPtr<FreeBlock>(next_free_block);
+    if (prev_free_block != nullptr)
+        prev_free_block->next = block;
+    else
+        _free_block = block;
+
+    // Right joint
+    if ((next_free_block != nullptr) && (((uint8_t*)block + block->size) == (uint8_t*)next_free_block))
+    {
+        block->size += next_free_block->size;
+        block->next = next_free_block->next;
+    }
+
+    // Left joint
+    if ((prev_free_block != nullptr) && (((uint8_t*)prev_free_block + prev_free_block->size) == (uint8_t*)block))
+    {
+        prev_free_block->size += block->size;
+        prev_free_block->next = block->next;
+    }
+
+    // Update allocation statistics
+    _allocated.fetch_sub(size, std::memory_order_relaxed);
+    _allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void SharedMemoryManager::reset()
+{
+    assert((allocated() == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((allocations() == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    Locker<SpinLock> locker(_lock);
+
+    // Initialize a single free block with the rest of the buffer
+    uint8_t* start = (uint8_t*)Memory::Align((uint8_t*)this + sizeof(SharedMemoryManager), alignof(FreeBlock));
+    uint8_t* end = (uint8_t*)this + _capacity;
+    if ((start + sizeof(FreeBlock)) <= end)
+    {
+        FreeBlock* free_block = (FreeBlock*)start;
+        free_block->size = (size_t)(end - start) - ((size_t)(end - start) % alignof(FreeBlock));
+        new (&free_block->next) OffsetPtr<FreeBlock>();
+        _free_block = free_block;
+    }
+    else
+        _free_block = nullptr;
+
+    _root.store(0, std::memory_order_release);
+}
+
+inline SharedMemoryManager& SharedMemoryManager::Create(void* buffer, size_t capacity)
+{
+    assert((buffer != nullptr) && "Shared memory buffer must be valid!");
+    assert(Memory::IsAligned(buffer, alignof(SharedMemoryManager)) && "Shared memory buffer must be aligned!");
+    assert((capacity >= sizeof(SharedMemoryManager)) && "Shared memory buffer capacity must be big enough to fit the shared memory manager!");
+
+    SharedMemoryManager* manager = new (buffer) SharedMemoryManager(capacity);
+
+    // Mark the shared memory manager as initialized
+    manager->_signature.store(SIGNATURE, std::memory_order_release);
+
+    return *manager;
+}
+
+inline SharedMemoryManager& SharedMemoryManager::Open(void* buffer)
+{
+    assert((buffer != nullptr) && "Shared memory buffer must be valid!");
+    assert(Memory::IsAligned(buffer, alignof(SharedMemoryManager)) && "Shared memory buffer must be aligned!");
+
+    SharedMemoryManager* manager = (SharedMemoryManager*)buffer;
+
+    // Wait for the shared memory manager initialization
+    while (manager->_signature.load(std::memory_order_acquire) != SIGNATURE)
+        std::this_thread::yield();
+
+    return *manager;
+}
+
+inline SharedMemoryManager& SharedMemoryManager::Attach(SharedMemory& shared)
+{
+    if (shared.owner())
+        return Create(shared.ptr(), shared.size());
+    else
+        return Open(shared.ptr());
+}
+
+inline size_t SharedMemoryManager::AlignAdjustment(const void* address, size_t alignment, size_t header)
+{
+    alignment = std::max(alignment, alignof(AllocBlock));
+
+    size_t adjustment = (uint8_t*)Memory::Align(address, alignment) - (uint8_t*)address;
+
+    size_t required = header;
+    if (adjustment < required)
+    {
+        required -= adjustment;
+        adjustment += alignment * (required / alignment);
+        if ((required % alignment) > 0)
+            adjustment += alignment;
+    }
+
+    return adjustment;
+}
+
+template <typename T, typename U, bool nothrow>
+inline bool operator==(const SharedAllocator<T, nothrow>& alloc1, const SharedAllocator<U, nothrow>& alloc2) noexcept
+{
+    return &alloc1.manager() == &alloc2.manager();
+}
+
+template <typename T, typename U, bool nothrow>
+inline bool operator!=(const SharedAllocator<T, nothrow>& alloc1, const SharedAllocator<U, nothrow>& alloc2) noexcept
+{
+    return &alloc1.manager() != &alloc2.manager();
+}
+
+template <typename T, bool nothrow>
+inline typename SharedAllocator<T, nothrow>::pointer SharedAllocator<T, nothrow>::allocate(size_t num)
+{
+    T* result = (T*)_manager->malloc(num * sizeof(T), alignof(T));
+    if (result != nullptr)
+        return pointer(result);
+
+    // Not enough memory...
+    if (nothrow)
+        return pointer();
+    else
+        throw std::bad_alloc();
+}
+
+template <typename T, bool nothrow>
+inline void SharedAllocator<T, nothrow>::deallocate(pointer ptr, size_t num)
+{
+    _manager->free(ptr.get(), num * sizeof(T));
+}
+
+template <typename T, bool nothrow>
+template <class... Args>
+inline T* SharedAllocator<T, nothrow>::Create(Args&&... args)
+{
+    // Allocate memory for the element
+    void* ptr = _manager->malloc(sizeof(T), alignof(T));
+
+    // Construct the element
+    if (ptr != nullptr)
+        new (ptr) T(std::forward<Args>(args)...);
+
+    return (T*)ptr;
+}
+
+template <typename T, bool nothrow>
+inline void SharedAllocator<T, nothrow>::Release(T* ptr)
+{
+    assert((ptr != nullptr) && "Released element must be valid!");
+
+    // Release the element
+    if (ptr != nullptr)
+    {
+        // Destroy the element
+        ptr->~T();
+
+        // Free element memory
+        _manager->free(ptr, sizeof(T));
+    }
+}
+
+} // namespace CppCommon
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
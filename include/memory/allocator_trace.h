@@ -0,0 +1,92 @@
+/*!
+    \file allocator_trace.h
+    \brief Trace memory allocator definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_TRACE_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_TRACE_H
+
+#include "allocator.h"
+#include "memory_trace.h"
+
+namespace CppCommon {
+
+//! Trace memory manager class
+/*!
+    Trace memory manager forwards all allocations to the auxiliary memory
+    manager and records them into the memory allocation trace. Recorded
+    trace could be saved and replayed later against other memory managers.
+
+    Not thread-safe.
+*/
+template <class TAuxMemoryManager = DefaultMemoryManager>
+class TraceMemoryManager
+{
+public:
+    //! Initialize trace memory manager with an auxiliary memory manager and a memory trace to record
+    /*!
+        \param auxiliary - Auxiliary memory manager
+        \param trace - Memory trace to record
+    */
+    explicit TraceMemoryManager(TAuxMemoryManager& auxiliary, MemoryTrace& trace) noexcept : _allocated(0), _allocations(0), _auxiliary(auxiliary), _trace(trace) {}
+    TraceMemoryManager(const TraceMemoryManager&) = delete;
+    TraceMemoryManager(TraceMemoryManager&&) = delete;
+    ~TraceMemoryManager() noexcept { reset(); }
+
+    TraceMemoryManager& operator=(const TraceMemoryManager&) = delete;
+    TraceMemoryManager& operator=(TraceMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return _auxiliary.max_size(); }
+
+    //! Auxiliary memory manager
+    TAuxMemoryManager& auxiliary() noexcept { return _auxiliary; }
+    //! Recorded memory trace
+    MemoryTrace& trace() noexcept { return _trace; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Allocation statistics
+    size_t _allocated;
+    size_t _allocations;
+
+    // Auxiliary memory manager
+    TAuxMemoryManager& _auxiliary;
+
+    // Recorded memory trace
+    MemoryTrace& _trace;
+};
+
+//! Trace memory allocator class
+template <typename T, class TAuxMemoryManager = DefaultMemoryManager, bool nothrow = false>
+using TraceAllocator = Allocator<T, TraceMemoryManager<TAuxMemoryManager>, nothrow>;
+
+} // namespace CppCommon
+
+#include "allocator_trace.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_TRACE_H
@@ -0,0 +1,55 @@
+/*!
+    \file allocator_trace.inl
+    \brief Trace memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TAuxMemoryManager>
+inline void* TraceMemoryManager<TAuxMemoryManager>::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    void* result = _auxiliary.malloc(size, alignment);
+    if (result != nullptr)
+    {
+        // Update allocation statistics
+        _allocated += size;
+        ++_allocations;
+
+        // Record the allocation in the trace
+        _trace.RecordAllocation(result, size, alignment);
+    }
+    return result;
+}
+
+template <class TAuxMemoryManager>
+inline void TraceMemoryManager<TAuxMemoryManager>::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+
+    if (ptr != nullptr)
+    {
+        // Record the deallocation in the trace before the block address could be reused
+        _trace.RecordDeallocation(ptr, size);
+
+        _auxiliary.free(ptr, size);
+
+        // Update allocation statistics
+        _allocated -= size;
+        --_allocations;
+    }
+}
+
+template <class TAuxMemoryManager>
+inline void TraceMemoryManager<TAuxMemoryManager>::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+}
+
+} // namespace CppCommon
@@ -22,6 +22,24 @@
 
 namespace CppCommon {
 
+//! Memory SIMD kernels
+enum class MemoryKernel : uint8_t
+{
+    SCALAR,     //!< Portable scalar kernel
+    SSE2,       //!< SSE2 kernel
+    AVX2,       //!< AVX2 kernel
+    AVX512      //!< AVX-512 kernel
+};
+
+//! Stream output: Memory SIMD kernel
+/*!
+    \param stream - Output stream
+    \param kernel - Memory SIMD kernel
+    \return Output stream
+*/
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, MemoryKernel kernel);
+
 //! Memory management static class
 /*!
     Provides memory management functionality such as total and free RAM available.
@@ -43,6 +61,17 @@ public:
     static int64_t RamTotal();
     //! Free RAM in bytes
     static int64_t RamFree();
+    //! Resident RAM of the current process in bytes
+    static int64_t RamProcess();
+
+    //! Get the fastest memory SIMD kernel supported by the current CPU
+    static MemoryKernel Kernel() noexcept;
+    //! Is the given memory SIMD kernel supported by the current CPU?
+    /*!
+        \param kernel - Memory SIMD kernel
+        \return 'true' if the given memory SIMD kernel is supported, 'false' if the given memory SIMD kernel is not supported
+    */
+    static bool IsKernelSupported(MemoryKernel kernel) noexcept;
 
     //! Is the given memory buffer filled with zeros?
     /*!
@@ -50,7 +79,18 @@ public:
         \param size - Size of memory buffer in bytes
         \return 'true' if the given memory buffer is filled with zeros, 'false' if the memory buffer is not filled with zeros
     */
-    static bool IsZero(const void* buffer, size_t size) noexcept;
+    static bool IsZero(const void* buffer, size_t size) noexcept
+    { return IsZero(buffer, size, Kernel()); }
+    //! Is the given memory buffer filled with zeros? (using the given memory SIMD kernel)
+    /*!
+        If the given memory SIMD kernel is not supported by the current CPU then the fastest supported one will be used.
+
+        \param buffer - Memory buffer
+        \param size - Size of memory buffer in bytes
+        \param kernel - Memory SIMD kernel
+        \return 'true' if the given memory buffer is filled with zeros, 'false' if the memory buffer is not filled with zeros
+    */
+    static bool IsZero(const void* buffer, size_t size, MemoryKernel kernel) noexcept;
 
     //! Is the given alignment valid?
     /*!
@@ -80,16 +120,41 @@ public:
 
     //! Fill the given memory buffer with zeros
     /*!
+        Zero fill is never optimized out by the compiler, so it is safe to wipe sensitive data.
+
+        \param buffer - Memory buffer to fill
+        \param size - Size of memory buffer in bytes
+    */
+    static void ZeroFill(void* buffer, size_t size)
+    { ZeroFill(buffer, size, Kernel()); }
+    //! Fill the given memory buffer with zeros (using the given memory SIMD kernel)
+    /*!
+        If the given memory SIMD kernel is not supported by the current CPU then the fastest supported one will be used.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
+        \param kernel - Memory SIMD kernel
     */
-    static void ZeroFill(void* buffer, size_t size);
+    static void ZeroFill(void* buffer, size_t size, MemoryKernel kernel);
     //! Fill the given memory buffer with random bytes
     /*!
+        Random bytes are generated by the fast non-cryptographic xoshiro256** generator
+        seeded once per thread. Use CryptoFill() to get cryptographic strong random bytes.
+
+        \param buffer - Memory buffer to fill
+        \param size - Size of memory buffer in bytes
+    */
+    static void RandomFill(void* buffer, size_t size)
+    { RandomFill(buffer, size, Kernel()); }
+    //! Fill the given memory buffer with random bytes (using the given memory SIMD kernel)
+    /*!
+        If the given memory SIMD kernel is not supported by the current CPU then the fastest supported one will be used.
+
         \param buffer - Memory buffer to fill
         \param size - Size of memory buffer in bytes
+        \param kernel - Memory SIMD kernel
     */
-    static void RandomFill(void* buffer, size_t size);
+    static void RandomFill(void* buffer, size_t size, MemoryKernel kernel);
     //! Fill the given memory buffer with cryptographic strong random bytes
     /*!
         \param buffer - Memory buffer to fill
@@ -10,6 +10,30 @@
 
 namespace CppCommon {
 
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, MemoryKernel kernel)
+{
+    switch (kernel)
+    {
+        case MemoryKernel::SCALAR:
+            stream << "SCALAR";
+            break;
+        case MemoryKernel::SSE2:
+            stream << "SSE2";
+            break;
+        case MemoryKernel::AVX2:
+            stream << "AVX2";
+            break;
+        case MemoryKernel::AVX512:
+            stream << "AVX512";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
 inline bool Memory::IsValidAlignment(size_t alignment) noexcept
 {
     return ((alignment > 0) && ((alignment & (alignment - 1)) == 0));
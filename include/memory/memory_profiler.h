@@ -0,0 +1,124 @@
+/*!
+    \file memory_profiler.h
+    \brief Memory allocation profiler definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MEMORY_PROFILER_H
+#define CPPCOMMON_MEMORY_MEMORY_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace CppCommon {
+
+//! Memory allocation profiler static class
+/*!
+    Memory allocation profiler collects allocation statistics (counters and
+    power-of-two size histogram) with a few relaxed atomic operations on the
+    per-thread shard, and samples call stacks of allocations with the given
+    average sampling interval in bytes. Each sampled call stack is weighted
+    with the estimated count of bytes it represents, so small and large
+    allocations are accounted without a bias.
+
+    Profiler is disabled by default. Disabled profiler costs a single atomic
+    load per recorded allocation.
+
+    Sampled call stacks could be dumped in the folded stacks format which is
+    accepted by flame graph tools (flamegraph.pl, inferno, speedscope).
+
+    Thread-safe.
+
+    https://github.com/brendangregg/FlameGraph
+*/
+class MemoryProfiler
+{
+public:
+    //! Size histogram buckets count
+    static const size_t HISTOGRAM_SIZE = 65;
+
+    //! Memory allocation statistics
+    struct Statistics
+    {
+        uint64_t allocations;               //!< Total count of allocations
+        uint64_t deallocations;             //!< Total count of deallocations
+        uint64_t allocated;                 //!< Total allocated bytes
+        uint64_t deallocated;               //!< Total deallocated bytes
+        uint64_t samples;                   //!< Total count of sampled allocations
+        uint64_t histogram[HISTOGRAM_SIZE]; //!< Allocation size histogram (bucket N counts sizes in range [2^(N-1), 2^N))
+
+        //! Count of live allocations
+        uint64_t live_allocations() const noexcept { return allocations - deallocations; }
+        //! Live allocated bytes
+        uint64_t live_allocated() const noexcept { return allocated - deallocated; }
+
+        //! Output memory allocation statistics into the given output stream
+        friend std::ostream& operator<<(std::ostream& os, const Statistics& statistics);
+    };
+
+public:
+    MemoryProfiler() = delete;
+    MemoryProfiler(const MemoryProfiler&) = delete;
+    MemoryProfiler(MemoryProfiler&&) = delete;
+    ~MemoryProfiler() = delete;
+
+    MemoryProfiler& operator=(const MemoryProfiler&) = delete;
+    MemoryProfiler& operator=(MemoryProfiler&&) = delete;
+
+    //! Is the memory allocation profiler enabled?
+    static bool IsEnabled() noexcept;
+    //! Enable the memory allocation profiler
+    static void Enable() noexcept;
+    //! Disable the memory allocation profiler
+    static void Disable() noexcept;
+
+    //! Get the average sampling interval in bytes
+    static size_t GetSamplingInterval() noexcept;
+    //! Set the average sampling interval in bytes
+    /*!
+        Zero sampling interval disables call stacks sampling. Default sampling interval is 512 KiB.
+        New sampling interval is applied to the next allocation of every thread.
+
+        \param interval - Average sampling interval in bytes
+    */
+    static void SetSamplingInterval(size_t interval) noexcept;
+
+    //! Record a new memory allocation of the given size
+    /*!
+        \param size - Allocated block size
+    */
+    static void RecordAllocation(size_t size) noexcept;
+    //! Record a memory deallocation of the given size
+    /*!
+        \param size - Deallocated block size
+    */
+    static void RecordDeallocation(size_t size) noexcept;
+
+    //! Get the current memory allocation statistics
+    static Statistics GetStatistics() noexcept;
+
+    //! Dump sampled call stacks in the folded stacks format
+    /*!
+        Each line contains semicolon separated call stack frames (from the
+        outermost to the innermost one) followed by the estimated allocated
+        bytes for the call stack.
+
+        \param stream - Output stream
+    */
+    static void DumpFlameGraph(std::ostream& stream);
+    //! Dump sampled call stacks in the folded stacks format into the string
+    static std::string DumpFlameGraph();
+
+    //! Reset all collected statistics and sampled call stacks
+    static void Reset();
+};
+
+/*! \example memory_profiler.cpp Memory allocation profiler example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_MEMORY_PROFILER_H
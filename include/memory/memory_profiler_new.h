@@ -0,0 +1,75 @@
+/*!
+    \file memory_profiler_new.h
+    \brief Memory allocation profiler global new/delete operators. Include this file into exactly one translation unit to profile global new/delete operators.
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MEMORY_PROFILER_NEW_H
+#define CPPCOMMON_MEMORY_MEMORY_PROFILER_NEW_H
+
+#include "memory/memory_profiler.h"
+
+#include <cstdlib>
+#include <new>
+
+//! @cond INTERNALS
+namespace CppCommon {
+namespace Internals {
+
+// Every profiled block keeps its size in the header to record deallocations
+const size_t MEMORY_PROFILER_NEW_HEADER = alignof(std::max_align_t);
+
+inline void* MemoryProfilerNew(size_t size) noexcept
+{
+    void* ptr = std::malloc(size + MEMORY_PROFILER_NEW_HEADER);
+    if (ptr == nullptr)
+        return nullptr;
+
+    *(size_t*)ptr = size;
+    MemoryProfiler::RecordAllocation(size);
+    return (uint8_t*)ptr + MEMORY_PROFILER_NEW_HEADER;
+}
+
+inline void MemoryProfilerDelete(void* ptr) noexcept
+{
+    if (ptr == nullptr)
+        return;
+
+    ptr = (uint8_t*)ptr - MEMORY_PROFILER_NEW_HEADER;
+    MemoryProfiler::RecordDeallocation(*(size_t*)ptr);
+    std::free(ptr);
+}
+
+} // namespace Internals
+} // namespace CppCommon
+//! @endcond
+
+void* operator new(size_t size)
+{
+    void* ptr = CppCommon::Internals::MemoryProfilerNew(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    void* ptr = CppCommon::Internals::MemoryProfilerNew(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CppCommon::Internals::MemoryProfilerNew(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return CppCommon::Internals::MemoryProfilerNew(size); }
+
+void operator delete(void* ptr) noexcept { CppCommon::Internals::MemoryProfilerDelete(ptr); }
+void operator delete[](void* ptr) noexcept { CppCommon::Internals::MemoryProfilerDelete(ptr); }
+void operator delete(void* ptr, size_t) noexcept { CppCommon::Internals::MemoryProfilerDelete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { CppCommon::Internals::MemoryProfilerDelete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { CppCommon::Internals::MemoryProfilerDelete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { CppCommon::Internals::MemoryProfilerDelete(ptr); }
+
+#endif // CPPCOMMON_MEMORY_MEMORY_PROFILER_NEW_H
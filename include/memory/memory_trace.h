@@ -0,0 +1,154 @@
+/*!
+    \file memory_trace.h
+    \brief Memory allocation trace definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MEMORY_TRACE_H
+#define CPPCOMMON_MEMORY_MEMORY_TRACE_H
+
+#include "common/reader.h"
+#include "common/writer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace CppCommon {
+
+//! Memory allocation trace
+/*!
+    Memory allocation trace records the sequence of allocations and
+    deallocations of a real workload (usually with the trace memory manager
+    shim) and replays it against any memory manager. This allows to compare
+    memory managers on the actual workload instead of synthetic patterns.
+
+    Trace could be saved into and loaded from the compact binary format:
+    allocations are identified by their order, so each allocation event
+    stores only its size and alignment and each deallocation event stores
+    only the distance to the matching allocation (both as variable-length
+    integers).
+
+    Not thread-safe.
+*/
+class MemoryTrace
+{
+public:
+    //! Memory trace event
+    struct Event
+    {
+        bool allocation;  //!< Allocation (true) or deallocation (false) event
+        size_t id;        //!< Allocation identifier (order of the allocation in the trace)
+        size_t size;      //!< Block size
+        size_t alignment; //!< Block alignment
+    };
+
+    MemoryTrace() : _allocations(0), _live(0), _live_allocations(0), _peak(0), _peak_allocations(0) {}
+    MemoryTrace(const MemoryTrace&) = default;
+    MemoryTrace(MemoryTrace&&) = default;
+    ~MemoryTrace() = default;
+
+    MemoryTrace& operator=(const MemoryTrace&) = default;
+    MemoryTrace& operator=(MemoryTrace&&) = default;
+
+    //! Check if the memory trace is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the memory trace empty?
+    bool empty() const noexcept { return _events.empty(); }
+
+    //! Get the memory trace events
+    const std::vector<Event>& events() const noexcept { return _events; }
+    //! Get the count of memory trace events
+    size_t size() const noexcept { return _events.size(); }
+    //! Get the total count of allocations in the memory trace
+    size_t allocations() const noexcept { return _allocations; }
+    //! Get the peak of live allocated bytes in the memory trace
+    size_t peak() const noexcept { return _peak; }
+    //! Get the peak count of live allocations in the memory trace
+    size_t peak_allocations() const noexcept { return _peak_allocations; }
+
+    //! Record the memory allocation
+    /*!
+        \param ptr - Pointer to the allocated memory block
+        \param size - Block size
+        \param alignment - Block alignment
+    */
+    void RecordAllocation(const void* ptr, size_t size, size_t alignment);
+    //! Record the memory deallocation
+    /*!
+        Deallocations of memory blocks which allocations were not recorded are ignored.
+
+        \param ptr - Pointer to the deallocated memory block
+        \param size - Block size (must be equal to the allocated block size)
+    */
+    void RecordDeallocation(const void* ptr, size_t size);
+
+    //! Replay the memory trace against the given memory manager
+    /*!
+        Allocations which are still alive at the end of the memory trace are
+        deallocated after the replay. Failed allocations are skipped.
+
+        \param manager - Memory manager
+        \return Count of failed allocations
+    */
+    template <class TMemoryManager>
+    size_t Replay(TMemoryManager& manager) const
+    { return Replay(manager, [](){}, 0); }
+    //! Replay the memory trace against the given memory manager with periodic checkpoints
+    /*!
+        Checkpoint handler is called after each period of events and once more
+        at the end of the memory trace before alive allocations are deallocated.
+        It could be used to sample the process memory usage during the replay.
+
+        \param manager - Memory manager
+        \param checkpoint - Checkpoint handler
+        \param period - Checkpoint period in events (zero to call the handler only at the end)
+        \return Count of failed allocations
+    */
+    template <class TMemoryManager, class TCheckpoint>
+    size_t Replay(TMemoryManager& manager, TCheckpoint&& checkpoint, size_t period) const;
+
+    //! Save the memory trace in the binary format
+    /*!
+        \param writer - Writer to save the memory trace
+    */
+    void Save(Writer& writer) const;
+    //! Load the memory trace in the binary format
+    /*!
+        If the memory trace binary format is invalid the method will raise
+        an argument exception!
+
+        \param reader - Reader to load the memory trace
+    */
+    void Load(Reader& reader);
+
+    //! Clear the memory trace
+    void Clear();
+
+    //! Swap two instances
+    void swap(MemoryTrace& trace) noexcept;
+    friend void swap(MemoryTrace& trace1, MemoryTrace& trace2) noexcept;
+
+private:
+    std::vector<Event> _events;
+    std::vector<size_t> _sizes;
+    std::unordered_map<const void*, size_t> _pointers;
+    size_t _allocations;
+    size_t _live;
+    size_t _live_allocations;
+    size_t _peak;
+    size_t _peak_allocations;
+
+    void AddAllocation(size_t size, size_t alignment);
+    void AddDeallocation(size_t id);
+};
+
+} // namespace CppCommon
+
+#include "memory_trace.inl"
+
+#endif // CPPCOMMON_MEMORY_MEMORY_TRACE_H
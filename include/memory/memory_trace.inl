@@ -0,0 +1,55 @@
+/*!
+    \file memory_trace.inl
+    \brief Memory allocation trace inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TMemoryManager, class TCheckpoint>
+inline size_t MemoryTrace::Replay(TMemoryManager& manager, TCheckpoint&& checkpoint, size_t period) const
+{
+    // Replayed memory blocks indexed by allocation identifiers
+    std::vector<void*> blocks(_allocations, nullptr);
+
+    size_t failed = 0;
+    size_t countdown = period;
+    for (const auto& event : _events)
+    {
+        if (event.allocation)
+        {
+            blocks[event.id] = manager.malloc(event.size, event.alignment);
+            if (blocks[event.id] == nullptr)
+                ++failed;
+        }
+        else if (blocks[event.id] != nullptr)
+        {
+            manager.free(blocks[event.id], event.size);
+            blocks[event.id] = nullptr;
+        }
+
+        if ((period > 0) && (--countdown == 0))
+        {
+            checkpoint();
+            countdown = period;
+        }
+    }
+
+    checkpoint();
+
+    // Deallocate alive memory blocks
+    for (size_t id = 0; id < blocks.size(); ++id)
+        if (blocks[id] != nullptr)
+            manager.free(blocks[id], _sizes[id]);
+
+    return failed;
+}
+
+inline void swap(MemoryTrace& trace1, MemoryTrace& trace2) noexcept
+{
+    trace1.swap(trace2);
+}
+
+} // namespace CppCommon
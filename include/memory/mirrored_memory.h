@@ -0,0 +1,67 @@
+/*!
+    \file mirrored_memory.h
+    \brief Mirrored memory buffer definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_MIRRORED_MEMORY_H
+#define CPPCOMMON_MEMORY_MIRRORED_MEMORY_H
+
+#include "errors/exceptions.h"
+
+#include <cstddef>
+
+namespace CppCommon {
+
+//! Mirrored memory buffer
+/*!
+    Mirrored memory buffer maps the same physical pages twice into two
+    adjacent virtual memory regions. Any byte at the offset 'i' is also
+    available at the offset 'i + size', so ring buffers placed into the
+    mirrored memory buffer could access regions wrapped around the buffer
+    end as a single contiguous memory block.
+
+    Buffer size must be a multiple of the virtual memory granularity
+    (page size on Unix systems, allocation granularity on Windows).
+
+    Not thread-safe.
+*/
+class MirroredMemory
+{
+public:
+    //! Create a new mirrored memory buffer of the given size
+    /*!
+        \param size - Mirrored memory buffer size (must be a multiple of the virtual memory granularity)
+    */
+    explicit MirroredMemory(size_t size);
+    MirroredMemory(const MirroredMemory&) = delete;
+    MirroredMemory(MirroredMemory&&) = delete;
+    ~MirroredMemory();
+
+    MirroredMemory& operator=(const MirroredMemory&) = delete;
+    MirroredMemory& operator=(MirroredMemory&&) = delete;
+
+    //! Check if the mirrored memory buffer is valid
+    explicit operator bool() const noexcept { return (_ptr != nullptr); }
+
+    //! Get the mirrored memory buffer size (size of the mirror is not included)
+    size_t size() const noexcept { return _size; }
+
+    //! Get the mirrored memory buffer pointer
+    void* ptr() noexcept { return _ptr; }
+    //! Get the constant mirrored memory buffer pointer
+    const void* ptr() const noexcept { return _ptr; }
+
+    //! Get the virtual memory granularity
+    static size_t Granularity() noexcept;
+
+private:
+    void* _ptr;
+    size_t _size;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_MEMORY_MIRRORED_MEMORY_H
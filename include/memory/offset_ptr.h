@@ -0,0 +1,155 @@
+/*!
+    \file offset_ptr.h
+    \brief Offset (position-independent) pointer definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_OFFSET_PTR_H
+#define CPPCOMMON_MEMORY_OFFSET_PTR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Offset pointer
+/*!
+    Offset pointer stores the distance from its own address to the pointed
+    object instead of the absolute address. Therefore the offset pointer is
+    position-independent and stays valid when the memory region containing
+    both the pointer and the pointed object is mapped at different addresses
+    in different processes (e.g. shared memory or memory-mapped files).
+
+    Copying an offset pointer recalculates the offset for the new location.
+    Offset pointer implements random access iterator interface and could be
+    used as a fancy pointer type of the allocator for standard containers.
+
+    Not thread-safe.
+*/
+template <typename T>
+class OffsetPtr
+{
+    template <typename U>
+    friend class OffsetPtr;
+
+public:
+    //! Element type
+    typedef T element_type;
+    //! Value type
+    typedef std::remove_cv_t<T> value_type;
+    //! Pointer to element
+    typedef T* pointer;
+    //! Reference to element
+    typedef std::add_lvalue_reference_t<T> reference;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+    //! Iterator category
+    typedef std::random_access_iterator_tag iterator_category;
+
+    //! Rebind offset pointer
+    template <typename U>
+    using rebind = OffsetPtr<U>;
+
+    OffsetPtr() noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(std::nullptr_t) noexcept : _offset(NULL_OFFSET) {}
+    //! Initialize offset pointer with a given raw pointer
+    /*!
+        \param ptr - Raw pointer
+    */
+    OffsetPtr(T* ptr) noexcept { set(ptr); }
+    OffsetPtr(const OffsetPtr& ptr) noexcept { set(ptr.get()); }
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    OffsetPtr(const OffsetPtr<U>& ptr) noexcept { set(ptr.get()); }
+    ~OffsetPtr() noexcept = default;
+
+    OffsetPtr& operator=(std::nullptr_t) noexcept
+    { _offset = NULL_OFFSET; return *this; }
+    OffsetPtr& operator=(T* ptr) noexcept
+    { set(ptr); return *this; }
+    OffsetPtr& operator=(const OffsetPtr& ptr) noexcept
+    { set(ptr.get()); return *this; }
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    OffsetPtr& operator=(const OffsetPtr<U>& ptr) noexcept
+    { set(ptr.get()); return *this; }
+
+    //! Check if the offset pointer is not null
+    explicit operator bool() const noexcept { return (_offset != NULL_OFFSET); }
+
+    //! Dereference the offset pointer
+    reference operator*() const noexcept { return *get(); }
+    //! Dereference the offset pointer member
+    T* operator->() const noexcept { return get(); }
+    //! Access the element with the given index
+    reference operator[](difference_type index) const noexcept { return get()[index]; }
+
+    OffsetPtr& operator++() noexcept { _offset += (difference_type)sizeof(T); return *this; }
+    OffsetPtr operator++(int) noexcept { OffsetPtr result(*this); ++*this; return result; }
+    OffsetPtr& operator--() noexcept { _offset -= (difference_type)sizeof(T); return *this; }
+    OffsetPtr operator--(int) noexcept { OffsetPtr result(*this); --*this; return result; }
+
+    OffsetPtr& operator+=(difference_type offset) noexcept { _offset += offset * (difference_type)sizeof(T); return *this; }
+    OffsetPtr& operator-=(difference_type offset) noexcept { _offset -= offset * (difference_type)sizeof(T); return *this; }
+
+    friend OffsetPtr operator+(const OffsetPtr& ptr, difference_type offset) noexcept { return OffsetPtr(ptr.get() + offset); }
+    friend OffsetPtr operator+(difference_type offset, const OffsetPtr& ptr) noexcept { return OffsetPtr(ptr.get() + offset); }
+    friend OffsetPtr operator-(const OffsetPtr& ptr, difference_type offset) noexcept { return OffsetPtr(ptr.get() - offset); }
+    friend difference_type operator-(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() - ptr2.get(); }
+
+    template <typename U>
+    friend bool operator==(const OffsetPtr& ptr1, const OffsetPtr<U>& ptr2) noexcept { return ptr1.get() == ptr2.get(); }
+    template <typename U>
+    friend bool operator!=(const OffsetPtr& ptr1, const OffsetPtr<U>& ptr2) noexcept { return ptr1.get() != ptr2.get(); }
+    friend bool operator<(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() < ptr2.get(); }
+    friend bool operator>(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() > ptr2.get(); }
+    friend bool operator<=(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() <= ptr2.get(); }
+    friend bool operator>=(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() >= ptr2.get(); }
+    friend bool operator==(const OffsetPtr& ptr, std::nullptr_t) noexcept { return !ptr; }
+    friend bool operator!=(const OffsetPtr& ptr, std::nullptr_t) noexcept { return (bool)ptr; }
+
+    //! Get the raw pointer
+    T* get() const noexcept;
+
+    //! Get the offset pointer to the given reference (used by std::pointer_traits)
+    template <typename U = T, typename = std::enable_if_t<!std::is_void_v<U>>>
+    static OffsetPtr pointer_to(U& ref) noexcept { return OffsetPtr(std::addressof(ref)); }
+
+    //! Swap two instances
+    void swap(OffsetPtr& ptr) noexcept;
+    template <typename U>
+    friend void swap(OffsetPtr<U>& ptr1, OffsetPtr<U>& ptr2) noexcept;
+
+private:
+    // Offset value of the null pointer (offset pointer could never point to its second byte)
+    static const difference_type NULL_OFFSET = 1;
+
+    difference_type _offset;
+
+    void set(const volatile void* ptr) noexcept;
+};
+
+//! Static cast of the offset pointer
+template <typename T, typename U>
+OffsetPtr<T> static_pointer_cast(const OffsetPtr<U>& ptr) noexcept
+{ return OffsetPtr<T>(static_cast<T*>(ptr.get())); }
+
+//! Const cast of the offset pointer
+template <typename T, typename U>
+OffsetPtr<T> const_pointer_cast(const OffsetPtr<U>& ptr) noexcept
+{ return OffsetPtr<T>(const_cast<T*>(ptr.get())); }
+
+//! Reinterpret cast of the offset pointer
+template <typename T, typename U>
+OffsetPtr<T> reinterpret_pointer_cast(const OffsetPtr<U>& ptr) noexcept
+{ return OffsetPtr<T>(reinterpret_cast<T*>(ptr.get())); }
+
+} // namespace CppCommon
+
+#include "offset_ptr.inl"
+
+#endif // CPPCOMMON_MEMORY_OFFSET_PTR_H
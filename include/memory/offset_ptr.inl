@@ -0,0 +1,55 @@
+/*!
+    \file offset_ptr.inl
+    \brief Offset (position-independent) pointer inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <typename T>
+inline T* OffsetPtr<T>::get() const noexcept
+{
+    if (_offset == NULL_OFFSET)
+        return nullptr;
+
+    return (T*)((uintptr_t)this + (uintptr_t)_offset);
+}
+
+template <typename T>
+inline void OffsetPtr<T>::set(const volatile void* ptr) noexcept
+{
+    if (ptr == nullptr)
+        _offset = NULL_OFFSET;
+    else
+        _offset = (difference_type)((uintptr_t)ptr - (uintptr_t)this);
+}
+
+template <typename T>
+inline void OffsetPtr<T>::swap(OffsetPtr& ptr) noexcept
+{
+    T* temp = get();
+    set(ptr.get());
+    ptr.set(temp);
+}
+
+template <typename T>
+inline void swap(OffsetPtr<T>& ptr1, OffsetPtr<T>& ptr2) noexcept
+{
+    ptr1.swap(ptr2);
+}
+
+} // namespace CppCommon
+
+template <typename T>
+struct std::hash<CppCommon::OffsetPtr<T>>
+{
+    typedef CppCommon::OffsetPtr<T> argument_type;
+    typedef size_t result_type;
+
+    result_type operator() (const argument_type& value) const
+    {
+        return std::hash<T*>()(value.get());
+    }
+};
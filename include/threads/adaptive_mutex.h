@@ -0,0 +1,117 @@
+/*!
+    \file adaptive_mutex.h
+    \brief Adaptive mutex synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ADAPTIVE_MUTEX_H
+#define CPPCOMMON_THREADS_ADAPTIVE_MUTEX_H
+
+#include "threads/futex.h"
+#include "threads/locker.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Adaptive mutex synchronization primitive
+/*!
+    Adaptive mutex spins for a bounded number of CPU timestamp counter
+    cycles (see Timestamp::rdts()) waiting for the owner to release the
+    lock, and parks the waiting thread on the futex when the spin budget
+    is exhausted. Short critical sections are handed over without system
+    calls, while long ones do not burn CPU cores. Unlock issues the futex
+    wake-up system call only if some thread is parked.
+
+    The whole state is a single 32-bit word (unlocked, locked, locked with
+    parked waiters), so adaptive mutexes could be densely embedded into
+    data structures (e.g. one per hash bucket).
+
+    Adaptive mutex is not fair and not recursive.
+
+    Thread-safe.
+
+    https://www.akkadia.org/drepper/futex.pdf
+*/
+class AdaptiveMutex
+{
+public:
+    //! Spin budget in CPU timestamp counter cycles before parking the waiting thread
+    static const uint64_t SPIN_CYCLES = 4000;
+
+    AdaptiveMutex() noexcept : _state(UNLOCKED) {}
+    AdaptiveMutex(const AdaptiveMutex&) = delete;
+    AdaptiveMutex(AdaptiveMutex&&) = delete;
+    ~AdaptiveMutex() = default;
+
+    AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+    AdaptiveMutex& operator=(AdaptiveMutex&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the adaptive mutex is already locked, 'false' if the adaptive mutex is released
+    */
+    bool IsLocked() const noexcept { return (_state.load(std::memory_order_acquire) != UNLOCKED); }
+
+    //! Try to acquire adaptive mutex without block
+    /*!
+        Will not block.
+
+        \return 'true' if the adaptive mutex was successfully acquired, 'false' if the adaptive mutex is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire adaptive mutex for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the adaptive mutex
+        \return 'true' if the adaptive mutex was successfully acquired, 'false' if the adaptive mutex is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire adaptive mutex until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the adaptive mutex
+        \return 'true' if the adaptive mutex was successfully acquired, 'false' if the adaptive mutex is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire adaptive mutex with block
+    /*!
+        Will spin for a while and then block.
+    */
+    void Lock() noexcept;
+
+    //! Release adaptive mutex
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    enum : uint32_t { UNLOCKED = 0, LOCKED = 1, CONTENDED = 2 };
+
+    std::atomic<uint32_t> _state;
+
+    //! Spin while the adaptive mutex is locked within the spin budget
+    bool Spin() noexcept;
+    //! Slow path of the Lock() method
+    void LockSlow() noexcept;
+};
+
+/*! \example threads_adaptive_mutex.cpp Adaptive mutex synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "adaptive_mutex.inl"
+
+#endif // CPPCOMMON_THREADS_ADAPTIVE_MUTEX_H
@@ -0,0 +1,32 @@
+/*!
+    \file adaptive_mutex.inl
+    \brief Adaptive mutex synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+static_assert(sizeof(AdaptiveMutex) == sizeof(uint32_t), "Adaptive mutex must be word-sized!");
+
+inline bool AdaptiveMutex::TryLock() noexcept
+{
+    uint32_t expected = UNLOCKED;
+    return _state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void AdaptiveMutex::Lock() noexcept
+{
+    if (!TryLock())
+        LockSlow();
+}
+
+inline void AdaptiveMutex::Unlock() noexcept
+{
+    // Wake one parked thread only if there are any
+    if (_state.exchange(UNLOCKED, std::memory_order_release) == CONTENDED)
+        Futex::WakeOne(_state);
+}
+
+} // namespace CppCommon
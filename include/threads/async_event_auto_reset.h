@@ -0,0 +1,84 @@
+/*!
+    \file async_event_auto_reset.h
+    \brief Awaitable auto-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
+#define CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
+
+#include "threads/async_waiters.h"
+#include "threads/spin_lock.h"
+
+namespace CppCommon {
+
+//! Awaitable auto-reset event synchronization primitive
+/*!
+    Awaitable auto-reset event suspends awaiting coroutines until the event
+    is signaled. Signal() resumes one suspended coroutine on the signaling
+    thread or keeps the event signaled for the next waiter.
+
+    Thread-safe.
+*/
+class AsyncEventAutoReset
+{
+public:
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit AsyncEventAutoReset(bool signaled = false) noexcept : _signaled(signaled) {}
+    AsyncEventAutoReset(const AsyncEventAutoReset&) = delete;
+    AsyncEventAutoReset(AsyncEventAutoReset&&) = delete;
+    ~AsyncEventAutoReset() = default;
+
+    AsyncEventAutoReset& operator=(const AsyncEventAutoReset&) = delete;
+    AsyncEventAutoReset& operator=(AsyncEventAutoReset&&) = delete;
+
+    //! Signal the event and resume one of suspended coroutines
+    void Signal();
+
+    //! Try to wait the event without suspend
+    /*!
+        Will not suspend.
+
+        \return 'true' if the event was occurred before, 'false' if the event was not occurred before
+    */
+    bool TryWait();
+
+    //! Wait the event with suspend
+    /*!
+        Usage: co_await event.Wait();
+
+        \return Awaitable object
+    */
+    auto Wait() noexcept
+    {
+        struct WaitAwaiter : public AsyncWaiter
+        {
+            AsyncEventAutoReset& event;
+
+            explicit WaitAwaiter(AsyncEventAutoReset& e) noexcept : event(e) {}
+
+            bool await_ready() { return event.TryWait(); }
+            bool await_suspend(std::coroutine_handle<> awaiting) { handle = awaiting; return event.Suspend(this); }
+            void await_resume() const noexcept {}
+        };
+
+        return WaitAwaiter(*this);
+    }
+
+private:
+    SpinLock _lock;
+    bool _signaled;
+    AsyncWaiters _waiters;
+
+    //! Suspend the waiter until the event is signaled
+    bool Suspend(AsyncWaiter* waiter);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_EVENT_AUTO_RESET_H
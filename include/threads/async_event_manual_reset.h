@@ -0,0 +1,87 @@
+/*!
+    \file async_event_manual_reset.h
+    \brief Awaitable manual-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_EVENT_MANUAL_RESET_H
+#define CPPCOMMON_THREADS_ASYNC_EVENT_MANUAL_RESET_H
+
+#include "threads/async_waiters.h"
+#include "threads/spin_lock.h"
+
+namespace CppCommon {
+
+//! Awaitable manual-reset event synchronization primitive
+/*!
+    Awaitable manual-reset event suspends awaiting coroutines until the event
+    is signaled. Signal() resumes all suspended coroutines on the signaling
+    thread and the event stays signaled until it is reset.
+
+    Thread-safe.
+*/
+class AsyncEventManualReset
+{
+public:
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit AsyncEventManualReset(bool signaled = false) noexcept : _signaled(signaled) {}
+    AsyncEventManualReset(const AsyncEventManualReset&) = delete;
+    AsyncEventManualReset(AsyncEventManualReset&&) = delete;
+    ~AsyncEventManualReset() = default;
+
+    AsyncEventManualReset& operator=(const AsyncEventManualReset&) = delete;
+    AsyncEventManualReset& operator=(AsyncEventManualReset&&) = delete;
+
+    //! Reset the event
+    void Reset();
+
+    //! Signal the event and resume all suspended coroutines
+    void Signal();
+
+    //! Try to wait the event without suspend
+    /*!
+        Will not suspend.
+
+        \return 'true' if the event was occurred before, 'false' if the event was not occurred before
+    */
+    bool TryWait();
+
+    //! Wait the event with suspend
+    /*!
+        Usage: co_await event.Wait();
+
+        \return Awaitable object
+    */
+    auto Wait() noexcept
+    {
+        struct WaitAwaiter : public AsyncWaiter
+        {
+            AsyncEventManualReset& event;
+
+            explicit WaitAwaiter(AsyncEventManualReset& e) noexcept : event(e) {}
+
+            bool await_ready() { return event.TryWait(); }
+            bool await_suspend(std::coroutine_handle<> awaiting) { handle = awaiting; return event.Suspend(this); }
+            void await_resume() const noexcept {}
+        };
+
+        return WaitAwaiter(*this);
+    }
+
+private:
+    mutable SpinLock _lock;
+    bool _signaled;
+    AsyncWaiters _waiters;
+
+    //! Suspend the waiter until the event is signaled
+    bool Suspend(AsyncWaiter* waiter);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_EVENT_MANUAL_RESET_H
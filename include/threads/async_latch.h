@@ -0,0 +1,100 @@
+/*!
+    \file async_latch.h
+    \brief Awaitable latch synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_LATCH_H
+#define CPPCOMMON_THREADS_ASYNC_LATCH_H
+
+#include "threads/async_waiters.h"
+#include "threads/spin_lock.h"
+
+namespace CppCommon {
+
+//! Awaitable latch synchronization primitive
+/*!
+    Awaitable latch suspends awaiting coroutines until the latch counter
+    reaches zero. The last CountDown() resumes all suspended coroutines on
+    the counting down thread.
+
+    Thread-safe.
+*/
+class AsyncLatch
+{
+public:
+    //! Default class constructor
+    /*!
+        \param counter - Latch counter initial value
+    */
+    explicit AsyncLatch(int counter) noexcept : _counter(counter) {}
+    AsyncLatch(const AsyncLatch&) = delete;
+    AsyncLatch(AsyncLatch&&) = delete;
+    ~AsyncLatch() = default;
+
+    AsyncLatch& operator=(const AsyncLatch&) = delete;
+    AsyncLatch& operator=(AsyncLatch&&) = delete;
+
+    //! Get the latch counter
+    int counter() const noexcept;
+
+    //! Reset the latch with a new counter value
+    /*!
+        This method may only be invoked when there are no suspended coroutines.
+
+        \param counter - Latch counter value
+    */
+    void Reset(int counter);
+
+    //! Countdown the latch
+    /*!
+        If the latch counter reaches 0, all suspended coroutines will be resumed.
+
+        \param count - Countdown value (default is 1)
+    */
+    void CountDown(int count = 1);
+
+    //! Try to wait for the latch without suspend
+    /*!
+        Will not suspend.
+
+        \return 'true' if the latch counter is zero, 'false' if the latch counter is not zero
+    */
+    bool TryWait();
+
+    //! Wait for the latch with suspend
+    /*!
+        Usage: co_await latch.Wait();
+
+        \return Awaitable object
+    */
+    auto Wait() noexcept
+    {
+        struct WaitAwaiter : public AsyncWaiter
+        {
+            AsyncLatch& latch;
+
+            explicit WaitAwaiter(AsyncLatch& l) noexcept : latch(l) {}
+
+            bool await_ready() { return latch.TryWait(); }
+            bool await_suspend(std::coroutine_handle<> awaiting) { handle = awaiting; return latch.Suspend(this); }
+            void await_resume() const noexcept {}
+        };
+
+        return WaitAwaiter(*this);
+    }
+
+private:
+    mutable SpinLock _lock;
+    int _counter;
+    AsyncWaiters _waiters;
+
+    //! Suspend the waiter until the latch counter reaches zero
+    bool Suspend(AsyncWaiter* waiter);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_LATCH_H
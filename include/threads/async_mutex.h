@@ -0,0 +1,83 @@
+/*!
+    \file async_mutex.h
+    \brief Awaitable mutex synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_MUTEX_H
+#define CPPCOMMON_THREADS_ASYNC_MUTEX_H
+
+#include "threads/async_waiters.h"
+#include "threads/spin_lock.h"
+
+namespace CppCommon {
+
+//! Awaitable mutex synchronization primitive
+/*!
+    Awaitable mutex suspends the awaiting coroutine instead of blocking the
+    thread. Unlock() hands the ownership over to the first suspended coroutine
+    and resumes it on the unlocking thread.
+
+    Thread-safe.
+*/
+class AsyncMutex
+{
+public:
+    AsyncMutex() noexcept : _locked(false) {}
+    AsyncMutex(const AsyncMutex&) = delete;
+    AsyncMutex(AsyncMutex&&) = delete;
+    ~AsyncMutex() = default;
+
+    AsyncMutex& operator=(const AsyncMutex&) = delete;
+    AsyncMutex& operator=(AsyncMutex&&) = delete;
+
+    //! Try to acquire mutex without suspend
+    /*!
+        Will not suspend.
+
+        \return 'true' if the mutex was successfully acquired, 'false' if the mutex is busy
+    */
+    bool TryLock();
+
+    //! Acquire mutex with suspend
+    /*!
+        Usage: co_await mutex.Lock();
+
+        \return Awaitable object
+    */
+    auto Lock() noexcept
+    {
+        struct LockAwaiter : public AsyncWaiter
+        {
+            AsyncMutex& mutex;
+
+            explicit LockAwaiter(AsyncMutex& m) noexcept : mutex(m) {}
+
+            bool await_ready() { return mutex.TryLock(); }
+            bool await_suspend(std::coroutine_handle<> awaiting) { handle = awaiting; return mutex.Suspend(this); }
+            void await_resume() const noexcept {}
+        };
+
+        return LockAwaiter(*this);
+    }
+
+    //! Release mutex
+    /*!
+        Will resume the next suspended coroutine (if any).
+    */
+    void Unlock();
+
+private:
+    SpinLock _lock;
+    bool _locked;
+    AsyncWaiters _waiters;
+
+    //! Suspend the waiter until the mutex is acquired
+    bool Suspend(AsyncWaiter* waiter);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_MUTEX_H
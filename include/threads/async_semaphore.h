@@ -0,0 +1,91 @@
+/*!
+    \file async_semaphore.h
+    \brief Awaitable semaphore synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_SEMAPHORE_H
+#define CPPCOMMON_THREADS_ASYNC_SEMAPHORE_H
+
+#include "threads/async_waiters.h"
+#include "threads/spin_lock.h"
+
+namespace CppCommon {
+
+//! Awaitable semaphore synchronization primitive
+/*!
+    Awaitable semaphore suspends the awaiting coroutine instead of blocking
+    the thread when there are no available resources. Unlock() hands the
+    released resource over to the first suspended coroutine and resumes it
+    on the unlocking thread.
+
+    Thread-safe.
+*/
+class AsyncSemaphore
+{
+public:
+    //! Default class constructor
+    /*!
+        \param resources - Semaphore resources counter
+    */
+    explicit AsyncSemaphore(int resources);
+    AsyncSemaphore(const AsyncSemaphore&) = delete;
+    AsyncSemaphore(AsyncSemaphore&&) = delete;
+    ~AsyncSemaphore() = default;
+
+    AsyncSemaphore& operator=(const AsyncSemaphore&) = delete;
+    AsyncSemaphore& operator=(AsyncSemaphore&&) = delete;
+
+    //! Get the count of available semaphore resources
+    int resources() const noexcept;
+
+    //! Try to acquire semaphore without suspend
+    /*!
+        Will not suspend.
+
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLock();
+
+    //! Acquire semaphore with suspend
+    /*!
+        Usage: co_await semaphore.Lock();
+
+        \return Awaitable object
+    */
+    auto Lock() noexcept
+    {
+        struct LockAwaiter : public AsyncWaiter
+        {
+            AsyncSemaphore& semaphore;
+
+            explicit LockAwaiter(AsyncSemaphore& s) noexcept : semaphore(s) {}
+
+            bool await_ready() { return semaphore.TryLock(); }
+            bool await_suspend(std::coroutine_handle<> awaiting) { handle = awaiting; return semaphore.Suspend(this); }
+            void await_resume() const noexcept {}
+        };
+
+        return LockAwaiter(*this);
+    }
+
+    //! Release semaphore
+    /*!
+        Will resume the next suspended coroutine (if any).
+    */
+    void Unlock();
+
+private:
+    mutable SpinLock _lock;
+    int _resources;
+    AsyncWaiters _waiters;
+
+    //! Suspend the waiter until the semaphore is acquired
+    bool Suspend(AsyncWaiter* waiter);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_SEMAPHORE_H
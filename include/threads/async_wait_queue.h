@@ -0,0 +1,147 @@
+/*!
+    \file async_wait_queue.h
+    \brief Awaitable multiple producers / multiple consumers wait queue definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_WAIT_QUEUE_H
+#define CPPCOMMON_THREADS_ASYNC_WAIT_QUEUE_H
+
+#include "threads/async_waiters.h"
+#include "threads/spin_lock.h"
+
+#include <queue>
+#include <utility>
+
+namespace CppCommon {
+
+//! Awaitable multiple producers / multiple consumers wait queue
+/*!
+    Awaitable wait queue suspends consumer coroutines while the queue is
+    empty and producer coroutines while the queue is full. Items are handed
+    over directly to suspended consumers, which are resumed on the producing
+    thread.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+*/
+template<typename T>
+class AsyncWaitQueue
+{
+    struct ItemWaiter;
+
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Wait queue capacity (default is 0 for unlimited capacity)
+    */
+    explicit AsyncWaitQueue(size_t capacity = 0) : _closed(false), _capacity(capacity) {}
+    AsyncWaitQueue(const AsyncWaitQueue&) = delete;
+    AsyncWaitQueue(AsyncWaitQueue&&) = delete;
+    ~AsyncWaitQueue() { Close(); }
+
+    AsyncWaitQueue& operator=(const AsyncWaitQueue&) = delete;
+    AsyncWaitQueue& operator=(AsyncWaitQueue&&) = delete;
+
+    //! Check if the wait queue is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is wait queue closed?
+    bool closed() const;
+
+    //! Is wait queue empty?
+    bool empty() const { return (size() == 0); }
+    //! Get wait queue capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get wait queue size
+    size_t size() const;
+
+    //! Enqueue an item into the wait queue
+    /*!
+        The item will be moved into the wait queue.
+
+        Usage: bool result = co_await queue.Enqueue(item);
+
+        Will suspend if the wait queue is full.
+
+        \param item - Item to enqueue
+        \return Awaitable object which returns 'true' if the item was successfully enqueue, 'false' if the wait queue is closed
+    */
+    auto Enqueue(T item) noexcept
+    {
+        struct EnqueueAwaiter : public ItemWaiter
+        {
+            AsyncWaitQueue& queue;
+            T value;
+
+            EnqueueAwaiter(AsyncWaitQueue& q, T&& v) noexcept : queue(q), value(std::move(v)) { this->item = &value; }
+
+            bool await_ready() { return false; }
+            bool await_suspend(std::coroutine_handle<> awaiting) { this->handle = awaiting; return queue.SuspendEnqueue(this); }
+            bool await_resume() const noexcept { return this->result; }
+        };
+
+        return EnqueueAwaiter(*this, std::move(item));
+    }
+
+    //! Dequeue an item from the wait queue
+    /*!
+        The item will be moved from the wait queue.
+
+        Usage: bool result = co_await queue.Dequeue(item);
+
+        Will suspend if the wait queue is empty.
+
+        \param item - Item to dequeue
+        \return Awaitable object which returns 'true' if the item was successfully dequeue, 'false' if the wait queue is closed and empty
+    */
+    auto Dequeue(T& item) noexcept
+    {
+        struct DequeueAwaiter : public ItemWaiter
+        {
+            AsyncWaitQueue& queue;
+
+            DequeueAwaiter(AsyncWaitQueue& q, T& v) noexcept : queue(q) { this->item = &v; }
+
+            bool await_ready() { return false; }
+            bool await_suspend(std::coroutine_handle<> awaiting) { this->handle = awaiting; return queue.SuspendDequeue(this); }
+            bool await_resume() const noexcept { return this->result; }
+        };
+
+        return DequeueAwaiter(*this, item);
+    }
+
+    //! Close the wait queue
+    /*!
+        Will resume all suspended producers and consumers.
+    */
+    void Close();
+
+private:
+    struct ItemWaiter : public AsyncWaiter
+    {
+        T* item{nullptr};
+        bool result{false};
+    };
+
+    mutable SpinLock _lock;
+    bool _closed;
+    const size_t _capacity;
+    std::queue<T> _queue;
+    AsyncWaiters _producers;
+    AsyncWaiters _consumers;
+
+    //! Enqueue the item of the waiter or suspend it
+    bool SuspendEnqueue(ItemWaiter* waiter);
+    //! Dequeue the item into the waiter or suspend it
+    bool SuspendDequeue(ItemWaiter* waiter);
+};
+
+} // namespace CppCommon
+
+#include "async_wait_queue.inl"
+
+#endif // CPPCOMMON_THREADS_ASYNC_WAIT_QUEUE_H
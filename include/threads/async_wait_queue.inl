@@ -0,0 +1,121 @@
+/*!
+    \file async_wait_queue.inl
+    \brief Awaitable multiple producers / multiple consumers wait queue inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline bool AsyncWaitQueue<T>::closed() const
+{
+    Locker<SpinLock> locker(_lock);
+    return _closed;
+}
+
+template<typename T>
+inline size_t AsyncWaitQueue<T>::size() const
+{
+    Locker<SpinLock> locker(_lock);
+    return _queue.size();
+}
+
+template<typename T>
+inline bool AsyncWaitQueue<T>::SuspendEnqueue(ItemWaiter* waiter)
+{
+    ItemWaiter* consumer = nullptr;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        if (_closed)
+        {
+            waiter->result = false;
+            return false;
+        }
+
+        // Hand the item over to the suspended consumer
+        consumer = static_cast<ItemWaiter*>(_consumers.Pop());
+        if (consumer != nullptr)
+        {
+            *consumer->item = std::move(*waiter->item);
+            consumer->result = true;
+        }
+        else if ((_capacity == 0) || (_queue.size() < _capacity))
+            _queue.push(std::move(*waiter->item));
+        else
+        {
+            // Suspend the producer until there is a free space in the wait queue
+            _producers.Push(waiter);
+            return true;
+        }
+    }
+
+    waiter->result = true;
+    if (consumer != nullptr)
+        consumer->handle.resume();
+    return false;
+}
+
+template<typename T>
+inline bool AsyncWaitQueue<T>::SuspendDequeue(ItemWaiter* waiter)
+{
+    ItemWaiter* producer = nullptr;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        if (!_queue.empty())
+        {
+            *waiter->item = std::move(_queue.front());
+            _queue.pop();
+
+            // Move the item of the suspended producer into the free space
+            producer = static_cast<ItemWaiter*>(_producers.Pop());
+            if (producer != nullptr)
+            {
+                _queue.push(std::move(*producer->item));
+                producer->result = true;
+            }
+        }
+        else if (_closed)
+        {
+            waiter->result = false;
+            return false;
+        }
+        else
+        {
+            // Suspend the consumer until the item is handed over
+            _consumers.Push(waiter);
+            return true;
+        }
+    }
+
+    waiter->result = true;
+    if (producer != nullptr)
+        producer->handle.resume();
+    return false;
+}
+
+template<typename T>
+inline void AsyncWaitQueue<T>::Close()
+{
+    AsyncWaiter* producers;
+    AsyncWaiter* consumers;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        if (_closed)
+            return;
+
+        _closed = true;
+        producers = _producers.PopAll();
+        consumers = _consumers.PopAll();
+    }
+
+    // Suspended waiters are resumed with 'false' result
+    AsyncWaiters::ResumeAll(producers);
+    AsyncWaiters::ResumeAll(consumers);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,105 @@
+/*!
+    \file async_waiters.h
+    \brief Coroutine waiters list definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_WAITERS_H
+#define CPPCOMMON_THREADS_ASYNC_WAITERS_H
+
+#include <coroutine>
+
+namespace CppCommon {
+
+//! Coroutine waiter
+/*!
+    Waiter is a part of the awaiter object which lives in the frame of the
+    suspended coroutine, so suspending does not allocate memory.
+*/
+struct AsyncWaiter
+{
+    std::coroutine_handle<> handle;
+    AsyncWaiter* next{nullptr};
+};
+
+//! Coroutine waiters list
+/*!
+    Intrusive FIFO list of suspended coroutines used by awaitable
+    synchronization primitives.
+
+    Not thread-safe.
+*/
+class AsyncWaiters
+{
+public:
+    AsyncWaiters() noexcept = default;
+    AsyncWaiters(const AsyncWaiters&) = delete;
+    AsyncWaiters(AsyncWaiters&&) = delete;
+    ~AsyncWaiters() = default;
+
+    AsyncWaiters& operator=(const AsyncWaiters&) = delete;
+    AsyncWaiters& operator=(AsyncWaiters&&) = delete;
+
+    //! Is the waiters list empty?
+    bool empty() const noexcept { return (_head == nullptr); }
+
+    //! Push the waiter to the tail of the list
+    void Push(AsyncWaiter* waiter) noexcept
+    {
+        waiter->next = nullptr;
+        if (_tail != nullptr)
+            _tail->next = waiter;
+        else
+            _head = waiter;
+        _tail = waiter;
+    }
+
+    //! Pop the waiter from the head of the list
+    /*!
+        \return The first waiter or nullptr if the list is empty
+    */
+    AsyncWaiter* Pop() noexcept
+    {
+        AsyncWaiter* waiter = _head;
+        if (waiter != nullptr)
+        {
+            _head = waiter->next;
+            if (_head == nullptr)
+                _tail = nullptr;
+        }
+        return waiter;
+    }
+
+    //! Pop all waiters from the list
+    /*!
+        \return The first waiter of the linked list or nullptr if the list is empty
+    */
+    AsyncWaiter* PopAll() noexcept
+    {
+        AsyncWaiter* waiters = _head;
+        _head = _tail = nullptr;
+        return waiters;
+    }
+
+    //! Resume all waiters of the linked list returned by PopAll()
+    static void ResumeAll(AsyncWaiter* waiters)
+    {
+        while (waiters != nullptr)
+        {
+            // Waiter is destroyed when its coroutine is resumed
+            AsyncWaiter* next = waiters->next;
+            waiters->handle.resume();
+            waiters = next;
+        }
+    }
+
+private:
+    AsyncWaiter* _head{nullptr};
+    AsyncWaiter* _tail{nullptr};
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_WAITERS_H
@@ -0,0 +1,163 @@
+/*!
+    \file blocking_ring_queue.h
+    \brief Blocking ring queue adapter definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_BLOCKING_RING_QUEUE_H
+#define CPPCOMMON_THREADS_BLOCKING_RING_QUEUE_H
+
+#include "threads/event_count.h"
+#include "threads/mpmc_ring_queue.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace CppCommon {
+
+//! Blocking ring queue adapter
+/*!
+    Blocking ring queue adapter turns a wait-free ring queue (MPMCRingQueue or
+    SPSCRingQueue) into a blocking producer-consumer queue. Enqueue and dequeue
+    operations spin on the underlying ring queue for a short while and then
+    park the current thread on an event count (see EventCount) until the ring
+    queue changes its state.
+
+    Event count publishes the number of parked threads, so a wake-up system
+    call is issued only when someone is really waiting. Uncontended
+    enqueue and dequeue operations never enter the kernel.
+
+    Threading restrictions of the underlying ring queue are preserved (e.g.
+    SPSCRingQueue based adapter allows only one producer and one consumer).
+
+    Items enqueued concurrently with Close() call might be left in the queue,
+    so producers should be stopped before the queue is closed.
+
+    FIFO order is guaranteed!
+*/
+template<typename T, class TRingQueue = MPMCRingQueue<T>>
+class BlockingRingQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Ring queue capacity (must be a power of two)
+        \param spin - Spin attempts before the thread is parked (default is 128)
+    */
+    explicit BlockingRingQueue(size_t capacity, size_t spin = 128);
+    BlockingRingQueue(const BlockingRingQueue&) = delete;
+    BlockingRingQueue(BlockingRingQueue&&) = delete;
+    ~BlockingRingQueue() { Close(); }
+
+    BlockingRingQueue& operator=(const BlockingRingQueue&) = delete;
+    BlockingRingQueue& operator=(BlockingRingQueue&&) = delete;
+
+    //! Check if the blocking ring queue is not empty
+    explicit operator bool() const noexcept { return !closed() && !empty(); }
+
+    //! Is blocking ring queue closed?
+    bool closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+    //! Is blocking ring queue empty?
+    bool empty() const noexcept { return _queue.empty(); }
+    //! Get blocking ring queue capacity
+    size_t capacity() const noexcept { return _queue.capacity(); }
+    //! Get blocking ring queue size
+    size_t size() const noexcept { return _queue.size(); }
+
+    //! Try to enqueue an item into the blocking ring queue
+    /*!
+        The item will be copied into the blocking ring queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the blocking ring queue is full or closed
+    */
+    bool TryEnqueue(const T& item);
+    //! Try to enqueue an item into the blocking ring queue
+    /*!
+        The item will be moved into the blocking ring queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the blocking ring queue is full or closed
+    */
+    bool TryEnqueue(T&& item);
+
+    //! Enqueue an item into the blocking ring queue
+    /*!
+        The item will be copied into the blocking ring queue.
+
+        Will block while the blocking ring queue is full.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the blocking ring queue is closed
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the blocking ring queue
+    /*!
+        The item will be moved into the blocking ring queue.
+
+        Will block while the blocking ring queue is full.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the blocking ring queue is closed
+    */
+    bool Enqueue(T&& item);
+
+    //! Try to dequeue an item from the blocking ring queue
+    /*!
+        The item will be moved from the blocking ring queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the blocking ring queue is empty
+    */
+    bool TryDequeue(T& item);
+
+    //! Dequeue an item from the blocking ring queue
+    /*!
+        The item will be moved from the blocking ring queue. Items left in the closed
+        blocking ring queue are still available for dequeue.
+
+        Will block while the blocking ring queue is empty.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the blocking ring queue is closed and empty
+    */
+    bool Dequeue(T& item);
+
+    //! Close the blocking ring queue
+    /*!
+        All parked producers and consumers will be woken up.
+
+        Will not block.
+    */
+    void Close();
+
+private:
+    TRingQueue _queue;
+    const size_t _spin;
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> _closed;
+    alignas(CACHE_LINE_SIZE) EventCount _not_empty;
+    alignas(CACHE_LINE_SIZE) EventCount _not_full;
+
+    //! Retry the given operation until it succeeds, parking the current thread on the given event count
+    template <class TOperation>
+    bool Park(EventCount& event, TOperation operation, bool drain);
+};
+
+/*! \example threads_blocking_ring_queue.cpp Blocking ring queue adapter example */
+
+} // namespace CppCommon
+
+#include "blocking_ring_queue.inl"
+
+#endif // CPPCOMMON_THREADS_BLOCKING_RING_QUEUE_H
@@ -0,0 +1,97 @@
+/*!
+    \file blocking_ring_queue.inl
+    \brief Blocking ring queue adapter inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T, class TRingQueue>
+inline BlockingRingQueue<T, TRingQueue>::BlockingRingQueue(size_t capacity, size_t spin) : _queue(capacity), _spin(spin), _closed(false)
+{
+}
+
+template<typename T, class TRingQueue>
+inline bool BlockingRingQueue<T, TRingQueue>::TryEnqueue(const T& item)
+{
+    T temp = item;
+    return TryEnqueue(std::forward<T>(temp));
+}
+
+template<typename T, class TRingQueue>
+inline bool BlockingRingQueue<T, TRingQueue>::TryEnqueue(T&& item)
+{
+    if (closed())
+        return false;
+
+    if (!_queue.Enqueue(std::forward<T>(item)))
+        return false;
+
+    _not_empty.NotifyOne();
+    return true;
+}
+
+template<typename T, class TRingQueue>
+inline bool BlockingRingQueue<T, TRingQueue>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
+
+template<typename T, class TRingQueue>
+inline bool BlockingRingQueue<T, TRingQueue>::Enqueue(T&& item)
+{
+    if (closed())
+        return false;
+
+    // Ring queue moves the item only when it was successfully enqueued
+    if (!Park(_not_full, [this, &item]() { return _queue.Enqueue(std::forward<T>(item)); }, false))
+        return false;
+
+    _not_empty.NotifyOne();
+    return true;
+}
+
+template<typename T, class TRingQueue>
+inline bool BlockingRingQueue<T, TRingQueue>::TryDequeue(T& item)
+{
+    if (!_queue.Dequeue(item))
+        return false;
+
+    _not_full.NotifyOne();
+    return true;
+}
+
+template<typename T, class TRingQueue>
+inline bool BlockingRingQueue<T, TRingQueue>::Dequeue(T& item)
+{
+    if (!Park(_not_empty, [this, &item]() { return _queue.Dequeue(item); }, true))
+        return false;
+
+    _not_full.NotifyOne();
+    return true;
+}
+
+template<typename T, class TRingQueue>
+inline void BlockingRingQueue<T, TRingQueue>::Close()
+{
+    if (_closed.exchange(true, std::memory_order_seq_cst))
+        return;
+
+    // Wake all parked producers and consumers
+    _not_empty.NotifyAll();
+    _not_full.NotifyAll();
+}
+
+template<typename T, class TRingQueue>
+template <class TOperation>
+inline bool BlockingRingQueue<T, TRingQueue>::Park(EventCount& event, TOperation operation, bool drain)
+{
+    bool done = false;
+    event.Wait([this, &operation, &done]() { done = operation(); return done || closed(); }, _spin);
+    return done || (drain && operation());
+}
+
+} // namespace CppCommon
@@ -0,0 +1,93 @@
+/*!
+    \file clh_lock.h
+    \brief CLH queue lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_CLH_LOCK_H
+#define CPPCOMMON_THREADS_CLH_LOCK_H
+
+#include "threads/locker.h"
+#include "threads/queue_lock_node.h"
+#include "threads/spin_wait.h"
+
+namespace CppCommon {
+
+//! CLH queue lock synchronization primitive
+/*!
+    CLH lock is a fair and scalable spin lock. Waiting threads form an
+    implicit queue: each of them swaps its node into the tail and spins on
+    the flag of the predecessor node, which is cleared on unlock. Unlike
+    MCSLock unlocking never waits for the successor, and the lock owner
+    takes the node of its predecessor for reuse. Threads acquire the lock
+    in FIFO order.
+
+    Queue nodes are taken from the per-thread node cache, so the CLH lock
+    has the usual Lock()/Unlock() interface and works with Locker<>.
+
+    CLH lock must be unlocked by the thread which locked it.
+
+    Thread-safe.
+
+    https://www.cs.rochester.edu/research/synchronization/pseudocode/ss.html#clh
+*/
+class CLHLock
+{
+public:
+    CLHLock();
+    CLHLock(const CLHLock&) = delete;
+    CLHLock(CLHLock&&) = delete;
+    ~CLHLock();
+
+    CLHLock& operator=(const CLHLock&) = delete;
+    CLHLock& operator=(CLHLock&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the CLH lock is already locked, 'false' if the CLH lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire CLH lock without block
+    /*!
+        Might spin for a single critical section in the rare case when the
+        released tail node is concurrently reused by another locking thread.
+
+        \return 'true' if the CLH lock was successfully acquired, 'false' if the CLH lock is busy
+    */
+    bool TryLock();
+
+    //! Acquire CLH lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock();
+
+    //! Release CLH lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    typedef Internals::QueueLockNode Node;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<Node*> _tail;
+    Node* _owner;
+    Node* _predecessor;
+
+    //! Wait for the predecessor node to be released
+    void Wait(Node* node, Node* predecessor) noexcept;
+};
+
+/*! \example threads_clh_lock.cpp CLH queue lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "clh_lock.inl"
+
+#endif // CPPCOMMON_THREADS_CLH_LOCK_H
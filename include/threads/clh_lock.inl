@@ -0,0 +1,81 @@
+/*!
+    \file clh_lock.inl
+    \brief CLH queue lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline CLHLock::CLHLock() : _owner(nullptr), _predecessor(nullptr)
+{
+    // Initial tail node of the released lock
+    Node* node = Node::Acquire();
+    node->locked.store(false, std::memory_order_relaxed);
+    _tail.store(node, std::memory_order_relaxed);
+}
+
+inline CLHLock::~CLHLock()
+{
+    Node::Release(_tail.load(std::memory_order_relaxed));
+}
+
+inline bool CLHLock::IsLocked() noexcept
+{
+    return _tail.load(std::memory_order_acquire)->locked.load(std::memory_order_acquire);
+}
+
+inline bool CLHLock::TryLock()
+{
+    Node* predecessor = _tail.load(std::memory_order_acquire);
+    if (predecessor->locked.load(std::memory_order_acquire))
+        return false;
+
+    Node* node = Node::Acquire();
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node only behind the released tail node
+    if (!_tail.compare_exchange_strong(predecessor, node, std::memory_order_acq_rel, std::memory_order_relaxed))
+    {
+        Node::Release(node);
+        return false;
+    }
+
+    Wait(node, predecessor);
+    return true;
+}
+
+inline void CLHLock::Lock()
+{
+    Node* node = Node::Acquire();
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node and spin on the predecessor node
+    Node* predecessor = _tail.exchange(node, std::memory_order_acq_rel);
+    Wait(node, predecessor);
+}
+
+inline void CLHLock::Unlock() noexcept
+{
+    // Read the owner nodes before the lock is handed over
+    Node* node = _owner;
+    Node* predecessor = _predecessor;
+
+    node->locked.store(false, std::memory_order_release);
+
+    // Nobody references the predecessor node anymore
+    Node::Release(predecessor);
+}
+
+inline void CLHLock::Wait(Node* node, Node* predecessor) noexcept
+{
+    SpinWait spin;
+    while (predecessor->locked.load(std::memory_order_acquire))
+        spin.Spin();
+
+    _owner = node;
+    _predecessor = predecessor;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,217 @@
+/*!
+    \file disruptor.h
+    \brief Disruptor ring buffer with sequencer and consumer graph definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_DISRUPTOR_H
+#define CPPCOMMON_THREADS_DISRUPTOR_H
+
+#include "threads/wait_strategy.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Disruptor ring buffer with sequencer and consumer graph
+/*!
+    Disruptor is a pre-allocated ring of items shared by producers and a graph
+    of consumers. Producers claim sequences in the ring, fill items in place
+    and publish them. Each consumer tracks its own sequence and reads items
+    in place, waiting for the producers and for the consumers it depends on
+    (sequence barrier). Producers never overwrite an item until all consumers
+    have processed it.
+
+    Consumers are processed in batches: a consumer takes all items available
+    at the moment of the call and advances its sequence once per batch.
+
+    Consumer graph must be built before the producers start publishing items.
+    Sequences start from 0, the sequence of the item is its index in the
+    publication order.
+
+    Wait strategy (BusySpinWaitStrategy, YieldingWaitStrategy or
+    BlockingWaitStrategy) defines how producers and consumers wait for
+    each other.
+
+    FIFO order is guaranteed for every consumer!
+
+    Thread-safe (single producer mode allows only one producer thread,
+    every consumer must be used by only one thread).
+
+    https://lmax-exchange.github.io/disruptor/disruptor.html
+*/
+template<typename T, class TWaitStrategy = BlockingWaitStrategy>
+class Disruptor
+{
+public:
+    //! Disruptor consumer
+    class Consumer
+    {
+        friend class Disruptor;
+
+    public:
+        Consumer(const Consumer&) = delete;
+        Consumer(Consumer&&) = delete;
+        ~Consumer() = default;
+
+        Consumer& operator=(const Consumer&) = delete;
+        Consumer& operator=(Consumer&&) = delete;
+
+        //! Get the last processed sequence (-1 if nothing was processed)
+        int64_t sequence() const noexcept { return _sequence.load(std::memory_order_acquire); }
+
+        //! Consume a batch of available items
+        /*!
+            Handler will be called for each item in the batch with the following
+            arguments: item reference, item sequence and end of batch flag.
+
+            Will block while there are no available items.
+
+            \param handler - Item handler
+            \return Count of consumed items (0 if the disruptor is closed and all published items were consumed)
+        */
+        template <class THandler>
+        size_t Consume(THandler handler);
+        //! Try to consume a batch of available items
+        /*!
+            Handler will be called for each item in the batch with the following
+            arguments: item reference, item sequence and end of batch flag.
+
+            Will not block.
+
+            \param handler - Item handler
+            \return Count of consumed items (0 if there are no available items)
+        */
+        template <class THandler>
+        size_t TryConsume(THandler handler);
+
+    private:
+        Disruptor& _disruptor;
+        std::vector<const Consumer*> _dependencies;
+        alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _sequence;
+
+        Consumer(Disruptor& disruptor, std::initializer_list<const Consumer*> dependencies);
+
+        //! Get the last sequence available for the consumer
+        int64_t Available(int64_t next) const noexcept;
+        //! Process the given range of sequences
+        template <class THandler>
+        size_t Process(int64_t next, int64_t available, THandler& handler);
+    };
+
+    //! Default class constructor
+    /*!
+        \param capacity - Ring capacity (must be a power of two)
+        \param multiple_producers - Multiple producers mode flag (default is false)
+    */
+    explicit Disruptor(size_t capacity, bool multiple_producers = false);
+    Disruptor(const Disruptor&) = delete;
+    Disruptor(Disruptor&&) = delete;
+    ~Disruptor() = default;
+
+    Disruptor& operator=(const Disruptor&) = delete;
+    Disruptor& operator=(Disruptor&&) = delete;
+
+    //! Is disruptor closed?
+    bool closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+    //! Get ring capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Is disruptor in multiple producers mode?
+    bool multiple_producers() const noexcept { return _multiple_producers; }
+    //! Get the last claimed sequence (-1 if nothing was claimed)
+    int64_t cursor() const noexcept { return _claim.load(std::memory_order_acquire); }
+
+    //! Access the item with the given sequence
+    T& operator[](int64_t sequence) noexcept { return _buffer[(size_t)sequence & _mask]; }
+    //! Access the constant item with the given sequence
+    const T& operator[](int64_t sequence) const noexcept { return _buffer[(size_t)sequence & _mask]; }
+
+    //! Add a new consumer which depends on the given consumers
+    /*!
+        Consumer without dependencies processes items right after their publication.
+        Consumer with dependencies processes items after all of its dependencies.
+
+        Not thread-safe. Must be called before producers start publishing items.
+
+        \param dependencies - Consumers to depend on (default is empty)
+        \return Reference to the created consumer
+    */
+    Consumer& AddConsumer(std::initializer_list<const Consumer*> dependencies = {});
+
+    //! Claim the given count of sequences for publishing
+    /*!
+        Claimed items should be filled in place and published with Publish() method.
+
+        Will block while the ring has not enough free space.
+
+        \param count - Count of sequences to claim (default is 1)
+        \return The first claimed sequence or -1 if the disruptor is closed
+    */
+    int64_t Claim(size_t count = 1);
+    //! Publish the given range of claimed sequences
+    /*!
+        Will not block.
+
+        \param first - The first sequence to publish
+        \param count - Count of sequences to publish (default is 1)
+    */
+    void Publish(int64_t first, size_t count = 1);
+
+    //! Claim, fill and publish a single item
+    /*!
+        Producer will be called with the claimed item reference and its sequence.
+
+        Will block while the ring is full.
+
+        \param producer - Item producer
+        \return 'true' if the item was successfully published, 'false' if the disruptor is closed
+    */
+    template <class TProducer>
+    bool Produce(TProducer producer);
+
+    //! Close the disruptor
+    /*!
+        Consumers will process all published items and then stop.
+        Producers blocked on the full ring will be released.
+
+        Will not block.
+    */
+    void Close();
+
+private:
+    const size_t _capacity;
+    const size_t _mask;
+    const bool _multiple_producers;
+    std::vector<T> _buffer;
+    std::unique_ptr<std::atomic<int64_t>[]> _published;
+    std::vector<std::unique_ptr<Consumer>> _consumers;
+    TWaitStrategy _wait;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _claim;
+    std::atomic<int64_t> _gating_cache;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _cursor;
+    std::atomic<bool> _closed;
+
+    //! Get the last published sequence starting from the given one
+    int64_t Published(int64_t next) const noexcept;
+    //! Get the minimal sequence processed by all consumers
+    int64_t Gating() const noexcept;
+};
+
+/*! \example threads_disruptor.cpp Disruptor ring buffer with consumer graph example */
+
+} // namespace CppCommon
+
+#include "disruptor.inl"
+
+#endif // CPPCOMMON_THREADS_DISRUPTOR_H
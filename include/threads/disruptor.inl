@@ -0,0 +1,196 @@
+/*!
+    \file disruptor.inl
+    \brief Disruptor ring buffer with sequencer and consumer graph inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T, class TWaitStrategy>
+inline Disruptor<T, TWaitStrategy>::Consumer::Consumer(Disruptor& disruptor, std::initializer_list<const Consumer*> dependencies)
+    : _disruptor(disruptor), _dependencies(dependencies), _sequence(-1)
+{
+}
+
+template<typename T, class TWaitStrategy>
+template <class THandler>
+inline size_t Disruptor<T, TWaitStrategy>::Consumer::Consume(THandler handler)
+{
+    int64_t next = _sequence.load(std::memory_order_relaxed) + 1;
+
+    for (;;)
+    {
+        int64_t available = _disruptor._wait.WaitFor(next, [this, next]() { return Available(next); }, _disruptor._closed);
+        if (available >= next)
+            return Process(next, available, handler);
+
+        // The disruptor is closed, so stop when all published items are consumed
+        if (_disruptor.Published(next) < next)
+            return 0;
+
+        // Published items are still processed by dependencies
+        Thread::Yield();
+    }
+}
+
+template<typename T, class TWaitStrategy>
+template <class THandler>
+inline size_t Disruptor<T, TWaitStrategy>::Consumer::TryConsume(THandler handler)
+{
+    int64_t next = _sequence.load(std::memory_order_relaxed) + 1;
+
+    int64_t available = Available(next);
+    if (available < next)
+        return 0;
+
+    return Process(next, available, handler);
+}
+
+template<typename T, class TWaitStrategy>
+inline int64_t Disruptor<T, TWaitStrategy>::Consumer::Available(int64_t next) const noexcept
+{
+    if (_dependencies.empty())
+        return _disruptor.Published(next);
+
+    int64_t available = std::numeric_limits<int64_t>::max();
+    for (auto dependency : _dependencies)
+    {
+        int64_t sequence = dependency->sequence();
+        if (sequence < available)
+            available = sequence;
+    }
+    return available;
+}
+
+template<typename T, class TWaitStrategy>
+template <class THandler>
+inline size_t Disruptor<T, TWaitStrategy>::Consumer::Process(int64_t next, int64_t available, THandler& handler)
+{
+    for (int64_t sequence = next; sequence <= available; ++sequence)
+        handler(_disruptor[sequence], sequence, (sequence == available));
+
+    // Advance the consumer sequence once per batch
+    _sequence.store(available, std::memory_order_release);
+    _disruptor._wait.Signal();
+
+    return (size_t)(available - next + 1);
+}
+
+template<typename T, class TWaitStrategy>
+inline Disruptor<T, TWaitStrategy>::Disruptor(size_t capacity, bool multiple_producers)
+    : _capacity(capacity), _mask(capacity - 1), _multiple_producers(multiple_producers), _buffer(capacity),
+      _claim(-1), _gating_cache(-1), _cursor(-1), _closed(false)
+{
+    assert((capacity > 1) && "Ring capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring capacity must be a power of two!");
+
+    // Multiple producers publish items out of order, so track published sequence of each item
+    if (_multiple_producers)
+    {
+        _published.reset(new std::atomic<int64_t>[capacity]);
+        for (size_t i = 0; i < capacity; ++i)
+            _published[i].store((int64_t)i - (int64_t)capacity, std::memory_order_relaxed);
+    }
+}
+
+template<typename T, class TWaitStrategy>
+inline typename Disruptor<T, TWaitStrategy>::Consumer& Disruptor<T, TWaitStrategy>::AddConsumer(std::initializer_list<const Consumer*> dependencies)
+{
+    _consumers.emplace_back(new Consumer(*this, dependencies));
+    return *_consumers.back();
+}
+
+template<typename T, class TWaitStrategy>
+inline int64_t Disruptor<T, TWaitStrategy>::Claim(size_t count)
+{
+    assert(((count > 0) && (count <= _capacity)) && "Count of claimed sequences must be in range [1, capacity]!");
+
+    if (closed())
+        return -1;
+
+    int64_t last;
+    if (_multiple_producers)
+        last = _claim.fetch_add((int64_t)count, std::memory_order_acq_rel) + (int64_t)count;
+    else
+        last = _claim.load(std::memory_order_relaxed) + (int64_t)count;
+
+    // Wait until all consumers release the claimed items from the previous lap
+    int64_t wrap = last - (int64_t)_capacity;
+    if (wrap > _gating_cache.load(std::memory_order_relaxed))
+    {
+        int64_t gating = _wait.WaitFor(wrap, [this]() { return Gating(); }, _closed);
+        if (gating < wrap)
+            return -1;
+        _gating_cache.store(gating, std::memory_order_relaxed);
+    }
+
+    if (!_multiple_producers)
+        _claim.store(last, std::memory_order_release);
+
+    return last - (int64_t)count + 1;
+}
+
+template<typename T, class TWaitStrategy>
+inline void Disruptor<T, TWaitStrategy>::Publish(int64_t first, size_t count)
+{
+    if (_multiple_producers)
+    {
+        for (size_t i = 0; i < count; ++i)
+            _published[((size_t)first + i) & _mask].store(first + (int64_t)i, std::memory_order_release);
+    }
+    else
+        _cursor.store(first + (int64_t)count - 1, std::memory_order_release);
+
+    _wait.Signal();
+}
+
+template<typename T, class TWaitStrategy>
+template <class TProducer>
+inline bool Disruptor<T, TWaitStrategy>::Produce(TProducer producer)
+{
+    int64_t sequence = Claim(1);
+    if (sequence < 0)
+        return false;
+
+    producer((*this)[sequence], sequence);
+    Publish(sequence);
+    return true;
+}
+
+template<typename T, class TWaitStrategy>
+inline void Disruptor<T, TWaitStrategy>::Close()
+{
+    _closed.store(true, std::memory_order_seq_cst);
+    _wait.Signal();
+}
+
+template<typename T, class TWaitStrategy>
+inline int64_t Disruptor<T, TWaitStrategy>::Published(int64_t next) const noexcept
+{
+    if (!_multiple_producers)
+        return _cursor.load(std::memory_order_acquire);
+
+    // Find the last sequence of the contiguous published range
+    int64_t claimed = _claim.load(std::memory_order_acquire);
+    for (int64_t sequence = next; sequence <= claimed; ++sequence)
+        if (_published[(size_t)sequence & _mask].load(std::memory_order_acquire) != sequence)
+            return sequence - 1;
+    return claimed;
+}
+
+template<typename T, class TWaitStrategy>
+inline int64_t Disruptor<T, TWaitStrategy>::Gating() const noexcept
+{
+    int64_t gating = std::numeric_limits<int64_t>::max();
+    for (const auto& consumer : _consumers)
+    {
+        int64_t sequence = consumer->sequence();
+        if (sequence < gating)
+            gating = sequence;
+    }
+    return gating;
+}
+
+} // namespace CppCommon
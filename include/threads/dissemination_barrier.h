@@ -0,0 +1,108 @@
+/*!
+    \file dissemination_barrier.h
+    \brief Dissemination barrier synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_DISSEMINATION_BARRIER_H
+#define CPPCOMMON_THREADS_DISSEMINATION_BARRIER_H
+
+#include "threads/spin_wait.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Dissemination barrier synchronization primitive
+/*!
+    A barrier for a group of threads in the source code means any thread must stop at this point and cannot
+    proceed until all other threads reach this barrier.
+
+    Dissemination barrier synchronizes threads in log2(threads) rounds. In
+    the round K each thread signals the thread with the index greater by 2^K
+    (modulo the count of threads) and waits for the signal from the thread
+    with the index less by 2^K. Every thread spins only on its own flags, so
+    there is no shared counter and no cache line shared by all threads.
+
+    Waiting threads spin with the exponential backoff and yield the CPU core
+    when the backoff limit is reached.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Barrier_(computer_science)
+    https://www.cs.rice.edu/~johnmc/papers/tocs91.pdf
+*/
+class DisseminationBarrier
+{
+public:
+    //! Default class constructor
+    /*!
+        \param threads - Count of threads to wait at the barrier
+    */
+    explicit DisseminationBarrier(int threads);
+    DisseminationBarrier(const DisseminationBarrier&) = delete;
+    DisseminationBarrier(DisseminationBarrier&&) = delete;
+    ~DisseminationBarrier() = default;
+
+    DisseminationBarrier& operator=(const DisseminationBarrier&) = delete;
+    DisseminationBarrier& operator=(DisseminationBarrier&&) = delete;
+
+    //! Get the count of threads to wait at the barrier
+    int threads() const noexcept { return _threads; }
+    //! Get the count of synchronization rounds
+    int rounds() const noexcept { return _rounds; }
+
+    //! Wait at the barrier until all other threads reach this barrier
+    /*!
+        Arriving threads get their indexes with a single atomic increment of
+        the shared ticket.
+
+        Will block.
+
+        \return 'true' for the one thread that reach barrier, 'false' for each of the remaining threads
+    */
+    bool Wait() noexcept;
+    //! Wait at the barrier with the given thread index until all other threads reach this barrier
+    /*!
+        Each thread must use its own unique index in range [0, threads) and
+        all threads must use the same form of Wait() method.
+
+        Will block.
+
+        \param index - Thread index
+        \return 'true' for the thread with zero index, 'false' for each of the remaining threads
+    */
+    bool Wait(int index) noexcept;
+
+private:
+    //! Maximal count of synchronization rounds
+    static const int MAX_ROUNDS = 32;
+
+    struct alignas(CACHE_LINE_SIZE) Participant
+    {
+        std::atomic<uint64_t> flags[MAX_ROUNDS];
+        uint64_t episode;
+    };
+
+    int _threads;
+    int _rounds;
+    std::unique_ptr<Participant[]> _participants;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> _ticket;
+
+    //! Arrive with the given thread index in the given barrier episode and wait for all other threads
+    bool Arrive(int index, uint64_t episode) noexcept;
+};
+
+/*! \example threads_dissemination_barrier.cpp Dissemination barrier synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "dissemination_barrier.inl"
+
+#endif // CPPCOMMON_THREADS_DISSEMINATION_BARRIER_H
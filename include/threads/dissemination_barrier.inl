@@ -0,0 +1,64 @@
+/*!
+    \file dissemination_barrier.inl
+    \brief Dissemination barrier synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline DisseminationBarrier::DisseminationBarrier(int threads) : _threads(threads), _rounds(0), _participants(new Participant[threads]), _ticket(0)
+{
+    assert((threads > 0) && "Count of barrier threads must be greater than zero!");
+
+    // Calculate the count of synchronization rounds: ceil(log2(threads))
+    while ((1ll << _rounds) < threads)
+        ++_rounds;
+
+    for (int i = 0; i < threads; ++i)
+    {
+        for (auto& flag : _participants[i].flags)
+            flag.store(0, std::memory_order_relaxed);
+        _participants[i].episode = 0;
+    }
+}
+
+inline bool DisseminationBarrier::Wait() noexcept
+{
+    // Tickets of the barrier episode are taken only after all tickets of the previous one
+    uint64_t ticket = _ticket.fetch_add(1, std::memory_order_relaxed);
+    return Arrive((int)(ticket % (uint64_t)_threads), (ticket / (uint64_t)_threads) + 1);
+}
+
+inline bool DisseminationBarrier::Wait(int index) noexcept
+{
+    assert(((index >= 0) && (index < _threads)) && "Thread index is out of the barrier threads range!");
+
+    // Barrier episode is counted by the thread owning the index
+    return Arrive(index, ++_participants[index].episode);
+}
+
+inline bool DisseminationBarrier::Arrive(int index, uint64_t episode) noexcept
+{
+    Participant& participant = _participants[index];
+
+    for (int round = 0; round < _rounds; ++round)
+    {
+        // Signal the partner of the current round. In the ticket mode a slow thread of
+        // the previous episode could share the index, so the flag must never go back.
+        std::atomic<uint64_t>& flag = _participants[(index + (1ll << round)) % _threads].flags[round];
+        uint64_t current = flag.load(std::memory_order_relaxed);
+        while ((current < episode) && !flag.compare_exchange_weak(current, episode, std::memory_order_release, std::memory_order_relaxed));
+
+        // Spin-wait for the signal of the current round. The flag could be already
+        // overwritten by the signal of the next barrier episode.
+        SpinWait spin;
+        while (participant.flags[round].load(std::memory_order_acquire) < episode)
+            spin.Spin();
+    }
+
+    return (index == 0);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,137 @@
+/*!
+    \file distributed_rw_lock.h
+    \brief Distributed read/write lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
+#define CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
+
+#include "threads/adaptive_mutex.h"
+#include "threads/locker.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Distributed read/write lock synchronization primitive
+/*!
+    Distributed read/write lock keeps a separate cache line sized reader
+    counter (reader slot) for each CPU core. Readers increment only their
+    own slot and check the writer flag, so concurrent readers never write
+    to a shared cache line and read throughput scales with the number of
+    CPU cores. Writers are serialized with an adaptive mutex, raise the
+    writer flag and wait until all reader slots are drained. Readers
+    which meet the writer flag park on the futex until the writer is done.
+
+    The reader slot is assigned to each thread once (round-robin), so the
+    readers touch only their own cache line as long as there are not more
+    reading threads than reader slots.
+
+    Writer preference mode (default) blocks new readers as soon as a
+    writer arrives, so writers are never starved by the continuous flow
+    of readers. In reader preference mode the arrived writer steps back
+    while there are active readers, so readers are never blocked by the
+    waiting writer.
+
+    Distributed read/write lock is best suited for read-mostly workloads,
+    writes are more expensive than with RWLock. Recursive locking is not
+    supported.
+
+    Thread-safe.
+
+    https://arxiv.org/abs/1810.01553
+*/
+class DistributedRWLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param writer_preference - Writer preference mode (default is true)
+    */
+    explicit DistributedRWLock(bool writer_preference = true);
+    DistributedRWLock(const DistributedRWLock&) = delete;
+    DistributedRWLock(DistributedRWLock&&) = delete;
+    ~DistributedRWLock() = default;
+
+    DistributedRWLock& operator=(const DistributedRWLock&) = delete;
+    DistributedRWLock& operator=(DistributedRWLock&&) = delete;
+
+    //! Get reader slots count
+    size_t slots() const noexcept { return _mask + 1; }
+    //! Is writer preference mode?
+    bool writer_preference() const noexcept { return _writer_preference; }
+
+    //! Try to acquire read lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead() noexcept;
+    //! Try to acquire write lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite() noexcept;
+
+    //! Acquire read lock with block
+    /*!
+        Will block.
+    */
+    void LockRead() noexcept;
+    //! Acquire write lock with block
+    /*!
+        Will block.
+    */
+    void LockWrite() noexcept;
+
+    //! Release read lock
+    /*!
+        Will not block.
+    */
+    void UnlockRead() noexcept;
+    //! Release write lock
+    /*!
+        Will not block.
+    */
+    void UnlockWrite() noexcept;
+
+private:
+    enum : uint32_t { WRITER = 1, WAITERS = 2 };
+
+    struct alignas(CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<uint32_t> readers;
+
+        Slot() noexcept : readers(0) {}
+    };
+
+    std::unique_ptr<Slot[]> _slots;
+    size_t _mask;
+    bool _writer_preference;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _state;
+    AdaptiveMutex _writers;
+
+    //! Get the reader slot of the current thread
+    Slot& Current() noexcept;
+    //! Check if all reader slots are drained
+    bool Drained() const noexcept;
+    //! Raise the writer flag
+    void Raise() noexcept;
+    //! Drop the writer flag and wake parked readers
+    void Drop() noexcept;
+};
+
+/*! \example threads_distributed_rw_lock.cpp Distributed read/write lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_DISTRIBUTED_RW_LOCK_H
@@ -0,0 +1,148 @@
+/*!
+    \file epoch_reclamation.h
+    \brief Epoch-based memory reclamation domain definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_EPOCH_RECLAMATION_H
+#define CPPCOMMON_THREADS_EPOCH_RECLAMATION_H
+
+#include "threads/reclamation_domain.h"
+
+namespace CppCommon {
+
+//! Epoch-based memory reclamation domain
+/*!
+    Epoch-based reclamation (EBR) protects whole read-side critical sections
+    instead of individual pointers. Each reader announces the observed global
+    epoch when it enters a critical section and clears it on leave. The global
+    epoch advances only when all readers inside critical sections announced the
+    current one, so pointers retired in some epoch are safe to delete after two
+    epoch advances.
+
+    Readers pay a single store and a full memory fence per critical section
+    regardless of the count of accessed nodes, but a stalled reader blocks the
+    reclamation of all retired pointers.
+
+    Thread-safe.
+
+    https://www.cl.cam.ac.uk/techreports/UCAM-CL-TR-579.pdf
+*/
+class EpochReclamation : public ReclamationDomain
+{
+public:
+    //! Epoch-based reclamation record of the thread
+    struct Record : public ReclamationDomain::Record
+    {
+        std::atomic<uint64_t> epoch;
+        size_t nesting;
+
+        Record() : epoch(0), nesting(0) {}
+
+        void Release() noexcept override
+        {
+            nesting = 0;
+            epoch.store(0, std::memory_order_release);
+        }
+    };
+
+    //! Epoch-based reclamation guard
+    /*!
+        Guard enters the read-side critical section of the current thread and
+        leaves it on destruction. All pointers loaded within the guard lifetime
+        stay valid until it is destroyed. Guards could be nested.
+
+        Not thread-safe (must be used only by the thread which created it).
+    */
+    class Guard
+    {
+    public:
+        //! Enter the read-side critical section of the current thread
+        /*!
+            \param domain - Epoch-based reclamation domain
+        */
+        explicit Guard(EpochReclamation& domain) : _domain(domain), _record(static_cast<Record&>(domain.Acquire()))
+        {
+            if (_record.nesting++ == 0)
+            {
+                _record.epoch.store(_domain._epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+
+                // Paired with the fence before the epoch advance
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard()
+        {
+            if (--_record.nesting == 0)
+                _record.epoch.store(0, std::memory_order_release);
+        }
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        //! Retire the given pointer
+        /*!
+            The pointer will be deleted with the given deleter after two epoch advances.
+
+            \param ptr - Pointer to retire
+            \param deleter - Pointer deleter
+            \param context - Deleter context (default is nullptr)
+        */
+        void Retire(void* ptr, Deleter deleter, void* context = nullptr) { _domain.ReclamationDomain::Retire(_record, ptr, deleter, context); }
+        //! Retire the given pointer which will be deleted with 'delete' operator
+        /*!
+            \param ptr - Pointer to retire
+        */
+        template <typename T>
+        void Retire(T* ptr) { Retire(ptr, [](void* p, void*) { delete (T*)p; }); }
+
+    private:
+        EpochReclamation& _domain;
+        Record& _record;
+    };
+
+    //! Create epoch-based reclamation domain
+    /*!
+        \param batch - Minimal count of retired pointers of the thread to start the reclamation (default is 64)
+    */
+    explicit EpochReclamation(size_t batch = 64) : ReclamationDomain(batch), _epoch(1) {}
+    EpochReclamation(const EpochReclamation&) = delete;
+    EpochReclamation(EpochReclamation&&) = delete;
+    ~EpochReclamation() = default;
+
+    EpochReclamation& operator=(const EpochReclamation&) = delete;
+    EpochReclamation& operator=(EpochReclamation&&) = delete;
+
+    //! Get the global epoch
+    uint64_t epoch() const noexcept { return _epoch.load(std::memory_order_acquire); }
+
+    //! Reclaim all retired pointers of the current thread which are safe to delete
+    /*!
+        Should be called outside of the read-side critical section, otherwise
+        the current thread prevents the epoch advance.
+    */
+    void Reclaim() override;
+
+protected:
+    ReclamationDomain::Record* Create() override { return new Record(); }
+    //! Advance the global epoch and delete all retired pointers of the given record which are two epochs old
+    void Scan(ReclamationDomain::Record& record) override;
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> _epoch;
+
+    //! Stamp all new retired pointers of the given record with the global epoch
+    void Stamp(ReclamationDomain::Record& record);
+    //! Try to advance the global epoch
+    void Advance();
+    //! Delete all retired pointers of the given record which are two epochs old
+    void Collect(ReclamationDomain::Record& record);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_EPOCH_RECLAMATION_H
@@ -0,0 +1,159 @@
+/*!
+    \file event_count.h
+    \brief Event count synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_EVENT_COUNT_H
+#define CPPCOMMON_THREADS_EVENT_COUNT_H
+
+#include "threads/futex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Event count synchronization primitive
+/*!
+    Event count allows to block threads waiting for some condition of the
+    lock-free data structure without a lock. Waiting thread prepares to wait,
+    re-checks the condition and commits to wait only if the condition is still
+    false. Notifying thread changes the condition and notifies the event count.
+
+    \code
+    // Waiting thread
+    while (!condition())
+    {
+        uint32_t key = event.PrepareWait();
+        if (condition())
+        {
+            event.CancelWait();
+            break;
+        }
+        event.CommitWait(key);
+    }
+
+    // Notifying thread
+    change_condition();
+    event.NotifyOne();
+    \endcode
+
+    Notification is a memory fence and a single load of the waiters counter
+    if nobody waits. Otherwise it advances the event count epoch and wakes the
+    requested count of waiters with a single futex system call.
+
+    Commit wait methods could return spuriously, so the caller must re-check
+    its condition in a loop. Wait() method implements the whole loop with
+    an optional spinning before the wait.
+
+    Event count placed in the shared memory could be used to wait and notify
+    across processes. It must be created with the shared flag by the owner
+    process (e.g. with the placement new operator).
+
+    Thread-safe.
+
+    http://cbloomrants.blogspot.com/2011/07/07-08-11-who-ordered-event-count.html
+*/
+class EventCount
+{
+public:
+    //! Create the event count
+    /*!
+        \param shared - Event count is placed in the shared memory and used across processes (default is false)
+    */
+    explicit EventCount(bool shared = false) noexcept : _epoch(0), _waiters(0), _shared(shared) {}
+    EventCount(const EventCount&) = delete;
+    EventCount(EventCount&&) = delete;
+    ~EventCount() = default;
+
+    EventCount& operator=(const EventCount&) = delete;
+    EventCount& operator=(EventCount&&) = delete;
+
+    //! Is the event count shared across processes?
+    bool shared() const noexcept { return _shared; }
+    //! Get the count of threads prepared to wait
+    int waiters() const noexcept { return (int)_waiters.load(std::memory_order_acquire); }
+
+    //! Prepare to wait for the event count
+    /*!
+        Registers the current thread as a waiter. The caller must re-check its
+        condition and then call either CommitWait() or CancelWait().
+
+        Will not block.
+
+        \return Wait key to commit wait with
+    */
+    uint32_t PrepareWait() noexcept;
+    //! Cancel the prepared wait
+    /*!
+        Will not block.
+    */
+    void CancelWait() noexcept;
+    //! Commit the prepared wait
+    /*!
+        Returns immediately if the event count was notified after the wait
+        preparation.
+
+        Will block.
+
+        \param key - Wait key returned by PrepareWait() method
+    */
+    void CommitWait(uint32_t key) noexcept;
+    //! Commit the prepared wait for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param key - Wait key returned by PrepareWait() method
+        \param timespan - Timespan to wait for the notification
+        \return 'false' if the timeout was occurred, 'true' otherwise
+    */
+    bool CommitWaitFor(uint32_t key, const Timespan& timespan) noexcept;
+
+    //! Wait until the given condition is satisfied
+    /*!
+        Checks the condition the given count of times before the wait
+        preparation and re-checks it after each wake-up.
+
+        Will block.
+
+        \param condition - Condition function with the signature 'bool()'
+        \param spin - Count of condition checks before the wait (default is 0)
+    */
+    template <class TCondition>
+    void Wait(TCondition condition, size_t spin = 0);
+
+    //! Notify one waiting thread
+    /*!
+        Will not block.
+    */
+    void NotifyOne() noexcept { Notify(1); }
+    //! Notify the given count of waiting threads
+    /*!
+        Will not block.
+
+        \param count - Count of threads to notify
+    */
+    void Notify(int count) noexcept;
+    //! Notify all waiting threads
+    /*!
+        Will not block.
+    */
+    void NotifyAll() noexcept;
+
+private:
+    std::atomic<uint32_t> _epoch;
+    std::atomic<uint32_t> _waiters;
+    bool _shared;
+};
+
+/*! \example threads_event_count.cpp Event count synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "event_count.inl"
+
+#endif // CPPCOMMON_THREADS_EVENT_COUNT_H
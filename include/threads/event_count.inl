@@ -0,0 +1,84 @@
+/*!
+    \file event_count.inl
+    \brief Event count synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline uint32_t EventCount::PrepareWait() noexcept
+{
+    // Register as a waiter before the caller re-checks its condition. Paired with the fence
+    // in Notify(), so either the notifier observes the waiter or the waiter observes the change.
+    uint32_t key = _epoch.load(std::memory_order_acquire);
+    _waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return key;
+}
+
+inline void EventCount::CancelWait() noexcept
+{
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void EventCount::CommitWait(uint32_t key) noexcept
+{
+    if (_epoch.load(std::memory_order_acquire) == key)
+        Futex::Wait(_epoch, key, _shared);
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline bool EventCount::CommitWaitFor(uint32_t key, const Timespan& timespan) noexcept
+{
+    bool result = (_epoch.load(std::memory_order_acquire) != key) || Futex::WaitFor(_epoch, key, timespan, _shared);
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+    return result;
+}
+
+template <class TCondition>
+inline void EventCount::Wait(TCondition condition, size_t spin)
+{
+    for (;;)
+    {
+        // Spin for a while before the wait
+        for (size_t i = 0; i <= spin; ++i)
+            if (condition())
+                return;
+
+        uint32_t key = PrepareWait();
+        if (condition())
+        {
+            CancelWait();
+            return;
+        }
+        CommitWait(key);
+    }
+}
+
+inline void EventCount::Notify(int count) noexcept
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Issue the wake-up system call only if someone is waiting
+    if (_waiters.load(std::memory_order_relaxed) > 0)
+    {
+        _epoch.fetch_add(1, std::memory_order_release);
+        Futex::Wake(_epoch, count, _shared);
+    }
+}
+
+inline void EventCount::NotifyAll() noexcept
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Issue the wake-up system call only if someone is waiting
+    if (_waiters.load(std::memory_order_relaxed) > 0)
+    {
+        _epoch.fetch_add(1, std::memory_order_release);
+        Futex::WakeAll(_epoch, _shared);
+    }
+}
+
+} // namespace CppCommon
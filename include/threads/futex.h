@@ -0,0 +1,106 @@
+/*!
+    \file futex.h
+    \brief Futex synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_H
+#define CPPCOMMON_THREADS_FUTEX_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Futex synchronization primitive static class
+/*!
+    Futex allows to park the current thread until the value of the given
+    32-bit atomic word is changed and the word is woken by another thread.
+    It is a building block for blocking primitives which keep their state
+    in a user space atomic word and enter the kernel only to sleep and wake
+    sleeping threads.
+
+    Uses futex() system call on Linux and WaitOnAddress() family functions
+    on Windows (loaded at runtime, Windows 8 or later). Other platforms
+    emulate parking with short sleeps.
+
+    Wait methods could return spuriously, so the caller must re-check its
+    condition in a loop.
+
+    Futex words placed in the shared memory could be used between processes
+    with the 'shared' flag (process-private futex operations are cheaper and
+    used by default). WaitOnAddress() does not work between processes, so
+    shared futex words are parked with short sleeps on Windows.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Futex
+*/
+class Futex
+{
+public:
+    Futex() = delete;
+    Futex(const Futex&) = delete;
+    Futex(Futex&&) = delete;
+    ~Futex() = delete;
+
+    Futex& operator=(const Futex&) = delete;
+    Futex& operator=(Futex&&) = delete;
+
+    //! Wait on the futex word while it holds the expected value
+    /*!
+        Will block.
+
+        \param word - Futex word
+        \param expected - Expected value of the futex word
+        \param shared - Process-shared futex word flag (default is false)
+    */
+    static void Wait(std::atomic<uint32_t>& word, uint32_t expected, bool shared = false) noexcept;
+    //! Wait on the futex word while it holds the expected value for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param word - Futex word
+        \param expected - Expected value of the futex word
+        \param timespan - Timespan to wait
+        \param shared - Process-shared futex word flag (default is false)
+        \return 'false' if the timeout was occurred, 'true' otherwise
+    */
+    static bool WaitFor(std::atomic<uint32_t>& word, uint32_t expected, const Timespan& timespan, bool shared = false) noexcept;
+
+    //! Wake one thread waiting on the futex word
+    /*!
+        Will not block.
+
+        \param word - Futex word
+        \param shared - Process-shared futex word flag (default is false)
+    */
+    static void WakeOne(std::atomic<uint32_t>& word, bool shared = false) noexcept;
+    //! Wake the given count of threads waiting on the futex word
+    /*!
+        Linux wakes all of them with a single system call.
+
+        Will not block.
+
+        \param word - Futex word
+        \param count - Count of threads to wake
+        \param shared - Process-shared futex word flag (default is false)
+    */
+    static void Wake(std::atomic<uint32_t>& word, int count, bool shared = false) noexcept;
+    //! Wake all threads waiting on the futex word
+    /*!
+        Will not block.
+
+        \param word - Futex word
+        \param shared - Process-shared futex word flag (default is false)
+    */
+    static void WakeAll(std::atomic<uint32_t>& word, bool shared = false) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_FUTEX_H
@@ -0,0 +1,108 @@
+/*!
+    \file futex_event_auto_reset.h
+    \brief Futex auto-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_EVENT_AUTO_RESET_H
+#define CPPCOMMON_THREADS_FUTEX_EVENT_AUTO_RESET_H
+
+#include "threads/event_count.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! Futex auto-reset event synchronization primitive
+/*!
+    Futex auto-reset event allows multiple threads to wait for some event occurred
+    and signal only one thread at the time. Other thread will wait for the next event signalization.
+    The order of thread signalization by auto-reset event is not guaranteed.
+
+    The count of pending signals is kept in a user space atomic word and waiting
+    threads are parked on the event count, so signal and wait are a single atomic
+    operation when nobody needs to sleep. Signaling several events at once wakes
+    the same count of waiters with a single system call.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
+*/
+class FutexEventAutoReset
+{
+public:
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit FutexEventAutoReset(bool signaled = false) noexcept : _signaled(signaled ? 1 : 0) {}
+    FutexEventAutoReset(const FutexEventAutoReset&) = delete;
+    FutexEventAutoReset(FutexEventAutoReset&&) = delete;
+    ~FutexEventAutoReset() = default;
+
+    FutexEventAutoReset& operator=(const FutexEventAutoReset&) = delete;
+    FutexEventAutoReset& operator=(FutexEventAutoReset&&) = delete;
+
+    //! Signal one of waiting thread about event occurred
+    /*!
+        If some threads are waiting for the event one will be chosen, signaled and continued.
+        The order of thread signalization by auto-reset event is not guaranteed.
+
+        Will not block.
+    */
+    void Signal() noexcept { Signal(1); }
+    //! Signal the given count of waiting threads about event occurred
+    /*!
+        Will not block.
+
+        \param count - Count of event signals
+    */
+    void Signal(int count) noexcept;
+
+    //! Try to wait the event without block
+    /*!
+        Will not block.
+
+        \return 'true' if the event was occurred before and no other threads were signaled, 'false' if the event was not occurred before
+    */
+    bool TryWait() noexcept;
+
+    //! Try to wait the event for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitFor(const Timespan& timespan) noexcept;
+    //! Try to wait the event until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryWaitFor(timestamp - UtcTimestamp()); }
+
+    //! Try to wait the event with block
+    /*!
+        Will block.
+    */
+    void Wait() noexcept;
+
+private:
+    std::atomic<int> _signaled;
+    EventCount _event;
+};
+
+/*! \example threads_futex_event_auto_reset.cpp Futex auto-reset event synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_event_auto_reset.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_EVENT_AUTO_RESET_H
@@ -0,0 +1,72 @@
+/*!
+    \file futex_event_auto_reset.inl
+    \brief Futex auto-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void FutexEventAutoReset::Signal(int count) noexcept
+{
+    _signaled.fetch_add(count, std::memory_order_release);
+
+    // Wake the same count of waiting threads
+    _event.Notify(count);
+}
+
+inline bool FutexEventAutoReset::TryWait() noexcept
+{
+    int signaled = _signaled.load(std::memory_order_relaxed);
+    while (signaled > 0)
+        if (_signaled.compare_exchange_weak(signaled, signaled - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    return false;
+}
+
+inline bool FutexEventAutoReset::TryWaitFor(const Timespan& timespan) noexcept
+{
+    if (TryWait())
+        return true;
+
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    for (;;)
+    {
+        uint32_t key = _event.PrepareWait();
+        if (TryWait())
+        {
+            _event.CancelWait();
+            return true;
+        }
+
+        Timestamp now = NanoTimestamp();
+        if (now >= finish)
+        {
+            _event.CancelWait();
+            return false;
+        }
+
+        _event.CommitWaitFor(key, finish - now);
+        if (TryWait())
+            return true;
+    }
+}
+
+inline void FutexEventAutoReset::Wait() noexcept
+{
+    while (!TryWait())
+    {
+        uint32_t key = _event.PrepareWait();
+        if (TryWait())
+        {
+            _event.CancelWait();
+            return;
+        }
+        _event.CommitWait(key);
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,109 @@
+/*!
+    \file futex_event_manual_reset.h
+    \brief Futex manual-reset event synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_EVENT_MANUAL_RESET_H
+#define CPPCOMMON_THREADS_FUTEX_EVENT_MANUAL_RESET_H
+
+#include "threads/event_count.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! Futex manual-reset event synchronization primitive
+/*!
+    Futex manual-reset event allows multiple threads to wait for some event occurred
+    and signal all waiting threads at the time. If the event is in the signaled state no thread will wait
+    for it until the event is reset.
+
+    The event state is kept in a user space atomic word and waiting threads
+    are parked on the event count, so signal, reset and wait of the signaled
+    event are a single atomic operation. All waiting threads are woken with a
+    single system call.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Event_(synchronization_primitive)
+*/
+class FutexEventManualReset
+{
+public:
+    //! Default class constructor
+    /*!
+        \param signaled - Signaled event initial state (default is false)
+    */
+    explicit FutexEventManualReset(bool signaled = false) noexcept : _signaled(signaled) {}
+    FutexEventManualReset(const FutexEventManualReset&) = delete;
+    FutexEventManualReset(FutexEventManualReset&&) = delete;
+    ~FutexEventManualReset() = default;
+
+    FutexEventManualReset& operator=(const FutexEventManualReset&) = delete;
+    FutexEventManualReset& operator=(FutexEventManualReset&&) = delete;
+
+    //! Reset the event
+    /*!
+        If the event is in the signaled state then it will be reset to non signaled state.
+        As the result other threads that wait for the event will be blocked.
+
+        Will not block.
+    */
+    void Reset() noexcept { _signaled.store(false, std::memory_order_release); }
+
+    //! Signal all waiting threads about event occurred
+    /*!
+        If some threads are waiting for the event all of them will be signaled and continued.
+
+        Will not block.
+    */
+    void Signal() noexcept;
+
+    //! Try to wait the event without block
+    /*!
+        Will not block.
+
+        \return 'true' if the event is in the signaled state, 'false' if the event is not in the signaled state
+    */
+    bool TryWait() noexcept { return _signaled.load(std::memory_order_acquire); }
+
+    //! Try to wait the event for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitFor(const Timespan& timespan) noexcept;
+    //! Try to wait the event until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the event
+        \return 'true' if the event was occurred, 'false' if the event was not occurred
+    */
+    bool TryWaitUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryWaitFor(timestamp - UtcTimestamp()); }
+
+    //! Try to wait the event with block
+    /*!
+        Will block.
+    */
+    void Wait() noexcept;
+
+private:
+    std::atomic<bool> _signaled;
+    EventCount _event;
+};
+
+/*! \example threads_futex_event_manual_reset.cpp Futex manual-reset event synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_event_manual_reset.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_EVENT_MANUAL_RESET_H
@@ -0,0 +1,63 @@
+/*!
+    \file futex_event_manual_reset.inl
+    \brief Futex manual-reset event synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void FutexEventManualReset::Signal() noexcept
+{
+    _signaled.store(true, std::memory_order_release);
+
+    // Wake all waiting threads
+    _event.NotifyAll();
+}
+
+inline bool FutexEventManualReset::TryWaitFor(const Timespan& timespan) noexcept
+{
+    if (TryWait())
+        return true;
+
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    for (;;)
+    {
+        uint32_t key = _event.PrepareWait();
+        if (TryWait())
+        {
+            _event.CancelWait();
+            return true;
+        }
+
+        Timestamp now = NanoTimestamp();
+        if (now >= finish)
+        {
+            _event.CancelWait();
+            return false;
+        }
+
+        _event.CommitWaitFor(key, finish - now);
+        if (TryWait())
+            return true;
+    }
+}
+
+inline void FutexEventManualReset::Wait() noexcept
+{
+    while (!TryWait())
+    {
+        uint32_t key = _event.PrepareWait();
+        if (TryWait())
+        {
+            _event.CancelWait();
+            return;
+        }
+        _event.CommitWait(key);
+    }
+}
+
+} // namespace CppCommon
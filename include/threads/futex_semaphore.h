@@ -0,0 +1,113 @@
+/*!
+    \file futex_semaphore.h
+    \brief Futex semaphore synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_SEMAPHORE_H
+#define CPPCOMMON_THREADS_FUTEX_SEMAPHORE_H
+
+#include "threads/event_count.h"
+#include "threads/locker.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cassert>
+
+namespace CppCommon {
+
+//! Futex semaphore synchronization primitive
+/*!
+    Futex semaphore keeps its resources counter in a user space atomic word
+    and parks waiting threads on the event count. Acquire and release are a
+    single atomic operation when there is no need to wait, so the semaphore
+    enters the kernel only to sleep and to wake sleeping threads. Releasing
+    several resources at once wakes the same count of waiters with a single
+    system call.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Semaphore_(programming)
+*/
+class FutexSemaphore
+{
+public:
+    //! Default class constructor
+    /*!
+        \param resources - Semaphore resources counter
+    */
+    explicit FutexSemaphore(int resources) noexcept;
+    FutexSemaphore(const FutexSemaphore&) = delete;
+    FutexSemaphore(FutexSemaphore&&) = delete;
+    ~FutexSemaphore() = default;
+
+    FutexSemaphore& operator=(const FutexSemaphore&) = delete;
+    FutexSemaphore& operator=(FutexSemaphore&&) = delete;
+
+    //! Get the semaphore resources counter
+    int resources() const noexcept { return _resources; }
+    //! Get the count of available semaphore resources
+    int available() const noexcept { return _available.load(std::memory_order_acquire); }
+
+    //! Try to acquire semaphore without block
+    /*!
+        Will not block.
+
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Try to acquire semaphore for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the semaphore
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLockFor(const Timespan& timespan) noexcept;
+    //! Try to acquire semaphore until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the semaphore
+        \return 'true' if the semaphore was successfully acquired, 'false' if the semaphore is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp) noexcept
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire semaphore with block
+    /*!
+        Will block.
+    */
+    void Lock() noexcept;
+
+    //! Release semaphore
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept { Unlock(1); }
+    //! Release the given count of semaphore resources
+    /*!
+        Wakes up to the given count of waiting threads with a single system call.
+
+        Will not block.
+
+        \param count - Count of semaphore resources to release
+    */
+    void Unlock(int count) noexcept;
+
+private:
+    int _resources;
+    std::atomic<int> _available;
+    EventCount _event;
+};
+
+/*! \example threads_futex_semaphore.cpp Futex semaphore synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "futex_semaphore.inl"
+
+#endif // CPPCOMMON_THREADS_FUTEX_SEMAPHORE_H
@@ -0,0 +1,80 @@
+/*!
+    \file futex_semaphore.inl
+    \brief Futex semaphore synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline FutexSemaphore::FutexSemaphore(int resources) noexcept : _resources(resources), _available(resources)
+{
+    assert((resources > 0) && "Semaphore resources counter must be greater than zero!");
+}
+
+inline bool FutexSemaphore::TryLock() noexcept
+{
+    int available = _available.load(std::memory_order_relaxed);
+    while (available > 0)
+        if (_available.compare_exchange_weak(available, available - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    return false;
+}
+
+inline bool FutexSemaphore::TryLockFor(const Timespan& timespan) noexcept
+{
+    if (TryLock())
+        return true;
+
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    for (;;)
+    {
+        uint32_t key = _event.PrepareWait();
+        if (TryLock())
+        {
+            _event.CancelWait();
+            return true;
+        }
+
+        Timestamp now = NanoTimestamp();
+        if (now >= finish)
+        {
+            _event.CancelWait();
+            return false;
+        }
+
+        _event.CommitWaitFor(key, finish - now);
+        if (TryLock())
+            return true;
+    }
+}
+
+inline void FutexSemaphore::Lock() noexcept
+{
+    while (!TryLock())
+    {
+        uint32_t key = _event.PrepareWait();
+        if (TryLock())
+        {
+            _event.CancelWait();
+            return;
+        }
+        _event.CommitWait(key);
+    }
+}
+
+inline void FutexSemaphore::Unlock(int count) noexcept
+{
+    assert((count > 0) && "Count of semaphore resources to release must be greater than zero!");
+
+    [[maybe_unused]] int available = _available.fetch_add(count, std::memory_order_release);
+    assert(((available + count) <= _resources) && "Semaphore resources counter exceeded!");
+
+    // Wake the same count of waiting threads
+    _event.Notify(count);
+}
+
+} // namespace CppCommon
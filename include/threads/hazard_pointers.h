@@ -0,0 +1,158 @@
+/*!
+    \file hazard_pointers.h
+    \brief Hazard pointers memory reclamation domain definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_HAZARD_POINTERS_H
+#define CPPCOMMON_THREADS_HAZARD_POINTERS_H
+
+#include "threads/reclamation_domain.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+//! Hazard pointers memory reclamation domain
+/*!
+    Hazard pointers allow lock-free data structures to delete nodes which
+    could be still accessed by concurrent readers. Each reader publishes
+    pointers to the nodes it is going to access in its hazard pointers.
+    Removed nodes are retired into the per-thread retire list and deleted
+    in batches only when no hazard pointer of any thread points to them.
+
+    Readers pay a store and a full memory fence for each protected pointer,
+    but a stalled reader keeps only a bounded count of nodes from deletion.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Hazard_pointer
+*/
+class HazardPointers : public ReclamationDomain
+{
+public:
+    //! Count of hazard pointers per thread
+    static const size_t HAZARDS = 4;
+
+    //! Hazard pointers record of the thread
+    struct Record : public ReclamationDomain::Record
+    {
+        std::atomic<void*> hazards[HAZARDS];
+
+        Record()
+        {
+            for (auto& hazard : hazards)
+                hazard.store(nullptr, std::memory_order_relaxed);
+        }
+
+        void Release() noexcept override
+        {
+            for (auto& hazard : hazards)
+                hazard.store(nullptr, std::memory_order_relaxed);
+        }
+    };
+
+    //! Hazard pointers guard
+    /*!
+        Guard provides access to the hazard pointers of the current thread
+        and clears all of them on destruction.
+
+        Not thread-safe (must be used only by the thread which created it).
+    */
+    class Guard
+    {
+    public:
+        //! Create hazard pointers guard of the current thread
+        /*!
+            \param domain - Hazard pointers domain
+        */
+        explicit Guard(HazardPointers& domain) : _domain(domain), _record(static_cast<Record&>(domain.Acquire())) {}
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        ~Guard() { Clear(); }
+
+        Guard& operator=(const Guard&) = delete;
+        Guard& operator=(Guard&&) = delete;
+
+        //! Protect the pointer loaded from the given source with the given hazard pointer
+        /*!
+            The pointer is re-loaded until it is stable after publication in the hazard pointer.
+
+            \param index - Hazard pointer index (must be less than HAZARDS)
+            \param source - Atomic source of the pointer
+            \return Protected pointer
+        */
+        template <typename T>
+        T* Protect(size_t index, const std::atomic<T*>& source) noexcept
+        {
+            assert((index < HAZARDS) && "Invalid hazard pointer index!");
+
+            T* ptr = source.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                _record.hazards[index].store(ptr, std::memory_order_relaxed);
+
+                // Paired with the fence before the hazard pointers scan
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                T* current = source.load(std::memory_order_acquire);
+                if (current == ptr)
+                    return ptr;
+                ptr = current;
+            }
+        }
+
+        //! Clear the given hazard pointer
+        void Clear(size_t index) noexcept { _record.hazards[index].store(nullptr, std::memory_order_release); }
+        //! Clear all hazard pointers
+        void Clear() noexcept
+        {
+            for (auto& hazard : _record.hazards)
+                hazard.store(nullptr, std::memory_order_release);
+        }
+
+        //! Retire the given pointer
+        /*!
+            The pointer will be deleted with the given deleter when no hazard pointer points to it.
+
+            \param ptr - Pointer to retire
+            \param deleter - Pointer deleter
+            \param context - Deleter context (default is nullptr)
+        */
+        void Retire(void* ptr, Deleter deleter, void* context = nullptr) { _domain.ReclamationDomain::Retire(_record, ptr, deleter, context); }
+        //! Retire the given pointer which will be deleted with 'delete' operator
+        /*!
+            \param ptr - Pointer to retire
+        */
+        template <typename T>
+        void Retire(T* ptr) { Retire(ptr, [](void* p, void*) { delete (T*)p; }); }
+
+    private:
+        HazardPointers& _domain;
+        Record& _record;
+    };
+
+    //! Create hazard pointers domain
+    /*!
+        \param batch - Minimal count of retired pointers of the thread to start the reclamation (default is 64)
+    */
+    explicit HazardPointers(size_t batch = 64) : ReclamationDomain(batch) {}
+    HazardPointers(const HazardPointers&) = delete;
+    HazardPointers(HazardPointers&&) = delete;
+    ~HazardPointers() = default;
+
+    HazardPointers& operator=(const HazardPointers&) = delete;
+    HazardPointers& operator=(HazardPointers&&) = delete;
+
+protected:
+    ReclamationDomain::Record* Create() override { return new Record(); }
+    size_t Threshold() const noexcept override;
+    //! Scan hazard pointers and delete all unprotected retired pointers of the given record
+    void Scan(ReclamationDomain::Record& record) override;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_HAZARD_POINTERS_H
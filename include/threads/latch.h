@@ -9,12 +9,12 @@
 #ifndef CPPCOMMON_THREADS_LATCH_H
 #define CPPCOMMON_THREADS_LATCH_H
 
+#include "threads/futex.h"
 #include "time/timestamp.h"
 
+#include <atomic>
 #include <cassert>
-#include <condition_variable>
-#include <memory>
-#include <mutex>
+#include <cstdint>
 
 namespace CppCommon {
 
@@ -23,6 +23,10 @@ namespace CppCommon {
     Latches are a thread co-ordination mechanism that allow one or more threads to block
     until one or more threads have reached a point.
 
+    Latch counter and generation are lock-free atomics. Counting down never
+    takes a lock and issues the wake-up system call only if some threads are
+    blocked on the latch generation futex.
+
     Thread-safe.
 */
 class Latch
@@ -41,7 +45,7 @@ public:
     Latch& operator=(Latch&&) = delete;
 
     //! Get the count of threads to wait for the latch
-    int threads() const noexcept { return _threads; }
+    int threads() const noexcept { return _threads.load(std::memory_order_acquire); }
 
     //! Reset the latch with a new threads counter value
     /*!
@@ -107,12 +111,19 @@ public:
     bool TryWaitUntil(const Timestamp& timestamp) noexcept;
 
 private:
-    std::mutex _mutex;
-    std::condition_variable _cond;
-    int _generation;
-    int _threads;
+    std::atomic<int> _threads;
+    std::atomic<uint32_t> _generation;
+    std::atomic<uint32_t> _waiters;
 
-    bool CountDown(std::unique_lock<std::mutex>& lock) noexcept;
+    //! Count down the latch threads counter and release waiting threads when it reaches zero
+    bool Release() noexcept;
+    //! Wait for the next latch generation
+    /*!
+        \param generation - Current latch generation
+        \param timespan - Timespan to wait for the latch (nullptr to wait infinitely)
+        \return 'true' if the latch generation was changed, 'false' in case of timeout
+    */
+    bool WaitGeneration(uint32_t generation, const Timespan* timespan) noexcept;
 };
 
 /*! \example threads_latch_multi.cpp Latch synchronization primitive example for multiple threads waiting */
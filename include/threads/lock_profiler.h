@@ -0,0 +1,223 @@
+/*!
+    \file lock_profiler.h
+    \brief Lock contention profiler definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_LOCK_PROFILER_H
+#define CPPCOMMON_THREADS_LOCK_PROFILER_H
+
+#include "time/timestamp.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+struct LockProfilerSite;
+
+} // namespace Internals
+//! @endcond
+
+template <class TLock>
+class ProfiledLock;
+
+//! Lock contention profiler static class
+/*!
+    Lock contention profiler collects statistics of the profiled locks
+    (see ProfiledLock) aggregated by the lock site name: count of
+    acquisitions, count of contended acquisitions, power-of-two histograms
+    of wait and hold times in nanoseconds. Call stacks of the slowest
+    contended waits of each lock site could be sampled as well.
+
+    Profiler is disabled by default. Locks which are not wrapped into the
+    ProfiledLock are never instrumented, so they have no overhead at all.
+    Profiled locks with the disabled profiler cost a single atomic load per
+    acquisition.
+
+    Thread-safe.
+*/
+class LockProfiler
+{
+    template <class TLock>
+    friend class ProfiledLock;
+
+public:
+    //! Time histogram buckets count
+    static const size_t HISTOGRAM_SIZE = 65;
+
+    //! Sampled contended wait
+    struct Sample
+    {
+        uint64_t wait_time;                     //!< Wait time in nanoseconds
+        std::string stack_trace;                //!< Call stack of the waiting thread
+    };
+
+    //! Lock site statistics
+    struct Statistics
+    {
+        std::string name;                       //!< Lock site name
+        uint64_t acquisitions;                  //!< Total count of acquisitions
+        uint64_t contentions;                   //!< Total count of contended acquisitions
+        uint64_t wait_time;                     //!< Total wait time in nanoseconds
+        uint64_t max_wait_time;                 //!< Maximal wait time in nanoseconds
+        uint64_t holds;                         //!< Total count of measured holds (exclusive and write acquisitions)
+        uint64_t hold_time;                     //!< Total hold time in nanoseconds
+        uint64_t max_hold_time;                 //!< Maximal hold time in nanoseconds
+        uint64_t wait_histogram[HISTOGRAM_SIZE];//!< Contended wait time histogram (bucket N counts times in range [2^(N-1), 2^N))
+        uint64_t hold_histogram[HISTOGRAM_SIZE];//!< Hold time histogram (bucket N counts times in range [2^(N-1), 2^N))
+        std::vector<Sample> samples;            //!< Slowest sampled waits (from the slowest one)
+
+        //! Output lock site statistics into the given output stream
+        friend std::ostream& operator<<(std::ostream& os, const Statistics& statistics);
+    };
+
+public:
+    LockProfiler() = delete;
+    LockProfiler(const LockProfiler&) = delete;
+    LockProfiler(LockProfiler&&) = delete;
+    ~LockProfiler() = delete;
+
+    LockProfiler& operator=(const LockProfiler&) = delete;
+    LockProfiler& operator=(LockProfiler&&) = delete;
+
+    //! Is the lock contention profiler enabled?
+    static bool IsEnabled() noexcept;
+    //! Enable the lock contention profiler
+    static void Enable() noexcept;
+    //! Disable the lock contention profiler
+    static void Disable() noexcept;
+
+    //! Get the count of the slowest waits sampled with call stacks for each lock site
+    static size_t GetStackTraces() noexcept;
+    //! Set the count of the slowest waits sampled with call stacks for each lock site
+    /*!
+        Call stack is captured by the waiting thread after the lock is
+        acquired, so the sampling delays the critical section of the slow
+        waits only. Default count is zero (call stacks are not sampled).
+
+        \param count - Count of sampled waits
+    */
+    static void SetStackTraces(size_t count) noexcept;
+
+    //! Get statistics of the lock site with the given name
+    /*!
+        \param name - Lock site name
+        \return Lock site statistics (empty if the lock site is not registered)
+    */
+    static Statistics GetStatistics(const std::string& name);
+    //! Get statistics of all registered lock sites
+    /*!
+        \return Lock sites statistics sorted by total wait time (from the most contended one)
+    */
+    static std::vector<Statistics> GetStatistics();
+
+    //! Dump statistics of all registered lock sites
+    /*!
+        \param stream - Output stream
+    */
+    static void Dump(std::ostream& stream);
+    //! Dump statistics of all registered lock sites into the string
+    static std::string Dump();
+
+    //! Reset all collected statistics and sampled call stacks
+    static void Reset();
+
+private:
+    //! Register the lock site with the given name
+    static Internals::LockProfilerSite& Register(const std::string& name);
+    //! Record the lock acquisition
+    static void RecordAcquire(Internals::LockProfilerSite& site, uint64_t wait, bool contended);
+    //! Record the lock release
+    static void RecordRelease(Internals::LockProfilerSite& site, uint64_t hold) noexcept;
+};
+
+//! Profiled lock wrapper
+/*!
+    Profiled lock wraps any lock synchronization primitive (CriticalSection,
+    Mutex, SpinLock, RWLock, etc.) and records its acquisitions into the
+    lock contention profiler under the given lock site name. Several locks
+    could share the same lock site name to aggregate their statistics.
+
+    Every blocking acquisition is attempted without block first, so the
+    acquisition is counted as contended only if the lock was busy. Hold time
+    is measured for exclusive and write acquisitions only. Failed attempts
+    to acquire the lock without block are not recorded.
+
+    Profiled lock could be used with Locker, ReadLocker and WriteLocker
+    like the wrapped lock.
+
+    Thread-safe.
+*/
+template <class TLock>
+class ProfiledLock
+{
+public:
+    //! Default class constructor
+    /*!
+        \param name - Lock site name
+        \param args - Wrapped lock constructor arguments
+    */
+    template <typename... Args>
+    explicit ProfiledLock(const std::string& name, Args&&... args);
+    ProfiledLock(const ProfiledLock&) = delete;
+    ProfiledLock(ProfiledLock&&) = delete;
+    ~ProfiledLock() = default;
+
+    ProfiledLock& operator=(const ProfiledLock&) = delete;
+    ProfiledLock& operator=(ProfiledLock&&) = delete;
+
+    //! Get the wrapped lock
+    TLock& lock() noexcept { return _lock; }
+    //! Get the constant wrapped lock
+    const TLock& lock() const noexcept { return _lock; }
+
+    //! Try to acquire the lock without block
+    bool TryLock();
+    //! Acquire the lock with block
+    void Lock();
+    //! Release the lock
+    void Unlock();
+
+    //! Try to acquire the read lock without block
+    bool TryLockRead();
+    //! Acquire the read lock with block
+    void LockRead();
+    //! Release the read lock
+    void UnlockRead();
+
+    //! Try to acquire the write lock without block
+    bool TryLockWrite();
+    //! Acquire the write lock with block
+    void LockWrite();
+    //! Release the write lock
+    void UnlockWrite();
+
+private:
+    TLock _lock;
+    Internals::LockProfilerSite& _site;
+    uint64_t _acquired;
+
+    //! Acquire the lock with the given try and block operations and record the acquisition
+    template <class TTryOperation, class TOperation>
+    void Acquire(TTryOperation try_operation, TOperation operation, bool hold);
+    //! Record the release of the held lock
+    void Release() noexcept;
+};
+
+/*! \example threads_lock_profiler.cpp Lock contention profiler example */
+
+} // namespace CppCommon
+
+#include "lock_profiler.inl"
+
+#endif // CPPCOMMON_THREADS_LOCK_PROFILER_H
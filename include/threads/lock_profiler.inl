@@ -0,0 +1,143 @@
+/*!
+    \file lock_profiler.inl
+    \brief Lock contention profiler inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TLock>
+template <typename... Args>
+inline ProfiledLock<TLock>::ProfiledLock(const std::string& name, Args&&... args)
+    : _lock(std::forward<Args>(args)...),
+      _site(LockProfiler::Register(name)),
+      _acquired(0)
+{
+}
+
+template <class TLock>
+template <class TTryOperation, class TOperation>
+inline void ProfiledLock<TLock>::Acquire(TTryOperation try_operation, TOperation operation, bool hold)
+{
+    if (!LockProfiler::IsEnabled())
+    {
+        operation();
+        if (hold)
+            _acquired = 0;
+        return;
+    }
+
+    // Uncontended acquisition
+    if (try_operation())
+        LockProfiler::RecordAcquire(_site, 0, false);
+    else
+    {
+        // Contended acquisition
+        uint64_t start = Timestamp::nano();
+        operation();
+        LockProfiler::RecordAcquire(_site, Timestamp::nano() - start, true);
+    }
+
+    // Start measuring the hold time after the acquisition is recorded
+    if (hold)
+        _acquired = Timestamp::nano();
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::Release() noexcept
+{
+    // Hold time is measured while the lock is still held
+    if (_acquired != 0)
+    {
+        LockProfiler::RecordRelease(_site, Timestamp::nano() - _acquired);
+        _acquired = 0;
+    }
+}
+
+template <class TLock>
+inline bool ProfiledLock<TLock>::TryLock()
+{
+    if (!_lock.TryLock())
+        return false;
+
+    if (LockProfiler::IsEnabled())
+    {
+        LockProfiler::RecordAcquire(_site, 0, false);
+        _acquired = Timestamp::nano();
+    }
+    else
+        _acquired = 0;
+
+    return true;
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::Lock()
+{
+    Acquire([this]() { return _lock.TryLock(); }, [this]() { _lock.Lock(); }, true);
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::Unlock()
+{
+    Release();
+    _lock.Unlock();
+}
+
+template <class TLock>
+inline bool ProfiledLock<TLock>::TryLockRead()
+{
+    if (!_lock.TryLockRead())
+        return false;
+
+    if (LockProfiler::IsEnabled())
+        LockProfiler::RecordAcquire(_site, 0, false);
+
+    return true;
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::LockRead()
+{
+    Acquire([this]() { return _lock.TryLockRead(); }, [this]() { _lock.LockRead(); }, false);
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::UnlockRead()
+{
+    _lock.UnlockRead();
+}
+
+template <class TLock>
+inline bool ProfiledLock<TLock>::TryLockWrite()
+{
+    if (!_lock.TryLockWrite())
+        return false;
+
+    if (LockProfiler::IsEnabled())
+    {
+        LockProfiler::RecordAcquire(_site, 0, false);
+        _acquired = Timestamp::nano();
+    }
+    else
+        _acquired = 0;
+
+    return true;
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::LockWrite()
+{
+    Acquire([this]() { return _lock.TryLockWrite(); }, [this]() { _lock.LockWrite(); }, true);
+}
+
+template <class TLock>
+inline void ProfiledLock<TLock>::UnlockWrite()
+{
+    Release();
+    _lock.UnlockWrite();
+}
+
+} // namespace CppCommon
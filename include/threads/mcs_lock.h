@@ -0,0 +1,87 @@
+/*!
+    \file mcs_lock.h
+    \brief MCS queue lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MCS_LOCK_H
+#define CPPCOMMON_THREADS_MCS_LOCK_H
+
+#include "threads/locker.h"
+#include "threads/queue_lock_node.h"
+#include "threads/spin_wait.h"
+
+namespace CppCommon {
+
+//! MCS queue lock synchronization primitive
+/*!
+    MCS lock is a fair and scalable spin lock. Waiting threads form a linked
+    queue of nodes and each of them spins on the flag of its own node, which
+    is handed over by the predecessor on unlock. So every lock handoff touches
+    only the cache lines of two threads regardless of the number of waiting
+    threads. Threads acquire the lock in FIFO order.
+
+    Queue nodes are taken from the per-thread node cache, so the MCS lock
+    has the usual Lock()/Unlock() interface and works with Locker<>.
+
+    MCS lock must be unlocked by the thread which locked it.
+
+    Thread-safe.
+
+    https://www.cs.rochester.edu/u/scott/papers/1991_TOCS_synch.pdf
+*/
+class MCSLock
+{
+public:
+    MCSLock() noexcept : _tail(nullptr), _owner(nullptr) {}
+    MCSLock(const MCSLock&) = delete;
+    MCSLock(MCSLock&&) = delete;
+    ~MCSLock() = default;
+
+    MCSLock& operator=(const MCSLock&) = delete;
+    MCSLock& operator=(MCSLock&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the MCS lock is already locked, 'false' if the MCS lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire MCS lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the MCS lock was successfully acquired, 'false' if the MCS lock is busy
+    */
+    bool TryLock();
+
+    //! Acquire MCS lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock();
+
+    //! Release MCS lock
+    /*!
+        Will block in a spin loop if the next waiting thread is not linked yet.
+    */
+    void Unlock() noexcept;
+
+private:
+    typedef Internals::QueueLockNode Node;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<Node*> _tail;
+    Node* _owner;
+};
+
+/*! \example threads_mcs_lock.cpp MCS queue lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "mcs_lock.inl"
+
+#endif // CPPCOMMON_THREADS_MCS_LOCK_H
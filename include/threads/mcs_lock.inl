@@ -0,0 +1,82 @@
+/*!
+    \file mcs_lock.inl
+    \brief MCS queue lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool MCSLock::IsLocked() noexcept
+{
+    return (_tail.load(std::memory_order_acquire) != nullptr);
+}
+
+inline bool MCSLock::TryLock()
+{
+    if (_tail.load(std::memory_order_relaxed) != nullptr)
+        return false;
+
+    Node* node = Node::Acquire();
+    node->next.store(nullptr, std::memory_order_relaxed);
+
+    // Enqueue the node only into the empty queue
+    Node* expected = nullptr;
+    if (!_tail.compare_exchange_strong(expected, node, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        Node::Release(node);
+        return false;
+    }
+
+    _owner = node;
+    return true;
+}
+
+inline void MCSLock::Lock()
+{
+    Node* node = Node::Acquire();
+    node->next.store(nullptr, std::memory_order_relaxed);
+    node->locked.store(true, std::memory_order_relaxed);
+
+    // Enqueue the node and link it to the predecessor
+    Node* predecessor = _tail.exchange(node, std::memory_order_acq_rel);
+    if (predecessor != nullptr)
+    {
+        predecessor->next.store(node, std::memory_order_release);
+
+        // Spin on the own node until the predecessor hands the lock over
+        SpinWait spin;
+        while (node->locked.load(std::memory_order_acquire))
+            spin.Spin();
+    }
+
+    _owner = node;
+}
+
+inline void MCSLock::Unlock() noexcept
+{
+    Node* node = _owner;
+    Node* next = node->next.load(std::memory_order_acquire);
+    if (next == nullptr)
+    {
+        // Release the lock if there are no waiting threads
+        Node* expected = node;
+        if (_tail.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+        {
+            Node::Release(node);
+            return;
+        }
+
+        // Wait for the next waiting thread to link its node
+        SpinWait spin;
+        while ((next = node->next.load(std::memory_order_acquire)) == nullptr)
+            spin.Spin();
+    }
+
+    // Hand the lock over to the next waiting thread
+    next->locked.store(false, std::memory_order_release);
+    Node::Release(node);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,147 @@
+/*!
+    \file mpmc_linked_queue.h
+    \brief Multiple producers / multiple consumers lock-free linked queue definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
+#define CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
+
+#include "threads/hazard_pointers.h"
+#include "threads/spin_lock.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace CppCommon {
+
+//! Multiple producers / multiple consumers lock-free linked queue
+/*!
+    Multiple producers / multiple consumers lock-free linked queue is an unbounded
+    queue built from a linked list of fixed size array segments. Producers and
+    consumers claim slots in the tail and head segments with a single atomic
+    fetch-and-add operation, so contended threads do not retry CAS loops on the
+    same pointer. A new segment is linked only when the tail segment is full.
+
+    Drained segments are retired into the hazard pointers domain of the queue and
+    recycled for new segments once no thread accesses them anymore.
+
+    FIFO order is guaranteed!
+
+    Thread-safe.
+
+    C++ implementation of Pedro Ramalhete and Andreia Correia FAAArrayQueue
+    https://github.com/pramalhe/ConcurrencyFreaks/blob/master/CPP/queues/array/FAAArrayQueue.hpp
+*/
+template<typename T>
+class MPMCLinkedQueue
+{
+public:
+    //! Default class constructor
+    /*!
+        \param segment - Segment size in items (default is 1024)
+    */
+    explicit MPMCLinkedQueue(size_t segment = 1024);
+    MPMCLinkedQueue(const MPMCLinkedQueue&) = delete;
+    MPMCLinkedQueue(MPMCLinkedQueue&&) = delete;
+    ~MPMCLinkedQueue();
+
+    MPMCLinkedQueue& operator=(const MPMCLinkedQueue&) = delete;
+    MPMCLinkedQueue& operator=(MPMCLinkedQueue&&) = delete;
+
+    //! Get segment size in items
+    size_t segment() const noexcept { return _segment; }
+
+    //! Enqueue an item into the linked queue (multiple producers threads method)
+    /*!
+        The item will be copied into the linked queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(const T& item);
+    //! Enqueue an item into the linked queue (multiple producers threads method)
+    /*!
+        The item will be moved into the linked queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if there is no enough memory for the queue segment
+    */
+    bool Enqueue(T&& item);
+
+    //! Dequeue an item from the linked queue (multiple consumers threads method)
+    /*!
+        The item will be moved from the linked queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the linked queue is empty
+    */
+    bool Dequeue(T& item);
+
+private:
+    // Slot states
+    static const uint32_t EMPTY = 0;
+    static const uint32_t READY = 1;
+    static const uint32_t TAKEN = 2;
+
+    // Maximal count of recycled segments
+    static const size_t POOL_SIZE = 16;
+
+    struct Slot
+    {
+        std::atomic<uint32_t> state;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* item() noexcept { return std::launder((T*)storage); }
+    };
+
+    struct Segment
+    {
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue;
+        std::atomic<Segment*> next;
+        std::unique_ptr<Slot[]> slots;
+
+        explicit Segment(size_t size) : dequeue(0), enqueue(0), next(nullptr), slots(new (std::nothrow) Slot[size])
+        {
+            if (slots)
+                for (size_t i = 0; i < size; ++i)
+                    slots[i].state.store(EMPTY, std::memory_order_relaxed);
+        }
+    };
+
+    const size_t _segment;
+    SpinLock _pool_lock;
+    std::vector<std::unique_ptr<Segment>> _pool;
+    // Hazard pointers domain is destroyed before the pool to recycle pending segments into it
+    HazardPointers _hazards;
+    alignas(CACHE_LINE_SIZE) std::atomic<Segment*> _head;
+    alignas(CACHE_LINE_SIZE) std::atomic<Segment*> _tail;
+
+    //! Allocate a new segment or take the recycled one (nullptr if there is no enough memory)
+    Segment* Allocate();
+    //! Recycle the unused segment
+    void Recycle(Segment* segment);
+};
+
+/*! \example threads_mpmc_linked_queue.cpp Multiple producers / multiple consumers lock-free linked queue example */
+
+} // namespace CppCommon
+
+#include "mpmc_linked_queue.inl"
+
+#endif // CPPCOMMON_THREADS_MPMC_LINKED_QUEUE_H
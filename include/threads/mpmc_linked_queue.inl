@@ -0,0 +1,198 @@
+/*!
+    \file mpmc_linked_queue.inl
+    \brief Multiple producers / multiple consumers lock-free linked queue inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline MPMCLinkedQueue<T>::MPMCLinkedQueue(size_t segment) : _segment(segment), _head(nullptr), _tail(nullptr)
+{
+    assert((segment > 1) && "Segment size must be greater than one!");
+
+    // Linked queue is initialized with an empty segment
+    Segment* front = Allocate();
+    if (front == nullptr)
+        throw std::bad_alloc();
+    _head.store(front, std::memory_order_relaxed);
+    _tail.store(front, std::memory_order_relaxed);
+}
+
+template<typename T>
+inline MPMCLinkedQueue<T>::~MPMCLinkedQueue()
+{
+    // Remove all items from the linked queue
+    T item;
+    while (Dequeue(item)) {}
+
+    // Remove all linked segments
+    Segment* segment = _head.load(std::memory_order_relaxed);
+    while (segment != nullptr)
+    {
+        Segment* next = segment->next.load(std::memory_order_relaxed);
+        delete segment;
+        segment = next;
+    }
+}
+
+template<typename T>
+inline bool MPMCLinkedQueue<T>::Enqueue(const T& item)
+{
+    T temp = item;
+    return Enqueue(std::forward<T>(temp));
+}
+
+template<typename T>
+inline bool MPMCLinkedQueue<T>::Enqueue(T&& item)
+{
+    HazardPointers::Guard guard(_hazards);
+
+    for (;;)
+    {
+        Segment* tail = guard.Protect(0, _tail);
+
+        // Claim the slot in the tail segment
+        size_t index = tail->enqueue.fetch_add(1, std::memory_order_relaxed);
+        if (index < _segment)
+        {
+            Slot& slot = tail->slots[index];
+            new (slot.storage) T(std::move(item));
+
+            uint32_t expected = EMPTY;
+            if (slot.state.compare_exchange_strong(expected, READY, std::memory_order_release, std::memory_order_relaxed))
+                return true;
+
+            // The slot was abandoned by the consumer, so take the item back and retry
+            item = std::move(*slot.item());
+            slot.item()->~T();
+            continue;
+        }
+
+        // The tail segment is full
+        if (tail != _tail.load(std::memory_order_acquire))
+            continue;
+
+        Segment* next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            // Help to advance the tail segment
+            _tail.compare_exchange_strong(tail, next, std::memory_order_acq_rel);
+            continue;
+        }
+
+        // Create a new tail segment with the item in the first slot
+        Segment* segment = Allocate();
+        if (segment == nullptr)
+            return false;
+
+        Slot& slot = segment->slots[0];
+        new (slot.storage) T(std::move(item));
+        slot.state.store(READY, std::memory_order_relaxed);
+        segment->enqueue.store(1, std::memory_order_relaxed);
+
+        Segment* expected = nullptr;
+        if (tail->next.compare_exchange_strong(expected, segment, std::memory_order_acq_rel))
+        {
+            _tail.compare_exchange_strong(tail, segment, std::memory_order_acq_rel);
+            return true;
+        }
+
+        // Another producer linked its segment first, so take the item back and retry
+        item = std::move(*slot.item());
+        slot.item()->~T();
+        Recycle(segment);
+    }
+}
+
+template<typename T>
+inline bool MPMCLinkedQueue<T>::Dequeue(T& item)
+{
+    HazardPointers::Guard guard(_hazards);
+
+    for (;;)
+    {
+        Segment* head = guard.Protect(0, _head);
+
+        // Check if the linked queue is empty
+        if ((head->dequeue.load(std::memory_order_acquire) >= head->enqueue.load(std::memory_order_acquire)) && (head->next.load(std::memory_order_acquire) == nullptr))
+            return false;
+
+        // Claim the slot in the head segment
+        size_t index = head->dequeue.fetch_add(1, std::memory_order_relaxed);
+        if (index < _segment)
+        {
+            // Take the item or abandon the slot if the producer has not published it yet
+            Slot& slot = head->slots[index];
+            if (slot.state.exchange(TAKEN, std::memory_order_acq_rel) == READY)
+            {
+                item = std::move(*slot.item());
+                slot.item()->~T();
+                return true;
+            }
+            continue;
+        }
+
+        // The head segment is drained
+        Segment* next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+
+        // Make sure the tail segment is not left behind the head one
+        Segment* tail = head;
+        _tail.compare_exchange_strong(tail, next, std::memory_order_acq_rel);
+
+        // Advance the head segment and retire the drained one
+        if (_head.compare_exchange_strong(head, next, std::memory_order_acq_rel))
+            guard.Retire(head, [](void* ptr, void* context) { ((MPMCLinkedQueue*)context)->Recycle((Segment*)ptr); }, this);
+    }
+}
+
+template<typename T>
+inline typename MPMCLinkedQueue<T>::Segment* MPMCLinkedQueue<T>::Allocate()
+{
+    {
+        Locker<SpinLock> locker(_pool_lock);
+        if (!_pool.empty())
+        {
+            Segment* segment = _pool.back().release();
+            _pool.pop_back();
+            return segment;
+        }
+    }
+
+    // Enqueue reports the lack of memory with the 'false' result, so allocate without exceptions
+    Segment* segment = new (std::nothrow) Segment(_segment);
+    if ((segment != nullptr) && !segment->slots)
+    {
+        delete segment;
+        segment = nullptr;
+    }
+    return segment;
+}
+
+template<typename T>
+inline void MPMCLinkedQueue<T>::Recycle(Segment* segment)
+{
+    // Reset the segment
+    for (size_t i = 0; i < _segment; ++i)
+        segment->slots[i].state.store(EMPTY, std::memory_order_relaxed);
+    segment->dequeue.store(0, std::memory_order_relaxed);
+    segment->enqueue.store(0, std::memory_order_relaxed);
+    segment->next.store(nullptr, std::memory_order_relaxed);
+
+    {
+        Locker<SpinLock> locker(_pool_lock);
+        if (_pool.size() < POOL_SIZE)
+        {
+            _pool.emplace_back(segment);
+            return;
+        }
+    }
+
+    delete segment;
+}
+
+} // namespace CppCommon
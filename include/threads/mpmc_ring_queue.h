@@ -75,6 +75,19 @@ public:
         \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
     */
     bool Enqueue(T&& item);
+    //! Enqueue a bulk of items into the ring queue (multiple producers threads method)
+    /*!
+        Items will be moved into the ring queue. The contiguous range of free
+        slots is claimed with a single compare-and-swap of the head cursor.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param count - Count of items to enqueue
+        \return Count of successfully enqueued items (less than the given count if the ring queue is full)
+    */
+    template <class InputIterator>
+    size_t EnqueueBulk(InputIterator first, size_t count);
 
     //! Dequeue an item from the ring queue (multiple consumers threads method)
     /*!
@@ -86,6 +99,19 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
     */
     bool Dequeue(T& item);
+    //! Dequeue a bulk of items from the ring queue (multiple consumers threads method)
+    /*!
+        Items will be moved from the ring queue. The contiguous range of filled
+        slots is claimed with a single compare-and-swap of the tail cursor.
+
+        Will not block.
+
+        \param first - Output iterator to store dequeued items
+        \param count - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (zero if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator first, size_t count);
 
 private:
     struct Node
@@ -85,6 +85,66 @@ inline bool MPMCRingQueue<T>::Enqueue(T&& item)
     return false;
 }
 
+template<typename T>
+template <class InputIterator>
+inline size_t MPMCRingQueue<T>::EnqueueBulk(InputIterator first, size_t count)
+{
+    if (count == 0)
+        return 0;
+
+    size_t head_sequence = _head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count contiguous empty slots starting from the head sequence
+        size_t available = 0;
+        while (available < count)
+        {
+            Node* node = &_buffer[(head_sequence + available) & _mask];
+            size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+            if (node_sequence != (head_sequence + available))
+                break;
+            ++available;
+        }
+
+        if (available > 0)
+        {
+            // Claim all available slots with a single head move
+            if (_head.compare_exchange_weak(head_sequence, head_sequence + available, std::memory_order_relaxed))
+            {
+                for (size_t i = 0; i < available; ++i, ++first)
+                {
+                    Node* node = &_buffer[(head_sequence + i) & _mask];
+
+                    // Store the item value
+                    node->value = std::move(*first);
+
+                    // Increment the sequence so that the tail knows it's accessible
+                    node->sequence.store(head_sequence + i + 1, std::memory_order_release);
+                }
+                return available;
+            }
+        }
+        else
+        {
+            Node* node = &_buffer[head_sequence & _mask];
+            size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+
+            // If node sequence is less than head sequence then it means this slot is full
+            // and therefore buffer is full
+            int64_t diff = (int64_t)node_sequence - (int64_t)head_sequence;
+            if (diff < 0)
+                return 0;
+
+            // Otherwise another producer has already claimed this slot
+            head_sequence = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Never happens...
+    return 0;
+}
+
 template<typename T>
 inline bool MPMCRingQueue<T>::Dequeue(T& item)
 {
@@ -129,4 +189,64 @@ inline bool MPMCRingQueue<T>::Dequeue(T& item)
     return false;
 }
 
+template<typename T>
+template <class OutputIterator>
+inline size_t MPMCRingQueue<T>::DequeueBulk(OutputIterator first, size_t count)
+{
+    if (count == 0)
+        return 0;
+
+    size_t tail_sequence = _tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        // Count contiguous filled slots starting from the tail sequence
+        size_t available = 0;
+        while (available < count)
+        {
+            Node* node = &_buffer[(tail_sequence + available) & _mask];
+            size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+            if (node_sequence != (tail_sequence + available + 1))
+                break;
+            ++available;
+        }
+
+        if (available > 0)
+        {
+            // Claim all available slots with a single tail move
+            if (_tail.compare_exchange_weak(tail_sequence, tail_sequence + available, std::memory_order_relaxed))
+            {
+                for (size_t i = 0; i < available; ++i, ++first)
+                {
+                    Node* node = &_buffer[(tail_sequence + i) & _mask];
+
+                    // Get the item value
+                    *first = std::move(node->value);
+
+                    // Set the sequence to what the head sequence should be next time around
+                    node->sequence.store(tail_sequence + i + _mask + 1, std::memory_order_release);
+                }
+                return available;
+            }
+        }
+        else
+        {
+            Node* node = &_buffer[tail_sequence & _mask];
+            size_t node_sequence = node->sequence.load(std::memory_order_acquire);
+
+            // If node sequence is less than the expected one then it means this slot is empty
+            // and therefore buffer is empty
+            int64_t diff = (int64_t)node_sequence - (int64_t)(tail_sequence + 1);
+            if (diff < 0)
+                return 0;
+
+            // Otherwise another consumer has already claimed this slot
+            tail_sequence = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Never happens...
+    return 0;
+}
+
 } // namespace CppCommon
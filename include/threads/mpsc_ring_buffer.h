@@ -9,9 +9,9 @@
 #ifndef CPPCOMMON_THREADS_MPSC_RING_BUFFER_H
 #define CPPCOMMON_THREADS_MPSC_RING_BUFFER_H
 
+#include "threads/producer_lanes.h"
 #include "threads/spin_lock.h"
 #include "threads/spsc_ring_buffer.h"
-#include "time/timestamp.h"
 
 #include <cstdio>
 #include <memory>
@@ -23,10 +23,15 @@ namespace CppCommon {
 //! Multiple producers / single consumer wait-free ring buffer
 /*!
     Multiple producers / single consumer wait-free ring buffer use only atomic operations to provide thread-safe
-    enqueue and dequeue operations. This data structure consist of several SPSC ring buffers which count is
-    provided as a hardware concurrency in the constructor. All of them are randomly accessed with a RDTS
-    distribution index. All the items available in sesequential or batch mode. All ring buffer sizes are
-    limited to the capacity provided in the constructor.
+    enqueue and dequeue operations. This data structure consist of several SPSC ring buffers (lanes) which
+    count is provided as a hardware concurrency in the constructor. Every producer thread is registered in
+    its own dedicated lane on the first enqueue, so producers share lanes only if their count exceeds the
+    concurrency. The consumer visits only non-empty lanes (tracked by a bitmap) in round-robin order. All
+    the items available in sesequential or batch mode. All ring buffer sizes are limited to the capacity
+    provided in the constructor.
+
+    Reserve()/Commit() and Peek()/Release() methods provide zero-copy access
+    to producers' ring buffers memory (see SPSCRingBuffer for details).
 
     FIFO order is not guaranteed!
 
@@ -39,8 +44,9 @@ public:
     /*!
         \param capacity - Ring buffer capacity (must be a power of two)
         \param concurrency - Hardware concurrency (default is std::thread::hardware_concurrency)
+        \param mirrored - Mirrored mode flag (default is false)
     */
-    explicit MPSCRingBuffer(size_t capacity, size_t concurrency = std::thread::hardware_concurrency());
+    explicit MPSCRingBuffer(size_t capacity, size_t concurrency = std::thread::hardware_concurrency(), bool mirrored = false);
     MPSCRingBuffer(const MPSCRingBuffer&) = delete;
     MPSCRingBuffer(MPSCRingBuffer&&) = delete;
     ~MPSCRingBuffer() = default;
@@ -73,6 +79,25 @@ public:
     */
     bool Enqueue(const void* chunk, size_t size);
 
+    //! Reserve a contiguous region of the ring buffer to write (multiple producers threads method)
+    /*!
+        The producer's lane stays locked until the reserved region is committed, so the Commit() method must be called for every
+        successful reservation.
+
+        Will not block.
+
+        \param size - Requested region size, will be updated with the reserved region size
+        \param producer - Producer index of the reservation, must be passed to the Commit() method
+        \return Pointer to the reserved region or nullptr if there is no requested free space in the ring buffer
+    */
+    void* Reserve(size_t& size, size_t& producer);
+    //! Commit the previously reserved region of the ring buffer (multiple producers threads method)
+    /*!
+        \param size - Committed region size (must not be greater than the reserved region size)
+        \param producer - Producer index of the reservation
+    */
+    void Commit(size_t size, size_t producer);
+
     //! Dequeue a chunk of bytes from the ring buffer (single consumer thread method)
     /*!
         The chunk of bytes will be copied from the ring buffer using 'memcpy()' function.
@@ -85,19 +110,37 @@ public:
     */
     bool Dequeue(void* chunk, size_t& size);
 
+    //! Peek a contiguous region of the ring buffer to read (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param size - Peeked region size
+        \return Pointer to the peeked region or nullptr if the ring buffer is empty
+    */
+    const void* Peek(size_t& size);
+    //! Release the previously peeked region of the ring buffer (single consumer thread method)
+    /*!
+        \param size - Released region size (must not be greater than the peeked region size)
+    */
+    void Release(size_t size);
+
 private:
     struct Producer
     {
         SpinLock lock;
         SPSCRingBuffer buffer;
 
-        Producer(size_t capacity) : buffer(capacity) {}
+        Producer(size_t capacity, bool mirrored) : buffer(capacity, mirrored) {}
     };
 
     size_t _capacity;
     size_t _concurrency;
     std::vector<std::shared_ptr<Producer>> _producers;
+    ProducerLanes _lanes;
     size_t _consumer;
+
+    //! Find the next non-empty lane starting from the given one (consumer thread method)
+    size_t NextLane(size_t start) noexcept;
 };
 
 /*! \example threads_mpsc_ring_buffer.cpp Multiple producers / single consumer wait-free ring buffer example */
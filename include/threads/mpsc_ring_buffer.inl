@@ -8,11 +8,11 @@
 
 namespace CppCommon {
 
-inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0)
+inline MPSCRingBuffer::MPSCRingBuffer(size_t capacity, size_t concurrency, bool mirrored) : _capacity(capacity - 1), _concurrency(concurrency), _lanes(concurrency), _consumer(0)
 {
     // Initialize producers' ring buffer
     for (size_t i = 0; i < concurrency; ++i)
-        _producers.push_back(std::make_shared<Producer>(capacity));
+        _producers.push_back(std::make_shared<Producer>(capacity, mirrored));
 }
 
 inline size_t MPSCRingBuffer::size() const noexcept
@@ -25,23 +25,65 @@ inline size_t MPSCRingBuffer::size() const noexcept
 
 inline bool MPSCRingBuffer::Enqueue(const void* chunk, size_t size)
 {
-    // Get producer index for the current thread based on RDTS value
-    size_t index = Timestamp::rdts() % _concurrency;
+    // Get the dedicated lane of the current producer thread
+    size_t lane = _lanes.Lane();
 
-    // Lock the chosen producer using its spin-lock
-    Locker<SpinLock> lock(_producers[index]->lock);
+    {
+        // Lock the lane using its spin-lock (uncontended unless producers share the lane)
+        Locker<SpinLock> lock(_producers[lane]->lock);
+
+        // Enqueue the item into the producer's ring buffer
+        if (!_producers[lane]->buffer.Enqueue(chunk, size))
+            return false;
+    }
 
-    // Enqueue the item into the producer's ring buffer
-    return _producers[index]->buffer.Enqueue(chunk, size);
+    // Mark the lane as non-empty for the consumer
+    _lanes.Mark(lane);
+    return true;
+}
+
+inline void* MPSCRingBuffer::Reserve(size_t& size, size_t& producer)
+{
+    // Get the dedicated lane of the current producer thread
+    producer = _lanes.Lane();
+
+    // Lock the lane using its spin-lock until the commit
+    _producers[producer]->lock.Lock();
+
+    // Reserve the region in the producer's ring buffer
+    void* result = _producers[producer]->buffer.Reserve(size);
+    if (result == nullptr)
+        _producers[producer]->lock.Unlock();
+
+    return result;
+}
+
+inline void MPSCRingBuffer::Commit(size_t size, size_t producer)
+{
+    assert((producer < _concurrency) && "Invalid producer index!");
+
+    // Commit the region in the producer's ring buffer and unlock it
+    _producers[producer]->buffer.Commit(size);
+    _producers[producer]->lock.Unlock();
+
+    // Mark the lane as non-empty for the consumer
+    if (size > 0)
+        _lanes.Mark(producer);
 }
 
 inline bool MPSCRingBuffer::Dequeue(void* chunk, size_t& size)
 {
-    // Try to dequeue one item from the one of producer's ring buffers
+    // Try to dequeue one item from the next non-empty lane
     for (size_t i = 0; i < _concurrency; ++i)
     {
+        size_t lane = NextLane(_consumer);
+        if (lane == _concurrency)
+            break;
+
+        _consumer = (lane + 1) % _concurrency;
+
         size_t temp = size;
-        if (_producers[_consumer++ % _concurrency]->buffer.Dequeue(chunk, temp))
+        if (_producers[lane]->buffer.Dequeue(chunk, temp))
         {
             size = temp;
             return true;
@@ -52,4 +94,55 @@ inline bool MPSCRingBuffer::Dequeue(void* chunk, size_t& size)
     return false;
 }
 
+inline const void* MPSCRingBuffer::Peek(size_t& size)
+{
+    // Try to peek the region from the next non-empty lane
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        size_t lane = NextLane(_consumer);
+        if (lane == _concurrency)
+            break;
+
+        _consumer = lane;
+
+        const void* result = _producers[lane]->buffer.Peek(size);
+        if (result != nullptr)
+            return result;
+
+        _consumer = (lane + 1) % _concurrency;
+    }
+
+    size = 0;
+    return nullptr;
+}
+
+inline void MPSCRingBuffer::Release(size_t size)
+{
+    // Release the region in the last peeked lane
+    _producers[_consumer]->buffer.Release(size);
+    _consumer = (_consumer + 1) % _concurrency;
+}
+
+inline size_t MPSCRingBuffer::NextLane(size_t start) noexcept
+{
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        size_t lane = _lanes.Next(start);
+        if ((lane == _concurrency) || !_producers[lane]->buffer.empty())
+            return lane;
+
+        // Clear the mark of the empty lane and re-check it to catch the concurrent enqueue
+        _lanes.Clear(lane);
+        if (!_producers[lane]->buffer.empty())
+        {
+            _lanes.Mark(lane);
+            return lane;
+        }
+
+        start = (lane + 1) % _concurrency;
+    }
+
+    return _concurrency;
+}
+
 } // namespace CppCommon
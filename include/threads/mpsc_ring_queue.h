@@ -9,10 +9,11 @@
 #ifndef CPPCOMMON_THREADS_MPSC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_MPSC_RING_QUEUE_H
 
+#include "threads/producer_lanes.h"
 #include "threads/spin_lock.h"
 #include "threads/spsc_ring_queue.h"
-#include "time/timestamp.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <functional>
@@ -26,12 +27,16 @@ namespace CppCommon {
 //! Multiple producers / single consumer wait-free ring queue
 /*!
     Multiple producers / single consumer wait-free ring queue use only atomic operations to provide thread-safe
-    enqueue and dequeue operations. This data structure consist of several SPSC ring queues which count is
-    provided as a hardware concurrency in the constructor. All of them are randomly accessed with a RDTS
-    distribution index. All the items available in sesequential or batch mode. All ring queue sizes are
-    limited to the capacity provided in the constructor.
+    enqueue and dequeue operations. This data structure consist of several SPSC ring queues (lanes) which
+    count is provided as a hardware concurrency in the constructor. Every producer thread is registered in
+    its own dedicated lane on the first enqueue, so producers share lanes only if their count exceeds the
+    concurrency. The consumer visits only non-empty lanes (tracked by a bitmap) in round-robin order. All
+    the items available in sesequential or batch mode. All ring queue sizes are limited to the capacity
+    provided in the constructor.
 
-    FIFO order is not guaranteed!
+    FIFO order is guaranteed only for items of the same producer! In ordered mode every item is stamped
+    with a global sequence number and the consumer dequeues items in the order of their sequence numbers,
+    so the global FIFO order is guaranteed at the cost of a shared counter update for each enqueue.
 
     Thread-safe.
 */
@@ -43,8 +48,9 @@ public:
     /*!
         \param capacity - Ring queue capacity (must be a power of two)
         \param concurrency - Hardware concurrency (default is std::thread::hardware_concurrency)
+        \param ordered - Global ordering mode flag (default is false)
     */
-    explicit MPSCRingQueue(size_t capacity, size_t concurrency = std::thread::hardware_concurrency());
+    explicit MPSCRingQueue(size_t capacity, size_t concurrency = std::thread::hardware_concurrency(), bool ordered = false);
     MPSCRingQueue(const MPSCRingQueue&) = delete;
     MPSCRingQueue(MPSCRingQueue&&) = delete;
     ~MPSCRingQueue() = default;
@@ -61,6 +67,8 @@ public:
     size_t capacity() const noexcept { return _capacity; }
     //! Get ring queue concurrency
     size_t concurrency() const noexcept { return _concurrency; }
+    //! Is ring queue in global ordering mode?
+    bool ordered() const noexcept { return _ordered; }
     //! Get ring queue size
     size_t size() const noexcept;
 
@@ -84,6 +92,19 @@ public:
         \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
     */
     bool Enqueue(T&& item);
+    //! Enqueue a bulk of items into the ring queue (multiple producers threads method)
+    /*!
+        Items will be moved into the ring queue. All items are enqueued into
+        the producer's lane with a single update of its cursor.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param count - Count of items to enqueue
+        \return Count of successfully enqueued items (less than the given count if the ring queue is full)
+    */
+    template <class InputIterator>
+    size_t EnqueueBulk(InputIterator first, size_t count);
 
     //! Dequeue an item from the ring queue (single consumer threads method)
     /*!
@@ -95,6 +116,20 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
     */
     bool Dequeue(T& item);
+    //! Dequeue a bulk of items from the ring queue (single consumer thread method)
+    /*!
+        Items will be moved from the ring queue. Items are dequeued from
+        non-empty lanes in turn with a single cursor update per lane
+        (item by item in ordered mode).
+
+        Will not block.
+
+        \param first - Output iterator to store dequeued items
+        \param count - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (zero if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator first, size_t count);
 
     //! Dequeue all items from the linked queue (single consumer thread method)
     /*!
@@ -112,14 +147,30 @@ private:
     {
         SpinLock lock;
         SPSCRingQueue<T> queue;
+        // Sequence numbers of enqueued items (ordered mode only)
+        std::unique_ptr<SPSCRingQueue<uint64_t>> sequences;
+        // Sequence number of the lane head item staged by the consumer (ordered mode only)
+        bool staged;
+        uint64_t sequence;
 
-        Producer(size_t capacity) : queue(capacity) {}
+        Producer(size_t capacity, bool ordered) : queue(capacity), sequences(ordered ? new SPSCRingQueue<uint64_t>(capacity) : nullptr), staged(false), sequence(0) {}
     };
 
     size_t _capacity;
     size_t _concurrency;
+    bool _ordered;
     std::vector<std::shared_ptr<Producer>> _producers;
+    ProducerLanes _lanes;
     size_t _consumer;
+    uint64_t _expected;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> _sequence;
+
+    //! Check if the given lane is empty (consumer thread method)
+    bool IsLaneEmpty(size_t lane) const noexcept;
+    //! Find the next non-empty lane starting from the given one (consumer thread method)
+    size_t NextLane(size_t start) noexcept;
+    //! Dequeue the next item in the global order (consumer thread method)
+    bool DequeueOrdered(T& item);
 };
 
 /*! \example threads_mpsc_ring_queue.cpp Multiple producers / single consumer wait-free ring queue example */
@@ -9,11 +9,12 @@
 namespace CppCommon {
 
 template<typename T>
-inline MPSCRingQueue<T>::MPSCRingQueue(size_t capacity, size_t concurrency) : _capacity(capacity - 1), _concurrency(concurrency), _consumer(0)
+inline MPSCRingQueue<T>::MPSCRingQueue(size_t capacity, size_t concurrency, bool ordered)
+    : _capacity(capacity - 1), _concurrency(concurrency), _ordered(ordered), _lanes(concurrency), _consumer(0), _expected(0), _sequence(0)
 {
     // Initialize producers' ring queue
     for (size_t i = 0; i < concurrency; ++i)
-        _producers.push_back(std::make_shared<Producer>(capacity));
+        _producers.push_back(std::make_shared<Producer>(capacity, ordered));
 }
 
 template<typename T>
@@ -35,29 +36,128 @@ inline bool MPSCRingQueue<T>::Enqueue(const T& item)
 template<typename T>
 inline bool MPSCRingQueue<T>::Enqueue(T&& item)
 {
-    // Get producer index for the current thread based on RDTS value
-    size_t index = Timestamp::rdts() % _concurrency;
+    // Get the dedicated lane of the current producer thread
+    size_t lane = _lanes.Lane();
+    Producer& producer = *_producers[lane];
 
-    // Lock the chosen producer using its spin-lock
-    Locker<SpinLock> lock(_producers[index]->lock);
+    {
+        // Lock the lane using its spin-lock (uncontended unless producers share the lane)
+        Locker<SpinLock> lock(producer.lock);
+
+        if (_ordered)
+        {
+            // Take the sequence number only if the item will be surely enqueued,
+            // otherwise the consumer will wait for the missed sequence number forever
+            if (producer.queue.size() >= _capacity)
+                return false;
+
+            uint64_t sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+            producer.queue.Enqueue(std::forward<T>(item));
+            producer.sequences->Enqueue(sequence);
+        }
+        else if (!producer.queue.Enqueue(std::forward<T>(item)))
+            return false;
+    }
+
+    // Mark the lane as non-empty for the consumer
+    _lanes.Mark(lane);
+    return true;
+}
+
+template<typename T>
+template <class InputIterator>
+inline size_t MPSCRingQueue<T>::EnqueueBulk(InputIterator first, size_t count)
+{
+    // Get the dedicated lane of the current producer thread
+    size_t lane = _lanes.Lane();
+    Producer& producer = *_producers[lane];
 
-    // Enqueue the item into the producer's ring queue
-    return _producers[index]->queue.Enqueue(std::forward<T>(item));
+    size_t result;
+
+    {
+        // Lock the lane using its spin-lock (uncontended unless producers share the lane)
+        Locker<SpinLock> lock(producer.lock);
+
+        if (_ordered)
+        {
+            // Take sequence numbers only for items which will be surely enqueued
+            count = std::min(count, _capacity - producer.queue.size());
+            if (count == 0)
+                return 0;
+
+            uint64_t sequence = _sequence.fetch_add(count, std::memory_order_relaxed);
+            result = producer.queue.EnqueueBulk(first, count);
+            for (size_t i = 0; i < result; ++i)
+                producer.sequences->Enqueue(sequence + i);
+        }
+        else
+            result = producer.queue.EnqueueBulk(first, count);
+    }
+
+    // Mark the lane as non-empty for the consumer
+    if (result > 0)
+        _lanes.Mark(lane);
+
+    return result;
 }
 
 template<typename T>
 inline bool MPSCRingQueue<T>::Dequeue(T& item)
 {
-    // Try to dequeue one item from the one of producer's ring queue
+    if (_ordered)
+        return DequeueOrdered(item);
+
+    // Try to dequeue one item from the next non-empty lane
     for (size_t i = 0; i < _concurrency; ++i)
     {
-        if (_producers[_consumer++ % _concurrency]->queue.Dequeue(item))
+        size_t lane = NextLane(_consumer);
+        if (lane == _concurrency)
+            return false;
+
+        _consumer = (lane + 1) % _concurrency;
+        if (_producers[lane]->queue.Dequeue(item))
             return true;
     }
 
     return false;
 }
 
+template<typename T>
+template <class OutputIterator>
+inline size_t MPSCRingQueue<T>::DequeueBulk(OutputIterator first, size_t count)
+{
+    size_t result = 0;
+
+    if (_ordered)
+    {
+        // Dequeue items one by one in the global order
+        T item;
+        while ((result < count) && DequeueOrdered(item))
+        {
+            *first = std::move(item);
+            ++first;
+            ++result;
+        }
+        return result;
+    }
+
+    // Try to dequeue items from non-empty lanes in turn
+    for (size_t i = 0; (i < _concurrency) && (result < count); ++i)
+    {
+        size_t lane = NextLane(_consumer);
+        if (lane == _concurrency)
+            break;
+
+        _consumer = (lane + 1) % _concurrency;
+        size_t dequeued = _producers[lane]->queue.DequeueBulk(first, count - result);
+        for (size_t j = 0; j < dequeued; ++j)
+            ++first;
+        result += dequeued;
+    }
+
+    return result;
+}
+
 template<typename T>
 inline bool MPSCRingQueue<T>::Dequeue(const std::function<void(const T&)>& handler)
 {
@@ -65,18 +165,103 @@ inline bool MPSCRingQueue<T>::Dequeue(const std::function<void(const T&)>& handl
 
     bool result = false;
 
-    // Consume all available items from producers' ring queues
-    for (auto& producer : _producers)
+    T item;
+
+    if (_ordered)
     {
-        T item;
-        while (producer->queue.Dequeue(item))
+        // Consume all available items in the global order
+        while (DequeueOrdered(item))
         {
             handler(item);
             result = true;
         }
+        return result;
+    }
+
+    // Consume all available items from non-empty lanes
+    size_t start = 0;
+    while (start < _concurrency)
+    {
+        size_t lane = NextLane(start);
+        if ((lane == _concurrency) || (lane < start))
+            break;
+
+        while (_producers[lane]->queue.Dequeue(item))
+        {
+            handler(item);
+            result = true;
+        }
+
+        start = lane + 1;
     }
 
     return result;
 }
 
+template<typename T>
+inline bool MPSCRingQueue<T>::IsLaneEmpty(size_t lane) const noexcept
+{
+    const Producer& producer = *_producers[lane];
+    if (_ordered)
+        return !producer.staged && producer.sequences->empty();
+    else
+        return producer.queue.empty();
+}
+
+template<typename T>
+inline size_t MPSCRingQueue<T>::NextLane(size_t start) noexcept
+{
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        size_t lane = _lanes.Next(start);
+        if ((lane == _concurrency) || !IsLaneEmpty(lane))
+            return lane;
+
+        // Clear the mark of the empty lane and re-check it to catch the concurrent enqueue
+        _lanes.Clear(lane);
+        if (!IsLaneEmpty(lane))
+        {
+            _lanes.Mark(lane);
+            return lane;
+        }
+
+        start = (lane + 1) % _concurrency;
+    }
+
+    return _concurrency;
+}
+
+template<typename T>
+inline bool MPSCRingQueue<T>::DequeueOrdered(T& item)
+{
+    // Start from the lane of the last dequeued item, it likely has the next one
+    size_t lane = _consumer;
+
+    for (size_t i = 0; i < _concurrency; ++i)
+    {
+        lane = NextLane(lane);
+        if (lane == _concurrency)
+            return false;
+
+        // Stage the sequence number of the lane head item
+        Producer& producer = *_producers[lane];
+        if (!producer.staged)
+            producer.staged = producer.sequences->Dequeue(producer.sequence);
+
+        // Items are enqueued before their sequence numbers, so the staged item is available
+        if (producer.staged && (producer.sequence == _expected) && producer.queue.Dequeue(item))
+        {
+            producer.staged = false;
+            ++_expected;
+            _consumer = lane;
+            return true;
+        }
+
+        lane = (lane + 1) % _concurrency;
+    }
+
+    // The next item in the global order is not published yet
+    return false;
+}
+
 } // namespace CppCommon
@@ -0,0 +1,125 @@
+/*!
+    \file named_robust_mutex.h
+    \brief Named robust mutex synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_NAMED_ROBUST_MUTEX_H
+#define CPPCOMMON_THREADS_NAMED_ROBUST_MUTEX_H
+
+#include "threads/locker.h"
+#include "time/timestamp.h"
+
+#include <memory>
+#include <string>
+
+namespace CppCommon {
+
+//! Named robust mutex synchronization primitive
+/*!
+    Named robust mutex behaves as a named mutex, but survives the death of
+    the owner thread or process. If the owner dies while holding the mutex,
+    the next locking thread acquires the mutex and recovered() returns 'true'
+    to signal that the shared state protected by the mutex could be
+    inconsistent and must be repaired.
+
+    On Linux the mutex is a process-shared robust priority-inheritance
+    pthread mutex in the shared memory. Uncontended lock and unlock are
+    single atomic operations in user space without system calls, contended
+    waiters are parked in the kernel. The locked mutex is registered in the
+    robust list of the owner thread, so the kernel marks it with the
+    FUTEX_OWNER_DIED bit when the owner dies, even if its thread id is
+    reused later. On Windows the named mutex object is used, which reports
+    abandoned mutexes natively.
+
+    Named robust mutex must be unlocked by the thread which locked it.
+    Recursive locking is not supported. The locked mutex instance must not
+    be destroyed before its owner thread exits, otherwise the kernel could
+    not find the mutex in the robust list of the dead owner.
+
+    Thread-safe.
+
+    \see NamedMutex
+*/
+class NamedRobustMutex
+{
+public:
+    //! Default class constructor
+    /*!
+        \param name - Mutex name
+    */
+    explicit NamedRobustMutex(const std::string& name);
+    NamedRobustMutex(const NamedRobustMutex&) = delete;
+    NamedRobustMutex(NamedRobustMutex&& mutex) = delete;
+    ~NamedRobustMutex();
+
+    NamedRobustMutex& operator=(const NamedRobustMutex&) = delete;
+    NamedRobustMutex& operator=(NamedRobustMutex&& mutex) = delete;
+
+    //! Get the mutex name
+    const std::string& name() const;
+
+    //! Was the mutex recovered from the dead owner by the last successful lock?
+    /*!
+        Must be checked by the owner thread while the mutex is locked.
+
+        \return 'true' if the previous owner died while holding the mutex, 'false' otherwise
+    */
+    bool recovered() const;
+
+    //! Try to acquire mutex without block
+    /*!
+        Will not block.
+
+        \return 'true' if the mutex was successfully acquired, 'false' if the mutex is busy
+    */
+    bool TryLock();
+
+    //! Try to acquire mutex for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the mutex
+        \return 'true' if the mutex was successfully acquired, 'false' if the mutex is busy
+    */
+    bool TryLockFor(const Timespan& timespan);
+    //! Try to acquire mutex until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the mutex
+        \return 'true' if the mutex was successfully acquired, 'false' if the mutex is busy
+    */
+    bool TryLockUntil(const UtcTimestamp& timestamp)
+    { return TryLockFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire mutex with block
+    /*!
+        Will block.
+    */
+    void Lock();
+
+    //! Release mutex
+    /*!
+        Will not block.
+    */
+    void Unlock();
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 144;
+    static const size_t StorageAlign = 8;
+    std::aligned_storage<StorageSize, StorageAlign>::type _storage;
+};
+
+/*! \example threads_named_robust_mutex.cpp Named robust mutex synchronization primitive example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_NAMED_ROBUST_MUTEX_H
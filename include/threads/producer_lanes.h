@@ -0,0 +1,137 @@
+/*!
+    \file producer_lanes.h
+    \brief Producer lanes registry definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_PRODUCER_LANES_H
+#define CPPCOMMON_THREADS_PRODUCER_LANES_H
+
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+struct ProducerLanesThread;
+
+} // namespace Internals
+//! @endcond
+
+//! Producer lanes registry
+/*!
+    Producer lanes registry assigns a dedicated lane to every producer thread
+    of a multiple producers / single consumer container and tracks the set of
+    non-empty lanes in a bitmap scanned by the consumer.
+
+    Producer thread takes the least loaded lane (equally loaded lanes are
+    taken in round-robin order) on the first access and keeps it in the
+    thread local storage until the thread exits, so live producers never
+    share a lane until their count exceeds the count of lanes. A producer
+    thread never changes its lane, which keeps its items in FIFO order.
+    Lanes of exited threads are returned to the registry and handed out
+    to new producers first.
+
+    Producer marks its lane as non-empty after each enqueue operation. Consumer
+    clears the lane mark when it finds the lane empty and re-checks the lane
+    afterwards, so an item enqueued concurrently is never lost in the bitmap.
+
+    Thread-safe.
+*/
+class ProducerLanes
+{
+    friend struct Internals::ProducerLanesThread;
+
+public:
+    //! Create producer lanes registry with the given count of lanes
+    /*!
+        \param lanes - Count of lanes
+    */
+    explicit ProducerLanes(size_t lanes);
+    ProducerLanes(const ProducerLanes&) = delete;
+    ProducerLanes(ProducerLanes&&) = delete;
+    ~ProducerLanes();
+
+    ProducerLanes& operator=(const ProducerLanes&) = delete;
+    ProducerLanes& operator=(ProducerLanes&&) = delete;
+
+    //! Get count of lanes
+    size_t lanes() const noexcept { return _lanes; }
+    //! Get count of registered live producers
+    size_t producers() const noexcept { return (size_t)_registered.load(std::memory_order_relaxed); }
+
+    //! Get the lane of the current producer thread (producer thread method)
+    /*!
+        Registers the current thread on the first call. Registration is the
+        slow path which takes the global registry lock.
+
+        \return Lane index of the current producer thread
+    */
+    size_t Lane();
+
+    //! Mark the given lane as non-empty (producer thread method)
+    /*!
+        Must be called after the item was published into the lane.
+
+        \param lane - Lane index
+    */
+    void Mark(size_t lane) noexcept
+    {
+        // Paired with the clear operation in the consumer
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::atomic<uint64_t>& word = _bitmap[lane >> 6];
+        uint64_t bit = (uint64_t)1 << (lane & 63);
+        if ((word.load(std::memory_order_relaxed) & bit) == 0)
+            word.fetch_or(bit, std::memory_order_relaxed);
+    }
+
+    //! Clear the non-empty mark of the given lane (consumer thread method)
+    /*!
+        The consumer must re-check the lane after the mark is cleared
+        and mark it again if it is not empty anymore.
+
+        \param lane - Lane index
+    */
+    void Clear(size_t lane) noexcept
+    {
+        _bitmap[lane >> 6].fetch_and(~((uint64_t)1 << (lane & 63)), std::memory_order_relaxed);
+
+        // Paired with the mark operation in the producer
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    //! Find the next marked lane starting from the given one in cyclic order (consumer thread method)
+    /*!
+        \param start - Start lane index
+        \return Index of the next marked lane or lanes() if there are no marked lanes
+    */
+    size_t Next(size_t start) const noexcept;
+
+private:
+    uint64_t _id;
+    size_t _lanes;
+    size_t _words;
+    std::unique_ptr<std::atomic<uint64_t>[]> _bitmap;
+    std::vector<size_t> _assigned;
+    size_t _cursor;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> _registered;
+
+    //! Register the current thread in the least loaded lane
+    size_t Register();
+    //! Return the lane of the exited producer thread (must be called under the registry lock)
+    void Unregister(size_t lane) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_PRODUCER_LANES_H
@@ -0,0 +1,50 @@
+/*!
+    \file queue_lock_node.h
+    \brief Queue lock node definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_QUEUE_LOCK_NODE_H
+#define CPPCOMMON_THREADS_QUEUE_LOCK_NODE_H
+
+#include "utility/cache_line.h"
+
+#include <atomic>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Queue lock node
+/*!
+    Queue lock node is the cache line sized record of the waiting thread in
+    the queue of MCSLock and CLHLock. Each waiting thread spins on its own
+    node (MCS) or on the node of its predecessor (CLH).
+
+    Nodes are cached per thread and returned to the global pool when the
+    thread exits. Nodes are never freed, so a stale pointer to a node that
+    was recycled by another lock is always safe to read.
+*/
+struct alignas(CACHE_LINE_SIZE) QueueLockNode
+{
+    std::atomic<QueueLockNode*> next;
+    std::atomic<bool> locked;
+    QueueLockNode* free;
+
+    QueueLockNode() noexcept : next(nullptr), locked(false), free(nullptr) {}
+
+    //! Acquire a free node for the current thread
+    static QueueLockNode* Acquire();
+    //! Release the node to the free nodes of the current thread
+    static void Release(QueueLockNode* node) noexcept;
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_QUEUE_LOCK_NODE_H
@@ -0,0 +1,100 @@
+/*!
+    \file quiescent_reclamation.h
+    \brief Quiescent state based memory reclamation domain definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_QUIESCENT_RECLAMATION_H
+#define CPPCOMMON_THREADS_QUIESCENT_RECLAMATION_H
+
+#include "threads/reclamation_domain.h"
+
+namespace CppCommon {
+
+//! Quiescent state based memory reclamation domain
+/*!
+    Quiescent state based reclamation (QSBR) does not instrument read-side
+    accesses at all. Instead each online thread periodically reports a
+    quiescent state, a point where it holds no pointers to shared nodes
+    (e.g. between two processed requests). Pointers retired in some epoch
+    are safe to delete once all online threads reported quiescent states
+    in any later epoch.
+
+    Thread must be online to access shared nodes. Thread goes online with
+    Online() or with the first Quiescent() call and should go offline with
+    Offline() before long blocking operations, otherwise it blocks the
+    reclamation of all retired pointers. Finished threads go offline
+    automatically.
+
+    Thread-safe.
+
+    https://preshing.com/20160726/using-quiescent-states-to-reclaim-memory
+*/
+class QuiescentReclamation : public ReclamationDomain
+{
+public:
+    //! Quiescent state based reclamation record of the thread
+    struct Record : public ReclamationDomain::Record
+    {
+        std::atomic<uint64_t> epoch;
+
+        Record() : epoch(0) {}
+
+        void Release() noexcept override { epoch.store(0, std::memory_order_release); }
+    };
+
+    //! Create quiescent state based reclamation domain
+    /*!
+        \param batch - Minimal count of retired pointers of the thread to start the reclamation (default is 64)
+    */
+    explicit QuiescentReclamation(size_t batch = 64) : ReclamationDomain(batch), _epoch(1) {}
+    QuiescentReclamation(const QuiescentReclamation&) = delete;
+    QuiescentReclamation(QuiescentReclamation&&) = delete;
+    ~QuiescentReclamation() = default;
+
+    QuiescentReclamation& operator=(const QuiescentReclamation&) = delete;
+    QuiescentReclamation& operator=(QuiescentReclamation&&) = delete;
+
+    //! Get the global epoch
+    uint64_t epoch() const noexcept { return _epoch.load(std::memory_order_acquire); }
+
+    //! Put the current thread online
+    void Online();
+    //! Put the current thread offline
+    /*!
+        The current thread must not access any shared node until it goes online again.
+    */
+    void Offline();
+    //! Report the quiescent state of the current thread
+    /*!
+        The current thread must not hold any pointer to shared nodes loaded before the call.
+    */
+    void Quiescent();
+
+    //! Reclaim all retired pointers of the current thread which are safe to delete
+    /*!
+        Reports the quiescent state of the current thread.
+    */
+    void Reclaim() override;
+
+protected:
+    ReclamationDomain::Record* Create() override { return new Record(); }
+    //! Advance the global epoch and delete all retired pointers of the given record which are passed by all online threads
+    void Scan(ReclamationDomain::Record& record) override;
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> _epoch;
+
+    //! Announce the global epoch in the given record
+    void Announce(Record& record);
+    //! Stamp all new retired pointers of the given record with the advanced global epoch
+    void Stamp(ReclamationDomain::Record& record);
+    //! Delete all retired pointers of the given record which are passed by all online threads
+    void Collect(ReclamationDomain::Record& record);
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_QUIESCENT_RECLAMATION_H
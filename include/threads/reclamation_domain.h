@@ -0,0 +1,136 @@
+/*!
+    \file reclamation_domain.h
+    \brief Memory reclamation domain definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_RECLAMATION_DOMAIN_H
+#define CPPCOMMON_THREADS_RECLAMATION_DOMAIN_H
+
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CppCommon {
+
+//! Memory reclamation domain
+/*!
+    Memory reclamation domain is a base class for safe deferred deletion schemes
+    of lock-free data structures (hazard pointers, epoch-based and quiescent
+    state based reclamation). Removed nodes are retired into the per-thread
+    retire list and deleted in batches once the concrete scheme proves that no
+    thread accesses them anymore.
+
+    Each thread gets its own record on the first access to the domain. Records
+    are cached in the thread local storage, so the fast path does not touch any
+    shared state. Records of finished threads are reused by new threads together
+    with their pending retire lists.
+
+    Thread-safe.
+*/
+class ReclamationDomain
+{
+public:
+    //! Retired pointer deleter
+    /*!
+        \param ptr - Retired pointer
+        \param context - Deleter context
+    */
+    typedef void (*Deleter)(void* ptr, void* context);
+
+    //! Retired pointer
+    struct Retired
+    {
+        void* ptr;
+        Deleter deleter;
+        void* context;
+        uint64_t epoch;
+    };
+
+    //! Reclamation record of the thread
+    struct alignas(CACHE_LINE_SIZE) Record
+    {
+        std::atomic<bool> active;
+        Record* next;
+        std::vector<Retired> retired;
+
+        Record() : active(true), next(nullptr) {}
+        Record(const Record&) = delete;
+        Record(Record&&) = delete;
+        virtual ~Record() = default;
+
+        Record& operator=(const Record&) = delete;
+        Record& operator=(Record&&) = delete;
+
+        //! Release the record of the finished thread
+        virtual void Release() noexcept {}
+    };
+
+    ReclamationDomain(const ReclamationDomain&) = delete;
+    ReclamationDomain(ReclamationDomain&&) = delete;
+    virtual ~ReclamationDomain();
+
+    ReclamationDomain& operator=(const ReclamationDomain&) = delete;
+    ReclamationDomain& operator=(ReclamationDomain&&) = delete;
+
+    //! Get minimal count of retired pointers of the thread to start the reclamation
+    size_t batch() const noexcept { return _batch; }
+    //! Get count of reclamation records
+    size_t records() const noexcept { return _records_count.load(std::memory_order_relaxed); }
+
+    //! Retire the given pointer
+    /*!
+        The pointer will be deleted with the given deleter when no thread accesses it.
+
+        \param ptr - Pointer to retire
+        \param deleter - Pointer deleter
+        \param context - Deleter context (default is nullptr)
+    */
+    void Retire(void* ptr, Deleter deleter, void* context = nullptr) { Retire(Acquire(), ptr, deleter, context); }
+    //! Retire the given pointer which will be deleted with 'delete' operator
+    /*!
+        \param ptr - Pointer to retire
+    */
+    template <typename T>
+    void Retire(T* ptr) { Retire(ptr, [](void* p, void*) { delete (T*)p; }); }
+
+    //! Reclaim all retired pointers of the current thread which are safe to delete
+    virtual void Reclaim() { Scan(Acquire()); }
+
+protected:
+    //! Create reclamation domain
+    /*!
+        \param batch - Minimal count of retired pointers of the thread to start the reclamation
+    */
+    explicit ReclamationDomain(size_t batch);
+
+    //! Get the first reclamation record
+    Record* first() const noexcept { return _records.load(std::memory_order_acquire); }
+
+    //! Acquire the record of the current thread
+    Record& Acquire();
+    //! Retire the given pointer into the given record
+    void Retire(Record& record, void* ptr, Deleter deleter, void* context);
+
+    //! Create a new reclamation record
+    virtual Record* Create() = 0;
+    //! Get count of retired pointers of the thread to start the reclamation
+    virtual size_t Threshold() const noexcept { return _batch; }
+    //! Delete all retired pointers of the given record which are safe to delete
+    virtual void Scan(Record& record) = 0;
+
+private:
+    uint64_t _id;
+    size_t _batch;
+    std::atomic<Record*> _records;
+    std::atomic<size_t> _records_count;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_RECLAMATION_DOMAIN_H
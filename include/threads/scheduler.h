@@ -0,0 +1,146 @@
+/*!
+    \file scheduler.h
+    \brief Coroutine scheduler definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SCHEDULER_H
+#define CPPCOMMON_THREADS_SCHEDULER_H
+
+#include "threads/task.h"
+#include "threads/work_stealing_pool.h"
+
+namespace CppCommon {
+
+//! Coroutine scheduler
+/*!
+    Coroutine scheduler resumes posted coroutines on its execution context.
+    Coroutines move to the scheduler with 'co_await scheduler.Schedule()'
+    and detached tasks are started with Spawn().
+
+    Thread-safe.
+*/
+class Scheduler
+{
+public:
+    Scheduler() noexcept = default;
+    Scheduler(const Scheduler&) = delete;
+    Scheduler(Scheduler&&) = delete;
+    virtual ~Scheduler() = default;
+
+    Scheduler& operator=(const Scheduler&) = delete;
+    Scheduler& operator=(Scheduler&&) = delete;
+
+    //! Post the coroutine to resume on the scheduler
+    /*!
+        \param handle - Coroutine handle
+    */
+    virtual void Post(std::coroutine_handle<> handle) = 0;
+
+    //! Resume the awaiting coroutine on the scheduler
+    /*!
+        \return Awaitable object
+    */
+    auto Schedule() noexcept
+    {
+        struct ScheduleAwaiter
+        {
+            Scheduler& scheduler;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { scheduler.Post(handle); }
+            void await_resume() const noexcept {}
+        };
+
+        return ScheduleAwaiter{ *this };
+    }
+
+    //! Spawn the detached task on the scheduler
+    /*!
+        The task is destroyed when it is completed. Unhandled exceptions
+        of the detached task terminate the program.
+
+        \param task - Task to spawn
+    */
+    void Spawn(Task<> task) { Detach(*this, std::move(task)); }
+
+private:
+    struct Detached
+    {
+        struct promise_type
+        {
+            Detached get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    static Detached Detach(Scheduler& scheduler, Task<> task)
+    {
+        co_await scheduler.Schedule();
+        co_await std::move(task);
+    }
+};
+
+//! Inline coroutine scheduler
+/*!
+    Inline scheduler resumes posted coroutines directly on the posting
+    thread. Spawned tasks run on the current thread until their first
+    suspension, so a single thread could multiplex many coroutines which
+    are resumed by awaitable synchronization primitives.
+
+    Thread-safe.
+*/
+class InlineScheduler : public Scheduler
+{
+public:
+    InlineScheduler() noexcept = default;
+    InlineScheduler(const InlineScheduler&) = delete;
+    InlineScheduler(InlineScheduler&&) = delete;
+    ~InlineScheduler() = default;
+
+    InlineScheduler& operator=(const InlineScheduler&) = delete;
+    InlineScheduler& operator=(InlineScheduler&&) = delete;
+
+    void Post(std::coroutine_handle<> handle) override { handle.resume(); }
+};
+
+//! Thread pool coroutine scheduler
+/*!
+    Thread pool scheduler resumes posted coroutines as tasks of the
+    work-stealing thread pool, so thousands of coroutines are multiplexed
+    onto a few worker threads.
+
+    Thread-safe.
+*/
+class PoolScheduler : public Scheduler
+{
+public:
+    //! Create thread pool scheduler
+    /*!
+        \param pool - Work-stealing thread pool
+    */
+    explicit PoolScheduler(WorkStealingPool& pool) noexcept : _pool(pool) {}
+    PoolScheduler(const PoolScheduler&) = delete;
+    PoolScheduler(PoolScheduler&&) = delete;
+    ~PoolScheduler() = default;
+
+    PoolScheduler& operator=(const PoolScheduler&) = delete;
+    PoolScheduler& operator=(PoolScheduler&&) = delete;
+
+    //! Get the work-stealing thread pool
+    WorkStealingPool& pool() noexcept { return _pool; }
+
+    void Post(std::coroutine_handle<> handle) override { _pool.Submit([handle]() { handle.resume(); }); }
+
+private:
+    WorkStealingPool& _pool;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_SCHEDULER_H
@@ -9,8 +9,14 @@
 #ifndef CPPCOMMON_THREADS_SEQLOCK_H
 #define CPPCOMMON_THREADS_SEQLOCK_H
 
+#include "threads/spin_wait.h"
+#include "utility/resource.h"
+
 #include <atomic>
+#include <cstdint>
 #include <cstring>
+#include <new>
+#include <type_traits>
 
 namespace CppCommon {
 
@@ -22,13 +28,27 @@ namespace CppCommon {
     variable during a reader critical section, and hence improve performance
     by avoiding cache coherence misses on the lock object itself.
 
+    Data is stored in the array of relaxed 64-bit atomic words, so racing
+    readers never cause a data race undefined behavior regardless of the
+    data size. Readers wait with backoff while the write is in progress and
+    build the data from the stored words only once the read is validated.
+
+    Writers are serialized with the lowest bit of the sequence (embedded
+    spin lock), so concurrent writers are safe.
+
+    Data type must be trivially copyable, but not necessary default
+    constructible.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Seqlock
+    https://www.hpl.hp.com/techreports/2012/HPL-2012-68.pdf
 */
 template <typename T>
 class SeqLock
 {
+    static_assert(std::is_trivially_copyable<T>::value, "Sequential lock data type must be trivially copyable!");
+
 public:
     SeqLock();
     explicit SeqLock(const T& data);
@@ -48,21 +68,62 @@ public:
     */
     T Read() const noexcept;
 
+    //! Read the data field under the sequential lock
+    /*!
+        Only the data words covering the given field are loaded and
+        validated, so reading a single field of a large data costs less
+        than Read(), e.g. lock.Read(&Quote::bid)
+
+        Will block in a spin loop.
+
+        \param field - Pointer to the data field
+        \return Read data field
+    */
+    template <typename TField>
+    TField Read(TField T::*field) const noexcept;
+
     //! Write data under the sequential lock
     /*!
-        Will not block.
+        Will block in a spin loop while another writer is active.
 
         \param data - Data to write
     */
     void Write(const T& data) noexcept;
 
+    //! Update data under the sequential lock
+    /*!
+        Updater is called with the current data which could be modified in
+        place. Readers see the data either before or after the update.
+        If the updater throws an exception the data is not changed and the
+        lock is released.
+
+        Will block in a spin loop while another writer is active.
+
+        \param updater - Updater function with the signature 'void(T&)'
+    */
+    template <class TUpdater>
+    void Update(TUpdater&& updater);
+
 private:
+    static const size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
     typedef char cache_line_pad[128];
 
     cache_line_pad _pad0;
-    T _data;
     std::atomic<size_t> _seq;
+    std::atomic<uint64_t> _data[WORDS];
     cache_line_pad _pad1;
+
+    //! Begin the write and get its sequence
+    size_t Lock() noexcept;
+    //! End the write started with the given sequence
+    void Unlock(size_t seq) noexcept;
+    //! Load the data words in the given range [first, last)
+    void Load(uint64_t* words, size_t first = 0, size_t last = WORDS) const noexcept;
+    //! Load the consistent data words in the given range [first, last)
+    void LoadConsistent(uint64_t* words, size_t first, size_t last) const noexcept;
+    //! Store the data words
+    void Store(const T& data) noexcept;
 };
 
 /*! \example threads_seq_lock.cpp Sequential lock synchronization primitive example */
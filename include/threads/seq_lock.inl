@@ -13,12 +13,14 @@ inline SeqLock<T>::SeqLock() : _seq(0)
 {
     memset(_pad0, 0, sizeof(cache_line_pad));
     memset(_pad1, 0, sizeof(cache_line_pad));
+    for (size_t i = 0; i < WORDS; ++i)
+        _data[i].store(0, std::memory_order_relaxed);
 }
 
 template <typename T>
 inline SeqLock<T>::SeqLock(const T& data) : SeqLock()
 {
-    _data = data;
+    Store(data);
 }
 
 template <typename T>
@@ -31,31 +33,129 @@ inline SeqLock<T>& SeqLock<T>::operator=(const T& data) noexcept
 template <typename T>
 inline T SeqLock<T>::Read() const noexcept
 {
-    T data;
-    size_t seq0;
-    size_t seq1;
+    uint64_t words[WORDS];
+    LoadConsistent(words, 0, WORDS);
 
-    do
-    {
-        seq0 = _seq.load(std::memory_order_acquire);
-        std::atomic_signal_fence(std::memory_order_acq_rel);
-        data = _data;
-        std::atomic_signal_fence(std::memory_order_acq_rel);
-        seq1 = _seq.load(std::memory_order_acquire);
-    } while ((seq0 != seq1) || (seq0 & 1));
+    // Data type is not required to be default constructible
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::memcpy(storage, words, sizeof(T));
+    return *std::launder(reinterpret_cast<const T*>(storage));
+}
+
+template <typename T>
+template <typename TField>
+inline TField SeqLock<T>::Read(TField T::*field) const noexcept
+{
+    // Find the field offset in the data layout (the storage is never accessed)
+    alignas(T) unsigned char layout[sizeof(T)];
+    const T* data = reinterpret_cast<const T*>(layout);
+    size_t offset = (size_t)(reinterpret_cast<const unsigned char*>(&(data->*field)) - layout);
+
+    // Load and validate only the words covering the field
+    size_t first = offset / sizeof(uint64_t);
+    size_t last = (offset + sizeof(TField) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    uint64_t words[WORDS];
+    LoadConsistent(words, first, last);
 
-    return data;
+    // Field type is not required to be default constructible
+    alignas(TField) unsigned char storage[sizeof(TField)];
+    std::memcpy(storage, reinterpret_cast<const unsigned char*>(words) + offset, sizeof(TField));
+    return *std::launder(reinterpret_cast<const TField*>(storage));
 }
 
 template <typename T>
 inline void SeqLock<T>::Write(const T& data) noexcept
 {
-    size_t seq0 = _seq.load(std::memory_order_relaxed);
-    _seq.store(seq0 + 1, std::memory_order_release);
-    std::atomic_signal_fence(std::memory_order_acq_rel);
-    _data = data;
-    std::atomic_signal_fence(std::memory_order_acq_rel);
-    _seq.store(seq0 + 2, std::memory_order_release);
+    size_t seq = Lock();
+    Store(data);
+    Unlock(seq);
+}
+
+template <typename T>
+template <class TUpdater>
+inline void SeqLock<T>::Update(TUpdater&& updater)
+{
+    size_t seq = Lock();
+
+    // Release the lock even if the updater throws, otherwise readers and writers spin forever
+    auto unlock = resource([this, seq](void*) { Unlock(seq); });
+
+    // Data cannot be changed by other writers
+    uint64_t words[WORDS];
+    Load(words);
+    alignas(T) unsigned char storage[sizeof(T)];
+    std::memcpy(storage, words, sizeof(T));
+    T& data = *std::launder(reinterpret_cast<T*>(storage));
+
+    updater(data);
+
+    Store(data);
+}
+
+template <typename T>
+inline size_t SeqLock<T>::Lock() noexcept
+{
+    SpinWait spin;
+    size_t seq = _seq.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        // Odd sequence means the write is in progress
+        if (((seq & 1) == 0) && _seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed))
+            break;
+
+        spin.Spin();
+        seq = _seq.load(std::memory_order_relaxed);
+    }
+
+    // Order the odd sequence store before the data stores
+    std::atomic_thread_fence(std::memory_order_release);
+    return seq;
+}
+
+template <typename T>
+inline void SeqLock<T>::Unlock(size_t seq) noexcept
+{
+    _seq.store(seq + 2, std::memory_order_release);
+}
+
+template <typename T>
+inline void SeqLock<T>::Load(uint64_t* words, size_t first, size_t last) const noexcept
+{
+    for (size_t i = first; i < last; ++i)
+        words[i] = _data[i].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+inline void SeqLock<T>::Store(const T& data) noexcept
+{
+    uint64_t words[WORDS] = {};
+    std::memcpy(words, &data, sizeof(T));
+    for (size_t i = 0; i < WORDS; ++i)
+        _data[i].store(words[i], std::memory_order_relaxed);
+}
+
+template <typename T>
+inline void SeqLock<T>::LoadConsistent(uint64_t* words, size_t first, size_t last) const noexcept
+{
+    SpinWait spin;
+    for (;;)
+    {
+        size_t seq0 = _seq.load(std::memory_order_acquire);
+
+        // Do not copy the data while the write is in progress
+        if ((seq0 & 1) == 0)
+        {
+            Load(words, first, last);
+
+            // Order the data loads before the sequence validation
+            std::atomic_thread_fence(std::memory_order_acquire);
+            size_t seq1 = _seq.load(std::memory_order_relaxed);
+            if (seq0 == seq1)
+                return;
+        }
+
+        spin.Spin();
+    }
 }
 
 } // namespace CppCommon
@@ -0,0 +1,164 @@
+/*!
+    \file shared_file_lock.h
+    \brief Shared memory file-lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_FILE_LOCK_H
+#define CPPCOMMON_THREADS_SHARED_FILE_LOCK_H
+
+#include "filesystem/path.h"
+#include "threads/locker.h"
+#include "time/timestamp.h"
+
+#include <memory>
+
+namespace CppCommon {
+
+//! Shared memory file-lock synchronization primitive
+/*!
+    Shared memory file-lock provides the same shared and exclusive access to
+    some resource as the file-lock does, but coordinates processes on the same
+    host through futex words in the shared memory file next to the lock file
+    ("<path>.shm"). Uncontended read and write locks are a few atomic operations
+    without system calls, and waiting threads are parked on process-shared
+    futexes.
+
+    Each file-lock instance owns a slot in the shared memory which is guarded by
+    the file byte-range lock of the lock file. The operating system releases the
+    byte-range lock when the owning process dies, so waiting threads detect dead
+    lock holders and recover their locks within RECOVERY_INTERVAL.
+
+    Up to MAX_SLOTS file-lock instances could use the same lock path at the
+    same time.
+
+    Implemented on Linux only, other platforms fall back to FileLock.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/File_locking
+*/
+class SharedFileLock
+{
+public:
+    //! Maximal count of file-lock instances for the same lock path
+    static const int MAX_SLOTS = 128;
+    //! Interval in milliseconds to check waiting locks for dead lock holders
+    static const int RECOVERY_INTERVAL = 100;
+
+    SharedFileLock();
+    explicit SharedFileLock(const Path& path);
+    SharedFileLock(const SharedFileLock&) = delete;
+    SharedFileLock(SharedFileLock&& lock) = delete;
+    ~SharedFileLock();
+
+    SharedFileLock& operator=(const Path& path);
+    SharedFileLock& operator=(const SharedFileLock&) = delete;
+    SharedFileLock& operator=(SharedFileLock&& lock) = delete;
+
+    //! Get the file-lock path
+    const Path& path() const noexcept;
+
+    //! Assign a new file-lock path
+    /*!
+        \param path - File-lock path
+    */
+    void Assign(const Path& path);
+
+    //! Reset file-lock
+    /*!
+        The last file-lock instance for the lock path removes the lock file
+        and the shared memory file.
+    */
+    void Reset();
+
+    //! Try to acquire read lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockRead();
+    //! Try to acquire write lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWrite();
+
+    //! Try to acquire read lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadFor(const Timespan& timespan);
+    //! Try to acquire write lock for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteFor(const Timespan& timespan);
+    //! Try to acquire read lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the read lock
+        \return 'true' if the read lock was successfully acquired, 'false' if the read lock is busy
+    */
+    bool TryLockReadUntil(const UtcTimestamp& timestamp)
+    { return TryLockReadFor(timestamp - UtcTimestamp()); }
+    //! Try to acquire write lock until the given timestamp
+    /*!
+        Will block until the given timestamp in the worst case.
+
+        \param timestamp - Timestamp to stop wait for the write lock
+        \return 'true' if the write lock was successfully acquired, 'false' if the write lock is busy
+    */
+    bool TryLockWriteUntil(const UtcTimestamp& timestamp)
+    { return TryLockWriteFor(timestamp - UtcTimestamp()); }
+
+    //! Acquire read lock with block
+    /*!
+        Will block.
+    */
+    void LockRead();
+    //! Acquire write lock with block
+    /*!
+        Will block.
+    */
+    void LockWrite();
+
+    //! Release read lock
+    /*!
+        Will not block.
+    */
+    void UnlockRead();
+    //! Release write lock
+    /*!
+        Will not block.
+    */
+    void UnlockWrite();
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 64;
+    static const size_t StorageAlign = 8;
+    std::aligned_storage<StorageSize, StorageAlign>::type _storage;
+};
+
+/*! \example threads_shared_file_lock.cpp Shared memory file-lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_SHARED_FILE_LOCK_H
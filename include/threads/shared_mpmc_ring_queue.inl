@@ -0,0 +1,145 @@
+/*!
+    \file shared_mpmc_ring_queue.inl
+    \brief Shared memory multiple producers / multiple consumers wait-free ring queue inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline SharedMPMCRingQueue<T>::SharedMPMCRingQueue(const std::string& name, size_t capacity, size_t spin)
+    : _shared(name, sizeof(Layout) + capacity * sizeof(Node)),
+      _layout((Layout*)_shared.ptr()),
+      _buffer((Node*)(_layout + 1)),
+      _capacity(capacity),
+      _mask(capacity - 1),
+      _spin(spin)
+{
+    assert((capacity > 1) && "Ring queue capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
+
+    // Only the owner should initialize the shared memory layout
+    if (_shared.owner())
+    {
+        _layout->head.store(0, std::memory_order_relaxed);
+        _layout->tail.store(0, std::memory_order_relaxed);
+        new (&_layout->not_empty) EventCount(true);
+        new (&_layout->not_full) EventCount(true);
+
+        // Populate the sequence initial values
+        for (size_t i = 0; i < capacity; ++i)
+            _buffer[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    Internals::SharedRing::Open(_layout->header, _shared.owner(), Internals::SharedRingHeader::MPMC_RING_QUEUE, sizeof(T), capacity);
+}
+
+template<typename T>
+inline size_t SharedMPMCRingQueue<T>::size() const noexcept
+{
+    const uint64_t head = _layout->head.load(std::memory_order_acquire);
+    const uint64_t tail = _layout->tail.load(std::memory_order_acquire);
+
+    return (head > tail) ? (size_t)(head - tail) : 0;
+}
+
+template<typename T>
+inline bool SharedMPMCRingQueue<T>::TryEnqueue(const T& item)
+{
+    if (closed())
+        return false;
+
+    uint64_t head_sequence = _layout->head.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Node* node = &_buffer[head_sequence & _mask];
+        uint64_t node_sequence = node->sequence.load(std::memory_order_acquire);
+
+        // If node sequence and head sequence are the same then it means this slot is empty
+        int64_t diff = (int64_t)node_sequence - (int64_t)head_sequence;
+        if (diff == 0)
+        {
+            // Claim our spot by moving head
+            if (_layout->head.compare_exchange_weak(head_sequence, head_sequence + 1, std::memory_order_relaxed))
+            {
+                // Store the item value
+                node->value = item;
+
+                // Increment the sequence so that the tail knows it's accessible
+                node->sequence.store(head_sequence + 1, std::memory_order_release);
+
+                _layout->not_empty.NotifyOne();
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // If node sequence is less than head sequence then it means this slot is full
+            // and therefore buffer is full
+            return false;
+        }
+        else
+        {
+            // Another producer has already claimed this slot
+            head_sequence = _layout->head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+inline bool SharedMPMCRingQueue<T>::Enqueue(const T& item)
+{
+    return Internals::SharedRing::Park(_layout->header, _layout->not_full, _spin, [this, &item]() { return TryEnqueue(item); }, false);
+}
+
+template<typename T>
+inline bool SharedMPMCRingQueue<T>::TryDequeue(T& item)
+{
+    uint64_t tail_sequence = _layout->tail.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Node* node = &_buffer[tail_sequence & _mask];
+        uint64_t node_sequence = node->sequence.load(std::memory_order_acquire);
+
+        // If node sequence is the next to the tail sequence then it means this slot is filled
+        int64_t diff = (int64_t)node_sequence - (int64_t)(tail_sequence + 1);
+        if (diff == 0)
+        {
+            // Claim our spot by moving tail
+            if (_layout->tail.compare_exchange_weak(tail_sequence, tail_sequence + 1, std::memory_order_relaxed))
+            {
+                // Get the item value
+                item = node->value;
+
+                // Set the sequence to what the head sequence should be next time around
+                node->sequence.store(tail_sequence + _mask + 1, std::memory_order_release);
+
+                _layout->not_full.NotifyOne();
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // If node sequence is less than the expected one then it means this slot is empty
+            // and therefore buffer is empty
+            return false;
+        }
+        else
+        {
+            // Another consumer has already claimed this slot
+            tail_sequence = _layout->tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+inline bool SharedMPMCRingQueue<T>::Dequeue(T& item)
+{
+    return Internals::SharedRing::Park(_layout->header, _layout->not_empty, _spin, [this, &item]() { return TryDequeue(item); }, true);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,118 @@
+/*!
+    \file shared_ring_header.h
+    \brief Shared memory ring queues header definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_RING_HEADER_H
+#define CPPCOMMON_THREADS_SHARED_RING_HEADER_H
+
+#include "errors/exceptions.h"
+#include "threads/event_count.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+//! Shared memory ring queue header
+/*!
+    Header is placed at the beginning of the shared memory segment. The owner
+    process fills it and publishes the ready magic value, other processes wait
+    for the magic value and validate the layout before the first access.
+*/
+struct alignas(CACHE_LINE_SIZE) SharedRingHeader
+{
+    //! Magic value of the initialized header
+    static const uint32_t MAGIC = 0x53524E47;
+    //! Layout version
+    static const uint32_t VERSION = 1;
+
+    //! Ring queue types
+    enum Type : uint32_t
+    {
+        SPSC_RING_QUEUE = 1,
+        MPMC_RING_QUEUE = 2,
+        SPSC_RING_BUFFER = 3
+    };
+
+    std::atomic<uint32_t> ready;
+    uint32_t version;
+    uint32_t type;
+    uint32_t item_size;
+    uint64_t capacity;
+    std::atomic<uint32_t> closed;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory ring queues require lock-free 32-bit atomics!");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory ring queues require lock-free 64-bit atomics!");
+
+//! Shared memory ring queue helpers static class
+struct SharedRing
+{
+    //! Initialize (owner) or validate (other processes) the shared memory ring queue header
+    static void Open(SharedRingHeader& header, bool owner, uint32_t type, uint32_t item_size, uint64_t capacity)
+    {
+        if (owner)
+        {
+            header.version = SharedRingHeader::VERSION;
+            header.type = type;
+            header.item_size = item_size;
+            header.capacity = capacity;
+            header.closed.store(0, std::memory_order_relaxed);
+            header.ready.store(SharedRingHeader::MAGIC, std::memory_order_release);
+            return;
+        }
+
+        // Wait for the owner process to initialize the header
+        while (header.ready.load(std::memory_order_acquire) != SharedRingHeader::MAGIC)
+            std::this_thread::yield();
+
+        if (header.version != SharedRingHeader::VERSION)
+            throwex SystemException("Invalid shared memory ring queue version!");
+        if ((header.type != type) || (header.item_size != item_size))
+            throwex SystemException("Invalid shared memory ring queue type!");
+        if (header.capacity != capacity)
+            throwex SystemException("Invalid shared memory ring queue capacity!");
+    }
+
+    //! Is the shared memory ring queue closed?
+    static bool Closed(const SharedRingHeader& header) noexcept
+    {
+        return (header.closed.load(std::memory_order_acquire) != 0);
+    }
+
+    //! Close the shared memory ring queue and wake all parked producers and consumers
+    static void Close(SharedRingHeader& header, EventCount& not_empty, EventCount& not_full) noexcept
+    {
+        if (header.closed.exchange(1, std::memory_order_seq_cst) != 0)
+            return;
+
+        not_empty.NotifyAll();
+        not_full.NotifyAll();
+    }
+
+    //! Retry the given operation until it succeeds, parking the current thread on the given event count
+    template <class TOperation>
+    static bool Park(const SharedRingHeader& header, EventCount& event, size_t spin, TOperation operation, bool drain)
+    {
+        bool done = false;
+        event.Wait([&header, &operation, &done]() { done = operation(); return done || Closed(header); }, spin);
+        return done || (drain && operation());
+    }
+};
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_SHARED_RING_HEADER_H
@@ -0,0 +1,162 @@
+/*!
+    \file shared_spsc_ring_buffer.h
+    \brief Shared memory single producer / single consumer wait-free ring buffer definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+#define CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+
+#include "system/shared_memory.h"
+#include "threads/shared_ring_header.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace CppCommon {
+
+//! Shared memory single producer / single consumer wait-free ring buffer
+/*!
+    Shared memory single producer / single consumer wait-free ring buffer is
+    a byte stream constructed in place in the named shared memory segment, so
+    the producer and the consumer could live in different processes. It is a
+    lightweight replacement of the pipe which does not need a system call per
+    message. The segment starts with the header which is validated (version,
+    type, capacity) by every process opening the existing ring buffer.
+
+    Try methods never block. Blocking methods spin for a while and then park
+    the current thread on the process-shared futex until the ring buffer
+    changes its state. Wake-up system calls are issued only when someone is
+    really parked, so uncontended operations never enter the kernel.
+
+    FIFO order is guaranteed!
+
+    Thread-safe (one producer and one consumer thread in any processes).
+*/
+class SharedSPSCRingBuffer
+{
+public:
+    //! Create a new or open existing shared memory ring buffer with a given name and capacity
+    /*!
+        \param name - Shared memory ring buffer name
+        \param capacity - Ring buffer capacity in bytes (must be a power of two)
+        \param spin - Spin attempts before the thread is parked (default is 128)
+    */
+    explicit SharedSPSCRingBuffer(const std::string& name, size_t capacity, size_t spin = 128);
+    SharedSPSCRingBuffer(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer(SharedSPSCRingBuffer&&) = delete;
+    ~SharedSPSCRingBuffer() = default;
+
+    SharedSPSCRingBuffer& operator=(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer& operator=(SharedSPSCRingBuffer&&) = delete;
+
+    //! Check if the buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the shared memory ring buffer name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory ring buffer owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Is ring buffer closed?
+    bool closed() const noexcept { return Internals::SharedRing::Closed(_layout->header); }
+
+    //! Is ring buffer empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring buffer capacity in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get ring buffer size in bytes
+    size_t size() const noexcept;
+
+    //! Try to enqueue a chunk of bytes into the ring buffer (single producer thread method)
+    /*!
+        The chunk of bytes will be copied into the ring buffer using 'memcpy()' function.
+        Chunk size should not be greater than ring buffer capacity!
+
+        Will not block.
+
+        \param chunk - Chunk buffer to enqueue
+        \param size - Chunk buffer size
+        \return 'true' if the chunk of bytes was successfully enqueue, 'false' if the ring buffer is full or closed
+    */
+    bool TryEnqueue(const void* chunk, size_t size);
+    //! Enqueue a chunk of bytes into the ring buffer (single producer thread method)
+    /*!
+        The chunk of bytes will be copied into the ring buffer using 'memcpy()' function.
+        Chunk size should not be greater than ring buffer capacity!
+
+        Will block while the ring buffer does not have enough free space.
+
+        \param chunk - Chunk buffer to enqueue
+        \param size - Chunk buffer size
+        \return 'true' if the chunk of bytes was successfully enqueue, 'false' if the ring buffer is closed
+    */
+    bool Enqueue(const void* chunk, size_t size);
+
+    //! Try to dequeue a chunk of bytes from the ring buffer (single consumer thread method)
+    /*!
+        The chunk of bytes will be copied from the ring buffer using 'memcpy()' function.
+
+        Will not block.
+
+        \param chunk - Chunk buffer to dequeue
+        \param size - Chunk buffer size, will be updated with the dequeued size
+        \return 'true' if the chunk of bytes was successfully dequeue, 'false' if the ring buffer is empty
+    */
+    bool TryDequeue(void* chunk, size_t& size);
+    //! Dequeue a chunk of bytes from the ring buffer (single consumer thread method)
+    /*!
+        The chunk of bytes will be copied from the ring buffer using 'memcpy()' function.
+        Bytes left in the closed ring buffer are still available for dequeue.
+
+        Will block while the ring buffer is empty.
+
+        \param chunk - Chunk buffer to dequeue
+        \param size - Chunk buffer size, will be updated with the dequeued size
+        \return 'true' if the chunk of bytes was successfully dequeue, 'false' if the ring buffer is closed and empty
+    */
+    bool Dequeue(void* chunk, size_t& size);
+
+    //! Close the ring buffer
+    /*!
+        All parked producers and consumers in all processes will be woken up.
+
+        Will not block.
+    */
+    void Close() { Internals::SharedRing::Close(_layout->header, _layout->not_empty, _layout->not_full); }
+
+private:
+    // Shared memory layout, bytes buffer follows the layout
+    struct Layout
+    {
+        Internals::SharedRingHeader header;
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;
+        alignas(CACHE_LINE_SIZE) EventCount not_empty;
+        alignas(CACHE_LINE_SIZE) EventCount not_full;
+    };
+
+    SharedMemory _shared;
+    Layout* const _layout;
+    uint8_t* const _buffer;
+    const uint64_t _capacity;
+    const uint64_t _mask;
+    const size_t _spin;
+
+    // Producer and consumer cached cursors (local to the process)
+    alignas(CACHE_LINE_SIZE) uint64_t _tail_cache;
+    alignas(CACHE_LINE_SIZE) uint64_t _head_cache;
+};
+
+/*! \example threads_shared_spsc_ring_buffer.cpp Shared memory single producer / single consumer wait-free ring buffer example */
+
+} // namespace CppCommon
+
+#include "shared_spsc_ring_buffer.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
@@ -0,0 +1,137 @@
+/*!
+    \file shared_spsc_ring_buffer.inl
+    \brief Shared memory single producer / single consumer wait-free ring buffer inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SharedSPSCRingBuffer::SharedSPSCRingBuffer(const std::string& name, size_t capacity, size_t spin)
+    : _shared(name, sizeof(Layout) + capacity),
+      _layout((Layout*)_shared.ptr()),
+      _buffer((uint8_t*)(_layout + 1)),
+      _capacity(capacity),
+      _mask(capacity - 1),
+      _spin(spin),
+      _tail_cache(0),
+      _head_cache(0)
+{
+    assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
+
+    // Only the owner should initialize the shared memory layout
+    if (_shared.owner())
+    {
+        _layout->head.store(0, std::memory_order_relaxed);
+        _layout->tail.store(0, std::memory_order_relaxed);
+        new (&_layout->not_empty) EventCount(true);
+        new (&_layout->not_full) EventCount(true);
+    }
+
+    Internals::SharedRing::Open(_layout->header, _shared.owner(), Internals::SharedRingHeader::SPSC_RING_BUFFER, 1, capacity);
+
+    _tail_cache = _layout->tail.load(std::memory_order_acquire);
+    _head_cache = _layout->head.load(std::memory_order_acquire);
+}
+
+inline size_t SharedSPSCRingBuffer::size() const noexcept
+{
+    const uint64_t head = _layout->head.load(std::memory_order_acquire);
+    const uint64_t tail = _layout->tail.load(std::memory_order_acquire);
+
+    return (size_t)(head - tail);
+}
+
+inline bool SharedSPSCRingBuffer::TryEnqueue(const void* chunk, size_t size)
+{
+    assert((size <= _capacity) && "Chunk size should not be greater than ring buffer capacity!");
+    if ((size > _capacity) || closed())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((chunk != nullptr) && "Pointer to the chunk should not be null!");
+    if (chunk == nullptr)
+        return false;
+
+    const uint64_t head = _layout->head.load(std::memory_order_relaxed);
+
+    // Check if there is required free space using the cached tail cursor first
+    if ((size + head - _tail_cache) > _capacity)
+    {
+        _tail_cache = _layout->tail.load(std::memory_order_acquire);
+        if ((size + head - _tail_cache) > _capacity)
+            return false;
+    }
+
+    // Copy chunk of bytes into the ring buffer
+    size_t head_index = (size_t)(head & _mask);
+    size_t remain = (size_t)_capacity - head_index;
+    size_t first = (size > remain) ? remain : size;
+    size_t last = (size > remain) ? size - remain : 0;
+    memcpy(&_buffer[head_index], (const uint8_t*)chunk, first);
+    memcpy(_buffer, (const uint8_t*)chunk + first, last);
+
+    // Increase the head cursor
+    _layout->head.store(head + size, std::memory_order_release);
+
+    _layout->not_empty.NotifyOne();
+    return true;
+}
+
+inline bool SharedSPSCRingBuffer::Enqueue(const void* chunk, size_t size)
+{
+    assert((size <= _capacity) && "Chunk size should not be greater than ring buffer capacity!");
+    if (size > _capacity)
+        return false;
+
+    return Internals::SharedRing::Park(_layout->header, _layout->not_full, _spin, [this, chunk, size]() { return TryEnqueue(chunk, size); }, false);
+}
+
+inline bool SharedSPSCRingBuffer::TryDequeue(void* chunk, size_t& size)
+{
+    if (size == 0)
+        return true;
+
+    assert((chunk != nullptr) && "Pointer to the chunk should not be null!");
+    if (chunk == nullptr)
+        return false;
+
+    const uint64_t tail = _layout->tail.load(std::memory_order_relaxed);
+
+    // Reload the head cursor only if the cached one shows not enough used space
+    if ((_head_cache - tail) < size)
+        _head_cache = _layout->head.load(std::memory_order_acquire);
+
+    // Check if the ring buffer is empty
+    size_t available = (size_t)(_head_cache - tail);
+    if (available == 0)
+        return false;
+    if (size > available)
+        size = available;
+
+    // Copy chunk of bytes from the ring buffer
+    size_t tail_index = (size_t)(tail & _mask);
+    size_t remain = (size_t)_capacity - tail_index;
+    size_t first = (size > remain) ? remain : size;
+    size_t last = (size > remain) ? size - remain : 0;
+    memcpy((uint8_t*)chunk, &_buffer[tail_index], first);
+    memcpy((uint8_t*)chunk + first, _buffer, last);
+
+    // Increase the tail cursor
+    _layout->tail.store(tail + size, std::memory_order_release);
+
+    _layout->not_full.NotifyOne();
+    return true;
+}
+
+inline bool SharedSPSCRingBuffer::Dequeue(void* chunk, size_t& size)
+{
+    const size_t requested = size;
+    return Internals::SharedRing::Park(_layout->header, _layout->not_empty, _spin, [this, chunk, &size, requested]() { size = requested; return TryDequeue(chunk, size); }, true);
+}
+
+} // namespace CppCommon
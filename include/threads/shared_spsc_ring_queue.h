@@ -0,0 +1,154 @@
+/*!
+    \file shared_spsc_ring_queue.h
+    \brief Shared memory single producer / single consumer wait-free ring queue definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SPSC_RING_QUEUE_H
+#define CPPCOMMON_THREADS_SHARED_SPSC_RING_QUEUE_H
+
+#include "system/shared_memory.h"
+#include "threads/shared_ring_header.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Shared memory single producer / single consumer wait-free ring queue
+/*!
+    Shared memory single producer / single consumer wait-free ring queue is
+    constructed in place in the named shared memory segment, so the producer
+    and the consumer could live in different processes. The segment starts
+    with the header which is validated (version, type, item size, capacity)
+    by every process opening the existing ring queue.
+
+    Try methods never block. Blocking methods spin for a while and then park
+    the current thread on the process-shared futex until the ring queue
+    changes its state. Wake-up system calls are issued only when someone is
+    really parked, so uncontended operations never enter the kernel.
+
+    Item type must be trivially copyable, because items are copied between
+    address spaces by value.
+
+    FIFO order is guaranteed!
+
+    Thread-safe (one producer and one consumer thread in any processes).
+*/
+template<typename T>
+class SharedSPSCRingQueue
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Shared memory ring queue item type must be trivially copyable!");
+
+public:
+    //! Create a new or open existing shared memory ring queue with a given name and capacity
+    /*!
+        \param name - Shared memory ring queue name
+        \param capacity - Ring queue capacity (must be a power of two)
+        \param spin - Spin attempts before the thread is parked (default is 128)
+    */
+    explicit SharedSPSCRingQueue(const std::string& name, size_t capacity, size_t spin = 128);
+    SharedSPSCRingQueue(const SharedSPSCRingQueue&) = delete;
+    SharedSPSCRingQueue(SharedSPSCRingQueue&&) = delete;
+    ~SharedSPSCRingQueue() = default;
+
+    SharedSPSCRingQueue& operator=(const SharedSPSCRingQueue&) = delete;
+    SharedSPSCRingQueue& operator=(SharedSPSCRingQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the shared memory ring queue name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared memory ring queue owner flag (true if the new one was created, false if the existing one was opened)
+    bool owner() const { return _shared.owner(); }
+
+    //! Is ring queue closed?
+    bool closed() const noexcept { return Internals::SharedRing::Closed(_layout->header); }
+
+    //! Is ring queue empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring queue capacity
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get ring queue size
+    size_t size() const noexcept;
+
+    //! Try to enqueue an item into the ring queue (single producer thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full or closed
+    */
+    bool TryEnqueue(const T& item);
+    //! Enqueue an item into the ring queue (single producer thread method)
+    /*!
+        Will block while the ring queue is full.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the ring queue is closed
+    */
+    bool Enqueue(const T& item);
+
+    //! Try to dequeue an item from the ring queue (single consumer thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
+    */
+    bool TryDequeue(T& item);
+    //! Dequeue an item from the ring queue (single consumer thread method)
+    /*!
+        Items left in the closed ring queue are still available for dequeue.
+
+        Will block while the ring queue is empty.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the ring queue is closed and empty
+    */
+    bool Dequeue(T& item);
+
+    //! Close the ring queue
+    /*!
+        All parked producers and consumers in all processes will be woken up.
+
+        Will not block.
+    */
+    void Close() { Internals::SharedRing::Close(_layout->header, _layout->not_empty, _layout->not_full); }
+
+private:
+    // Shared memory layout, items buffer follows the layout
+    struct Layout
+    {
+        Internals::SharedRingHeader header;
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head;
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail;
+        alignas(CACHE_LINE_SIZE) EventCount not_empty;
+        alignas(CACHE_LINE_SIZE) EventCount not_full;
+    };
+
+    SharedMemory _shared;
+    Layout* const _layout;
+    T* const _buffer;
+    const uint64_t _capacity;
+    const uint64_t _mask;
+    const size_t _spin;
+
+    // Producer and consumer cached cursors (local to the process)
+    alignas(CACHE_LINE_SIZE) uint64_t _tail_cache;
+    alignas(CACHE_LINE_SIZE) uint64_t _head_cache;
+};
+
+/*! \example threads_shared_spsc_ring_queue.cpp Shared memory single producer / single consumer wait-free ring queue example */
+
+} // namespace CppCommon
+
+#include "shared_spsc_ring_queue.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_SPSC_RING_QUEUE_H
@@ -0,0 +1,110 @@
+/*!
+    \file shared_spsc_ring_queue.inl
+    \brief Shared memory single producer / single consumer wait-free ring queue inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline SharedSPSCRingQueue<T>::SharedSPSCRingQueue(const std::string& name, size_t capacity, size_t spin)
+    : _shared(name, sizeof(Layout) + capacity * sizeof(T)),
+      _layout((Layout*)_shared.ptr()),
+      _buffer((T*)(_layout + 1)),
+      _capacity(capacity),
+      _mask(capacity - 1),
+      _spin(spin),
+      _tail_cache(0),
+      _head_cache(0)
+{
+    assert((capacity > 1) && "Ring queue capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
+
+    // Only the owner should initialize the shared memory layout
+    if (_shared.owner())
+    {
+        _layout->head.store(0, std::memory_order_relaxed);
+        _layout->tail.store(0, std::memory_order_relaxed);
+        new (&_layout->not_empty) EventCount(true);
+        new (&_layout->not_full) EventCount(true);
+    }
+
+    Internals::SharedRing::Open(_layout->header, _shared.owner(), Internals::SharedRingHeader::SPSC_RING_QUEUE, sizeof(T), capacity);
+
+    _tail_cache = _layout->tail.load(std::memory_order_acquire);
+    _head_cache = _layout->head.load(std::memory_order_acquire);
+}
+
+template<typename T>
+inline size_t SharedSPSCRingQueue<T>::size() const noexcept
+{
+    const uint64_t head = _layout->head.load(std::memory_order_acquire);
+    const uint64_t tail = _layout->tail.load(std::memory_order_acquire);
+
+    return (size_t)(head - tail);
+}
+
+template<typename T>
+inline bool SharedSPSCRingQueue<T>::TryEnqueue(const T& item)
+{
+    if (closed())
+        return false;
+
+    const uint64_t head = _layout->head.load(std::memory_order_relaxed);
+
+    // Check if the ring queue is full using the cached tail cursor first
+    if ((head - _tail_cache) == _capacity)
+    {
+        _tail_cache = _layout->tail.load(std::memory_order_acquire);
+        if ((head - _tail_cache) == _capacity)
+            return false;
+    }
+
+    // Store the item value
+    _buffer[head & _mask] = item;
+
+    // Increase the head cursor
+    _layout->head.store(head + 1, std::memory_order_release);
+
+    _layout->not_empty.NotifyOne();
+    return true;
+}
+
+template<typename T>
+inline bool SharedSPSCRingQueue<T>::Enqueue(const T& item)
+{
+    return Internals::SharedRing::Park(_layout->header, _layout->not_full, _spin, [this, &item]() { return TryEnqueue(item); }, false);
+}
+
+template<typename T>
+inline bool SharedSPSCRingQueue<T>::TryDequeue(T& item)
+{
+    const uint64_t tail = _layout->tail.load(std::memory_order_relaxed);
+
+    // Check if the ring queue is empty using the cached head cursor first
+    if (_head_cache == tail)
+    {
+        _head_cache = _layout->head.load(std::memory_order_acquire);
+        if (_head_cache == tail)
+            return false;
+    }
+
+    // Get the item value
+    item = _buffer[tail & _mask];
+
+    // Increase the tail cursor
+    _layout->tail.store(tail + 1, std::memory_order_release);
+
+    _layout->not_full.NotifyOne();
+    return true;
+}
+
+template<typename T>
+inline bool SharedSPSCRingQueue<T>::Dequeue(T& item)
+{
+    return Internals::SharedRing::Park(_layout->header, _layout->not_empty, _spin, [this, &item]() { return TryDequeue(item); }, true);
+}
+
+} // namespace CppCommon
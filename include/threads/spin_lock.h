@@ -10,6 +10,7 @@
 #define CPPCOMMON_THREADS_SPIN_LOCK_H
 
 #include "threads/locker.h"
+#include "threads/spin_wait.h"
 #include "time/timestamp.h"
 
 #include <atomic>
@@ -22,6 +23,13 @@ namespace CppCommon {
     In contrast to a mutex, threads will busy-wait and waste CPU cycles instead of yielding the CPU to another thread.
     Do not use spinlocks unless you are certain that you understand the consequences!
 
+    Spin-lock is implemented as a test-and-test-and-set lock: waiting threads spin on
+    the plain load of the shared lock flag with exponential backoff (see SpinWait) and
+    try to grab it with the atomic exchange only when it looks released. This keeps the
+    lock cache line shared while it is held instead of bouncing it between contending
+    CPU cores. Spin-lock is not fair, use TicketLock, MCSLock or CLHLock when the
+    waiting threads must acquire the lock in FIFO order.
+
     Thread-safe.
 
     https://en.wikipedia.org/wiki/Spinlock
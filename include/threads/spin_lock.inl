@@ -15,7 +15,8 @@ inline bool SpinLock::IsLocked() noexcept
 
 inline bool SpinLock::TryLock() noexcept
 {
-    return !_lock.exchange(true, std::memory_order_acquire);
+    // Test the lock before the atomic exchange to avoid the cache line invalidation
+    return !_lock.load(std::memory_order_relaxed) && !_lock.exchange(true, std::memory_order_acquire);
 }
 
 inline bool SpinLock::TryLockSpin(int64_t spin) noexcept
@@ -49,7 +50,15 @@ inline bool SpinLock::TryLockFor(const Timespan& timespan) noexcept
 
 inline void SpinLock::Lock() noexcept
 {
-    while (_lock.exchange(true, std::memory_order_acquire));
+    SpinWait spin;
+    while (_lock.exchange(true, std::memory_order_acquire))
+    {
+        // Spin on the plain load until the spin-lock looks released
+        do
+        {
+            spin.Spin();
+        } while (_lock.load(std::memory_order_relaxed));
+    }
 }
 
 inline void SpinLock::Unlock() noexcept
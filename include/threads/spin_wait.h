@@ -0,0 +1,85 @@
+/*!
+    \file spin_wait.h
+    \brief Spin wait with exponential backoff definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SPIN_WAIT_H
+#define CPPCOMMON_THREADS_SPIN_WAIT_H
+
+#include "threads/thread.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_M_ARM) || defined(_M_ARM64)
+#include <intrin.h>
+#endif
+
+namespace CppCommon {
+
+//! Spin wait with exponential backoff
+/*!
+    Spin wait is used in busy-wait loops of spinning synchronization
+    primitives. Each Spin() call executes twice as many CPU pause
+    instructions as the previous one, which lowers the pressure on the
+    contended cache line and on the sibling hyper-thread. When the backoff
+    limit is reached the spinning thread yields the CPU core instead, so
+    spinning does not starve the lock owner when there are more threads
+    than CPU cores.
+
+    Not thread-safe (use one instance per waiting thread).
+*/
+class SpinWait
+{
+public:
+    //! Maximal backoff (Spin() calls with 1, 2, 4, ... pauses before yielding)
+    static const int BACKOFF_LIMIT = 6;
+
+    SpinWait() noexcept : _count(0) {}
+    SpinWait(const SpinWait&) noexcept = default;
+    SpinWait(SpinWait&&) noexcept = default;
+    ~SpinWait() noexcept = default;
+
+    SpinWait& operator=(const SpinWait&) noexcept = default;
+    SpinWait& operator=(SpinWait&&) noexcept = default;
+
+    //! Get the count of Spin() calls since the last reset
+    int count() const noexcept { return _count; }
+
+    //! Spin once with the next backoff step
+    void Spin() noexcept
+    {
+        if (_count < BACKOFF_LIMIT)
+        {
+            for (int i = 0; i < (1 << _count); ++i)
+                Pause();
+        }
+        else
+            Thread::Yield();
+        ++_count;
+    }
+
+    //! Reset the backoff
+    void Reset() noexcept { _count = 0; }
+
+    //! Hint the CPU core that the current thread is in a spin-wait loop
+    static void Pause() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#elif defined(_M_ARM) || defined(_M_ARM64)
+        __yield();
+#endif
+    }
+
+private:
+    int _count;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_SPIN_WAIT_H
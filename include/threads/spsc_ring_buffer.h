@@ -9,10 +9,15 @@
 #ifndef CPPCOMMON_THREADS_SPSC_RING_BUFFER_H
 #define CPPCOMMON_THREADS_SPSC_RING_BUFFER_H
 
+#include "memory/mirrored_memory.h"
+#include "utility/cache_line.h"
+
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 
 namespace CppCommon {
 
@@ -21,6 +26,15 @@ namespace CppCommon {
     Single producer / single consumer wait-free ring buffer use only atomic operations to provide thread-safe enqueue
     and dequeue operations. Ring buffer is bounded to the fixed capacity provided in the constructor.
 
+    Reserve()/Commit() and Peek()/Release() methods provide zero-copy access
+    to the ring buffer memory. In the mirrored mode the ring buffer memory is
+    mapped twice into adjacent virtual memory regions, so regions wrapped
+    around the ring buffer end are always contiguous.
+
+    Producer and consumer keep cached copies of each other's cursors and
+    reload them only when the ring buffer looks full or empty, so in steady
+    state each side touches only its own cache line.
+
     FIFO order is guaranteed!
 
     Thread-safe.
@@ -34,12 +48,16 @@ class SPSCRingBuffer
 public:
     //! Default class constructor
     /*!
+        Mirrored ring buffer capacity must be a multiple of the virtual memory
+        granularity (see MirroredMemory::Granularity()).
+
         \param capacity - Ring buffer capacity (must be a power of two)
+        \param mirrored - Mirrored mode flag (default is false)
     */
-    explicit SPSCRingBuffer(size_t capacity);
+    explicit SPSCRingBuffer(size_t capacity, bool mirrored = false);
     SPSCRingBuffer(const SPSCRingBuffer&) = delete;
     SPSCRingBuffer(SPSCRingBuffer&&) = delete;
-    ~SPSCRingBuffer() { delete[] _buffer; }
+    ~SPSCRingBuffer() { if (!_mirror) delete[] _buffer; }
 
     SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
     SPSCRingBuffer& operator=(SPSCRingBuffer&&) = delete;
@@ -53,6 +71,8 @@ public:
     size_t capacity() const noexcept { return _capacity; }
     //! Get ring buffer size in bytes
     size_t size() const noexcept;
+    //! Is ring buffer mirrored?
+    bool mirrored() const noexcept { return (bool)_mirror; }
 
     //! Enqueue a chunk of bytes into the ring buffer (single producer thread method)
     /*!
@@ -67,6 +87,25 @@ public:
     */
     bool Enqueue(const void* chunk, size_t size);
 
+    //! Reserve a contiguous region of the ring buffer to write (single producer thread method)
+    /*!
+        The producer writes directly into the reserved region and publishes
+        it with the Commit() method. In non-mirrored mode the reserved region
+        could be smaller than requested if it wraps around the ring buffer end,
+        so the rest should be reserved after the commit.
+
+        Will not block.
+
+        \param size - Requested region size, will be updated with the reserved region size
+        \return Pointer to the reserved region or nullptr if there is no requested free space in the ring buffer
+    */
+    void* Reserve(size_t& size);
+    //! Commit the previously reserved region of the ring buffer (single producer thread method)
+    /*!
+        \param size - Committed region size (must not be greater than the reserved region size)
+    */
+    void Commit(size_t size);
+
     //! Dequeue a chunk of bytes from the ring buffer (single consumer thread method)
     /*!
         The chunk of bytes will be copied from the ring buffer using 'memcpy()' function.
@@ -79,19 +118,47 @@ public:
     */
     bool Dequeue(void* chunk, size_t& size);
 
-private:
-    typedef char cache_line_pad[128];
+    //! Peek a contiguous region of the ring buffer to read (single consumer thread method)
+    /*!
+        The consumer reads directly from the peeked region and frees it with
+        the Release() method. In non-mirrored mode the peeked region ends at
+        the ring buffer end, so the rest should be peeked after the release.
+
+        The peeked region is limited with the cached producer cursor, which
+        is reloaded only when the cached one shows no data. Data enqueued
+        after the previous reload is peeked after the release.
+
+        Will not block.
+
+        \param size - Peeked region size
+        \return Pointer to the peeked region or nullptr if the ring buffer is empty
+    */
+    const void* Peek(size_t& size);
+    //! Release the previously peeked region of the ring buffer (single consumer thread method)
+    /*!
+        \param size - Released region size (must not be greater than the peeked region size)
+    */
+    void Release(size_t size);
 
-    cache_line_pad _pad0;
-    const size_t _capacity;
+private:
+    // Shared read-only state
+    alignas(CACHE_LINE_SIZE) const size_t _capacity;
     const size_t _mask;
+    std::unique_ptr<MirroredMemory> _mirror;
     uint8_t* const _buffer;
 
-    cache_line_pad _pad1;
-    std::atomic<size_t> _head;
-    cache_line_pad _pad2;
-    std::atomic<size_t> _tail;
-    cache_line_pad _pad3;
+    // Producer state: head cursor and the cached tail cursor
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head;
+    size_t _tail_cache;
+
+    // Consumer state: tail cursor and the cached head cursor
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail;
+    size_t _head_cache;
+
+    //! Get the free space in the ring buffer (producer side)
+    size_t FreeSpace(size_t head, size_t required) noexcept;
+    //! Get the used space in the ring buffer (consumer side)
+    size_t UsedSpace(size_t tail, size_t required) noexcept;
 };
 
 /*! \example threads_spsc_ring_buffer.cpp Single producer / single consumer wait-free ring buffer example */
@@ -8,15 +8,18 @@
 
 namespace CppCommon {
 
-inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _buffer(new uint8_t[capacity]), _head(0), _tail(0)
+inline SPSCRingBuffer::SPSCRingBuffer(size_t capacity, bool mirrored)
+    : _capacity(capacity),
+      _mask(capacity - 1),
+      _mirror(mirrored ? std::make_unique<MirroredMemory>(capacity) : nullptr),
+      _buffer(mirrored ? (uint8_t*)_mirror->ptr() : new uint8_t[capacity]),
+      _head(0),
+      _tail_cache(0),
+      _tail(0),
+      _head_cache(0)
 {
     assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
-
-    memset(_pad0, 0, sizeof(cache_line_pad));
-    memset(_pad1, 0, sizeof(cache_line_pad));
-    memset(_pad2, 0, sizeof(cache_line_pad));
-    memset(_pad3, 0, sizeof(cache_line_pad));
 }
 
 inline size_t SPSCRingBuffer::size() const noexcept
@@ -41,16 +44,14 @@ inline bool SPSCRingBuffer::Enqueue(const void* chunk, size_t size)
         return false;
 
     const size_t head = _head.load(std::memory_order_relaxed);
-    const size_t tail = _tail.load(std::memory_order_acquire);
 
     // Check if there is required free space in the ring buffer
-    if ((size + head - tail) > _capacity)
+    if (size > FreeSpace(head, size))
         return false;
 
     // Copy chunk of bytes into the ring buffer
     size_t head_index = head & _mask;
-    size_t tail_index = tail & _mask;
-    size_t remain = (tail_index > head_index) ? (tail_index - head_index) : (_capacity - head_index);
+    size_t remain = _mirror ? size : (_capacity - head_index);
     size_t first = (size > remain) ? remain : size;
     size_t last = (size > remain) ? size - remain : 0;
     memcpy(&_buffer[head_index], (uint8_t*)chunk, first);
@@ -62,6 +63,35 @@ inline bool SPSCRingBuffer::Enqueue(const void* chunk, size_t size)
     return true;
 }
 
+inline void* SPSCRingBuffer::Reserve(size_t& size)
+{
+    const size_t head = _head.load(std::memory_order_relaxed);
+
+    // Check if there is required free space in the ring buffer
+    if ((size == 0) || (size > FreeSpace(head, size)))
+    {
+        size = 0;
+        return nullptr;
+    }
+
+    // Limit the reserved region with the ring buffer end
+    size_t head_index = head & _mask;
+    if (!_mirror)
+        size = std::min(size, _capacity - head_index);
+
+    return &_buffer[head_index];
+}
+
+inline void SPSCRingBuffer::Commit(size_t size)
+{
+    const size_t head = _head.load(std::memory_order_relaxed);
+
+    assert((size <= (_capacity - (head - _tail.load(std::memory_order_relaxed)))) && "Committed region size should not be greater than the reserved region size!");
+
+    // Increase the head cursor
+    _head.store(head + size, std::memory_order_release);
+}
+
 inline bool SPSCRingBuffer::Dequeue(void* chunk, size_t& size)
 {
     if (size == 0)
@@ -72,10 +102,9 @@ inline bool SPSCRingBuffer::Dequeue(void* chunk, size_t& size)
         return false;
 
     const size_t tail = _tail.load(std::memory_order_relaxed);
-    const size_t head = _head.load(std::memory_order_acquire);
 
     // Get the ring buffer size
-    size_t available = head - tail;
+    size_t available = UsedSpace(tail, size);
     if (size > available)
         size = available;
 
@@ -84,9 +113,8 @@ inline bool SPSCRingBuffer::Dequeue(void* chunk, size_t& size)
         return false;
 
     // Copy chunk of bytes from the ring buffer
-    size_t head_index = head & _mask;
     size_t tail_index = tail & _mask;
-    size_t remain = (head_index > tail_index) ? (head_index - tail_index) : (_capacity - tail_index);
+    size_t remain = _mirror ? size : (_capacity - tail_index);
     size_t first = (size > remain) ? remain : size;
     size_t last = (size > remain) ? size - remain : 0;
     memcpy((uint8_t*)chunk, &_buffer[tail_index], first);
@@ -98,4 +126,49 @@ inline bool SPSCRingBuffer::Dequeue(void* chunk, size_t& size)
     return true;
 }
 
+inline const void* SPSCRingBuffer::Peek(size_t& size)
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+
+    // Check if the ring buffer is empty (the head cursor is reloaded only if the cached one shows no data)
+    size = UsedSpace(tail, 1);
+    if (size == 0)
+        return nullptr;
+
+    // Limit the peeked region with the ring buffer end
+    size_t tail_index = tail & _mask;
+    if (!_mirror)
+        size = std::min(size, _capacity - tail_index);
+
+    return &_buffer[tail_index];
+}
+
+inline void SPSCRingBuffer::Release(size_t size)
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+
+    assert((size <= (_head.load(std::memory_order_relaxed) - tail)) && "Released region size should not be greater than the peeked region size!");
+
+    // Increase the tail cursor
+    _tail.store(tail + size, std::memory_order_release);
+}
+
+inline size_t SPSCRingBuffer::FreeSpace(size_t head, size_t required) noexcept
+{
+    // Reload the tail cursor only if the cached one shows not enough free space
+    if ((required + head - _tail_cache) > _capacity)
+        _tail_cache = _tail.load(std::memory_order_acquire);
+
+    return _capacity - (head - _tail_cache);
+}
+
+inline size_t SPSCRingBuffer::UsedSpace(size_t tail, size_t required) noexcept
+{
+    // Reload the head cursor only if the cached one shows not enough used space
+    if ((_head_cache - tail) < required)
+        _head_cache = _head.load(std::memory_order_acquire);
+
+    return _head_cache - tail;
+}
+
 } // namespace CppCommon
@@ -9,6 +9,8 @@
 #ifndef CPPCOMMON_THREADS_SPSC_RING_QUEUE_H
 #define CPPCOMMON_THREADS_SPSC_RING_QUEUE_H
 
+#include "utility/cache_line.h"
+
 #include <atomic>
 #include <cassert>
 #include <cstdio>
@@ -22,6 +24,10 @@ namespace CppCommon {
     Single producer / single consumer wait-free ring queue use only atomic operations to provide thread-safe enqueue
     and dequeue operations. Ring queue is bounded to the fixed capacity provided in the constructor.
 
+    Producer and consumer keep cached copies of each other's cursors and
+    reload them only when the ring queue looks full or empty, so in steady
+    state each side touches only its own cache line.
+
     FIFO order is guaranteed!
 
     Thread-safe.
@@ -76,6 +82,19 @@ public:
         \return 'true' if the item was successfully enqueue, 'false' if the ring queue is full
     */
     bool Enqueue(T&& item);
+    //! Enqueue a bulk of items into the ring queue (single producer thread method)
+    /*!
+        Items will be moved into the ring queue. All enqueued items are
+        claimed with a single update of the ring queue cursor.
+
+        Will not block.
+
+        \param first - Iterator to the first item to enqueue
+        \param count - Count of items to enqueue
+        \return Count of successfully enqueued items (less than the given count if the ring queue is full)
+    */
+    template <class InputIterator>
+    size_t EnqueueBulk(InputIterator first, size_t count);
 
     //! Dequeue an item from the ring queue (single consumer thread method)
     /*!
@@ -87,20 +106,33 @@ public:
         \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
     */
     bool Dequeue(T& item);
+    //! Dequeue a bulk of items from the ring queue (single consumer thread method)
+    /*!
+        Items will be moved from the ring queue. All dequeued items are
+        claimed with a single update of the ring queue cursor.
 
-private:
-    typedef char cache_line_pad[128];
+        Will not block.
 
-    cache_line_pad _pad0;
-    const size_t _capacity;
+        \param first - Output iterator to store dequeued items
+        \param count - Maximal count of items to dequeue
+        \return Count of successfully dequeued items (zero if the ring queue is empty)
+    */
+    template <class OutputIterator>
+    size_t DequeueBulk(OutputIterator first, size_t count);
+
+private:
+    // Shared read-only state
+    alignas(CACHE_LINE_SIZE) const size_t _capacity;
     const size_t _mask;
     T* const _buffer;
 
-    cache_line_pad _pad1;
-    std::atomic<size_t> _head;
-    cache_line_pad _pad2;
-    std::atomic<size_t> _tail;
-    cache_line_pad _pad3;
+    // Producer state: head cursor and the cached tail cursor
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head;
+    size_t _tail_cache;
+
+    // Consumer state: tail cursor and the cached head cursor
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail;
+    size_t _head_cache;
 };
 
 /*! \example threads_spsc_ring_queue.cpp Single producer / single consumer wait-free ring queue example */
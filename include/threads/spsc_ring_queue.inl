@@ -9,15 +9,17 @@
 namespace CppCommon {
 
 template<typename T>
-inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity) : _capacity(capacity - 1), _mask(capacity - 1), _buffer(new T[capacity]), _head(0), _tail(0)
+inline SPSCRingQueue<T>::SPSCRingQueue(size_t capacity)
+    : _capacity(capacity - 1),
+      _mask(capacity - 1),
+      _buffer(new T[capacity]),
+      _head(0),
+      _tail_cache(0),
+      _tail(0),
+      _head_cache(0)
 {
     assert((capacity > 1) && "Ring queue capacity must be greater than one!");
     assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
-
-    memset(_pad0, 0, sizeof(cache_line_pad));
-    memset(_pad1, 0, sizeof(cache_line_pad));
-    memset(_pad2, 0, sizeof(cache_line_pad));
-    memset(_pad3, 0, sizeof(cache_line_pad));
 }
 
 template<typename T>
@@ -40,11 +42,14 @@ template<typename T>
 inline bool SPSCRingQueue<T>::Enqueue(T&& item)
 {
     const size_t head = _head.load(std::memory_order_relaxed);
-    const size_t tail = _tail.load(std::memory_order_acquire);
 
-    // Check if the ring queue is full
-    if (((head - tail + 1) & _mask) == 0)
-        return false;
+    // Check if the ring queue is full using the cached tail cursor first
+    if (((head - _tail_cache + 1) & _mask) == 0)
+    {
+        _tail_cache = _tail.load(std::memory_order_acquire);
+        if (((head - _tail_cache + 1) & _mask) == 0)
+            return false;
+    }
 
     // Store the item value
     _buffer[head & _mask] = std::move(item);
@@ -55,15 +60,48 @@ inline bool SPSCRingQueue<T>::Enqueue(T&& item)
     return true;
 }
 
+template<typename T>
+template <class InputIterator>
+inline size_t SPSCRingQueue<T>::EnqueueBulk(InputIterator first, size_t count)
+{
+    const size_t head = _head.load(std::memory_order_relaxed);
+
+    // Calculate the count of items to enqueue using the cached tail cursor first
+    size_t available = _capacity - ((head - _tail_cache) & _mask);
+    if (count > available)
+    {
+        _tail_cache = _tail.load(std::memory_order_acquire);
+        available = _capacity - ((head - _tail_cache) & _mask);
+        if (count > available)
+            count = available;
+    }
+
+    // Check if the ring queue is full
+    if (count == 0)
+        return 0;
+
+    // Store the items values
+    for (size_t i = 0; i < count; ++i, ++first)
+        _buffer[(head + i) & _mask] = std::move(*first);
+
+    // Increase the head cursor
+    _head.store(head + count, std::memory_order_release);
+
+    return count;
+}
+
 template<typename T>
 inline bool SPSCRingQueue<T>::Dequeue(T& item)
 {
     const size_t tail = _tail.load(std::memory_order_relaxed);
-    const size_t head = _head.load(std::memory_order_acquire);
 
-    // Check if the ring queue is empty
-    if (((head - tail) & _mask) == 0)
-        return false;
+    // Check if the ring queue is empty using the cached head cursor first
+    if (((_head_cache - tail) & _mask) == 0)
+    {
+        _head_cache = _head.load(std::memory_order_acquire);
+        if (((_head_cache - tail) & _mask) == 0)
+            return false;
+    }
 
     // Get the item value
     item = std::move(_buffer[tail & _mask]);
@@ -74,4 +112,34 @@ inline bool SPSCRingQueue<T>::Dequeue(T& item)
     return true;
 }
 
+template<typename T>
+template <class OutputIterator>
+inline size_t SPSCRingQueue<T>::DequeueBulk(OutputIterator first, size_t count)
+{
+    const size_t tail = _tail.load(std::memory_order_relaxed);
+
+    // Calculate the count of items to dequeue using the cached head cursor first
+    size_t available = (_head_cache - tail) & _mask;
+    if (available < count)
+    {
+        _head_cache = _head.load(std::memory_order_acquire);
+        available = (_head_cache - tail) & _mask;
+    }
+    if (count > available)
+        count = available;
+
+    // Check if the ring queue is empty
+    if (count == 0)
+        return 0;
+
+    // Get the items values
+    for (size_t i = 0; i < count; ++i, ++first)
+        *first = std::move(_buffer[(tail + i) & _mask]);
+
+    // Increase the tail cursor
+    _tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
 } // namespace CppCommon
@@ -0,0 +1,165 @@
+/*!
+    \file task.h
+    \brief Coroutine task definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TASK_H
+#define CPPCOMMON_THREADS_TASK_H
+
+#include "threads/futex.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace CppCommon {
+
+template<typename T>
+class Task;
+
+//! @cond INTERNALS
+namespace Internals {
+
+class TaskPromiseBase
+{
+public:
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <class TPromise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> handle) noexcept { return handle.promise().Complete(); }
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() noexcept { _exception = std::current_exception(); }
+
+    //! Set the coroutine to resume when the task is completed
+    void Continue(std::coroutine_handle<> continuation) noexcept { _continuation = continuation; }
+    //! Set the futex word to signal when the task is completed
+    void Notify(std::atomic<uint32_t>* completion) noexcept { _completion = completion; }
+
+    //! Complete the task and get the coroutine to resume
+    std::coroutine_handle<> Complete() noexcept
+    {
+        if (_continuation)
+            return _continuation;
+
+        if (_completion != nullptr)
+        {
+            std::atomic<uint32_t>& completion = *_completion;
+            completion.store(1, std::memory_order_release);
+            Futex::WakeAll(completion);
+        }
+
+        return std::noop_coroutine();
+    }
+
+protected:
+    std::coroutine_handle<> _continuation;
+    std::atomic<uint32_t>* _completion{nullptr};
+    std::exception_ptr _exception;
+
+    void Rethrow() const
+    {
+        if (_exception)
+            std::rethrow_exception(_exception);
+    }
+};
+
+template<typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    Task<T> get_return_object() noexcept;
+
+    template <class TValue>
+    void return_value(TValue&& value) { _value.emplace(std::forward<TValue>(value)); }
+
+    T Result() { Rethrow(); return std::move(*_value); }
+
+private:
+    std::optional<T> _value;
+};
+
+template<>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void Result() { Rethrow(); }
+};
+
+} // namespace Internals
+//! @endcond
+
+//! Coroutine task
+/*!
+    Coroutine task is a lazily started coroutine which produces a value of
+    the given type (or nothing for void). The task does not run until it is
+    awaited with co_await by another coroutine or waited with Get() by the
+    regular thread. The awaiting coroutine is resumed by the completed task
+    directly (symmetric transfer), so deep chains of tasks do not grow the
+    stack.
+
+    Exceptions thrown inside the task are re-thrown in the awaiting code.
+
+    Not thread-safe (the task must be awaited only once).
+*/
+template<typename T = void>
+class Task
+{
+public:
+    typedef Internals::TaskPromise<T> promise_type;
+
+    Task() noexcept = default;
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+    Task(const Task&) = delete;
+    Task(Task&& task) noexcept : _handle(std::exchange(task._handle, nullptr)) {}
+    ~Task() { if (_handle) _handle.destroy(); }
+
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&& task) noexcept;
+
+    //! Check if the task is valid
+    explicit operator bool() const noexcept { return (bool)_handle; }
+
+    //! Is the task completed?
+    bool done() const noexcept { return !_handle || _handle.done(); }
+
+    //! Await the task (start it and suspend the awaiting coroutine until the task is completed)
+    auto operator co_await() && noexcept;
+    auto operator co_await() & noexcept;
+
+    //! Start the task on the current thread and block until it is completed
+    /*!
+        Will block.
+
+        \return Task result
+    */
+    T Get();
+
+    //! Release the coroutine handle of the task
+    std::coroutine_handle<promise_type> Release() noexcept { return std::exchange(_handle, nullptr); }
+
+private:
+    std::coroutine_handle<promise_type> _handle;
+};
+
+/*! \example threads_task.cpp Coroutine task example */
+
+} // namespace CppCommon
+
+#include "task.inl"
+
+#endif // CPPCOMMON_THREADS_TASK_H
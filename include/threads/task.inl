@@ -0,0 +1,85 @@
+/*!
+    \file task.inl
+    \brief Coroutine task inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+template<typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+template<typename T>
+struct TaskAwaiter
+{
+    std::coroutine_handle<TaskPromise<T>> handle;
+
+    bool await_ready() const noexcept { return !handle || handle.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        // Start the task and resume the awaiting coroutine when it is completed
+        handle.promise().Continue(awaiting);
+        return handle;
+    }
+
+    T await_resume() { return handle.promise().Result(); }
+};
+
+} // namespace Internals
+//! @endcond
+
+template<typename T>
+inline Task<T>& Task<T>::operator=(Task&& task) noexcept
+{
+    if (this != &task)
+    {
+        if (_handle)
+            _handle.destroy();
+        _handle = std::exchange(task._handle, nullptr);
+    }
+    return *this;
+}
+
+template<typename T>
+inline auto Task<T>::operator co_await() && noexcept
+{
+    return Internals::TaskAwaiter<T>{ _handle };
+}
+
+template<typename T>
+inline auto Task<T>::operator co_await() & noexcept
+{
+    return Internals::TaskAwaiter<T>{ _handle };
+}
+
+template<typename T>
+inline T Task<T>::Get()
+{
+    std::atomic<uint32_t> completion(0);
+
+    // Start the task on the current thread
+    _handle.promise().Notify(&completion);
+    _handle.resume();
+
+    // Wait for the task completed on another thread
+    while (completion.load(std::memory_order_acquire) == 0)
+        Futex::Wait(completion, 0);
+
+    return _handle.promise().Result();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,83 @@
+/*!
+    \file ticket_lock.h
+    \brief Ticket lock synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TICKET_LOCK_H
+#define CPPCOMMON_THREADS_TICKET_LOCK_H
+
+#include "threads/locker.h"
+#include "threads/spin_wait.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Ticket lock synchronization primitive
+/*!
+    Ticket lock is a fair spin lock. Each locking thread takes the next
+    ticket number and spins until the lock serves its ticket, so threads
+    acquire the lock in FIFO order. All waiting threads spin on the same
+    cache line, which is invalidated on each unlock, so the ticket lock
+    is best suited for a moderate number of contending threads.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Ticket_lock
+*/
+class TicketLock
+{
+public:
+    TicketLock() noexcept : _next(0), _serving(0) {}
+    TicketLock(const TicketLock&) = delete;
+    TicketLock(TicketLock&&) = delete;
+    ~TicketLock() = default;
+
+    TicketLock& operator=(const TicketLock&) = delete;
+    TicketLock& operator=(TicketLock&&) = delete;
+
+    //! Is already locked?
+    /*!
+        Will not block.
+
+        \return 'true' if the ticket lock is already locked, 'false' if the ticket lock is released
+    */
+    bool IsLocked() noexcept;
+
+    //! Try to acquire ticket lock without block
+    /*!
+        Will not block.
+
+        \return 'true' if the ticket lock was successfully acquired, 'false' if the ticket lock is busy
+    */
+    bool TryLock() noexcept;
+
+    //! Acquire ticket lock with block
+    /*!
+        Will block in a spin loop.
+    */
+    void Lock() noexcept;
+
+    //! Release ticket lock
+    /*!
+        Will not block.
+    */
+    void Unlock() noexcept;
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _next;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> _serving;
+};
+
+/*! \example threads_ticket_lock.cpp Ticket lock synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "ticket_lock.inl"
+
+#endif // CPPCOMMON_THREADS_TICKET_LOCK_H
@@ -0,0 +1,38 @@
+/*!
+    \file ticket_lock.inl
+    \brief Ticket lock synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool TicketLock::IsLocked() noexcept
+{
+    return (_next.load(std::memory_order_acquire) != _serving.load(std::memory_order_acquire));
+}
+
+inline bool TicketLock::TryLock() noexcept
+{
+    // Take the next ticket only if it is served right now
+    uint32_t ticket = _serving.load(std::memory_order_acquire);
+    return _next.compare_exchange_strong(ticket, ticket + 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+inline void TicketLock::Lock() noexcept
+{
+    uint32_t ticket = _next.fetch_add(1, std::memory_order_relaxed);
+
+    SpinWait spin;
+    while (_serving.load(std::memory_order_acquire) != ticket)
+        spin.Spin();
+}
+
+inline void TicketLock::Unlock() noexcept
+{
+    // Only the lock owner changes the served ticket
+    _serving.store(_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+} // namespace CppCommon
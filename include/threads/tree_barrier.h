@@ -0,0 +1,108 @@
+/*!
+    \file tree_barrier.h
+    \brief Combining tree barrier synchronization primitive definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_TREE_BARRIER_H
+#define CPPCOMMON_THREADS_TREE_BARRIER_H
+
+#include "threads/spin_wait.h"
+#include "utility/cache_line.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+
+namespace CppCommon {
+
+//! Combining tree barrier synchronization primitive
+/*!
+    A barrier for a group of threads in the source code means any thread must stop at this point and cannot
+    proceed until all other threads reach this barrier.
+
+    Combining tree barrier splits threads into small groups of the given
+    radix. Threads of the group arrive at their own tree node, and only the
+    last thread of the group climbs to the parent node. Released threads of
+    the group spin only on the cache line of their tree node, so neither
+    arrival nor release touches a cache line shared by all threads.
+
+    Waiting threads spin with the exponential backoff and yield the CPU core
+    when the backoff limit is reached.
+
+    Thread-safe.
+
+    https://en.wikipedia.org/wiki/Barrier_(computer_science)
+*/
+class TreeBarrier
+{
+public:
+    //! Default class constructor
+    /*!
+        \param threads - Count of threads to wait at the barrier
+        \param radix - Count of threads (or child nodes) per tree node (default is 4)
+    */
+    explicit TreeBarrier(int threads, int radix = 4);
+    TreeBarrier(const TreeBarrier&) = delete;
+    TreeBarrier(TreeBarrier&&) = delete;
+    ~TreeBarrier() = default;
+
+    TreeBarrier& operator=(const TreeBarrier&) = delete;
+    TreeBarrier& operator=(TreeBarrier&&) = delete;
+
+    //! Get the count of threads to wait at the barrier
+    int threads() const noexcept { return _threads; }
+    //! Get the tree radix
+    int radix() const noexcept { return _radix; }
+
+    //! Wait at the barrier until all other threads reach this barrier
+    /*!
+        Arriving threads are spread over the tree leaves with a single atomic
+        increment of the shared ticket.
+
+        Will block.
+
+        \return 'true' for the last thread that reach barrier, 'false' for each of the remaining threads
+    */
+    bool Wait() noexcept;
+    //! Wait at the barrier with the given thread index until all other threads reach this barrier
+    /*!
+        Each thread must use its own unique index in range [0, threads) and
+        all threads must use the same form of Wait() method.
+
+        Will block.
+
+        \param index - Thread index
+        \return 'true' for the last thread that reach barrier, 'false' for each of the remaining threads
+    */
+    bool Wait(int index) noexcept;
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Node
+    {
+        std::atomic<int> counter;
+        std::atomic<uint32_t> generation;
+        int size;
+        Node* parent;
+    };
+
+    int _threads;
+    int _radix;
+    std::unique_ptr<Node[]> _nodes;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> _ticket;
+
+    //! Arrive at the given tree node in the given barrier episode and wait for the release
+    bool Arrive(Node& node, uint32_t episode) noexcept;
+};
+
+/*! \example threads_tree_barrier.cpp Combining tree barrier synchronization primitive example */
+
+} // namespace CppCommon
+
+#include "tree_barrier.inl"
+
+#endif // CPPCOMMON_THREADS_TREE_BARRIER_H
@@ -0,0 +1,92 @@
+/*!
+    \file tree_barrier.inl
+    \brief Combining tree barrier synchronization primitive inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline TreeBarrier::TreeBarrier(int threads, int radix) : _threads(threads), _radix(radix), _ticket(0)
+{
+    assert((threads > 0) && "Count of barrier threads must be greater than zero!");
+    assert((radix > 1) && "Tree barrier radix must be greater than one!");
+
+    // Calculate the count of tree nodes level by level starting from leaves
+    int total = 0;
+    for (int count = threads; ; count = (count + radix - 1) / radix)
+    {
+        total += (count + radix - 1) / radix;
+        if (count <= radix)
+            break;
+    }
+
+    _nodes.reset(new Node[total]);
+
+    // Build tree levels, each node waits for its threads or child nodes
+    int first = 0;
+    for (int count = threads; ; count = (count + radix - 1) / radix)
+    {
+        int nodes = (count + radix - 1) / radix;
+        for (int i = 0; i < nodes; ++i)
+        {
+            Node& node = _nodes[first + i];
+            node.size = std::min(radix, count - i * radix);
+            node.counter.store(node.size, std::memory_order_relaxed);
+            node.generation.store(0, std::memory_order_relaxed);
+            node.parent = (nodes > 1) ? &_nodes[first + nodes + i / radix] : nullptr;
+        }
+        first += nodes;
+        if (count <= radix)
+            break;
+    }
+}
+
+inline bool TreeBarrier::Wait() noexcept
+{
+    // Spread arriving threads over the tree leaves. Threads of the next barrier episode
+    // could arrive at the leaf which is not released from the current episode yet.
+    uint64_t ticket = _ticket.fetch_add(1, std::memory_order_relaxed);
+    return Arrive(_nodes[(ticket % (uint64_t)_threads) / _radix], (uint32_t)(ticket / (uint64_t)_threads));
+}
+
+inline bool TreeBarrier::Wait(int index) noexcept
+{
+    assert(((index >= 0) && (index < _threads)) && "Thread index is out of the barrier threads range!");
+
+    // Thread always arrives at the same leaf, so its generation is the current barrier episode
+    Node& leaf = _nodes[index / _radix];
+    return Arrive(leaf, leaf.generation.load(std::memory_order_acquire));
+}
+
+inline bool TreeBarrier::Arrive(Node& node, uint32_t episode) noexcept
+{
+    SpinWait spin;
+
+    // Wait for the node released from the previous barrier episode
+    while (node.generation.load(std::memory_order_acquire) != episode)
+        spin.Spin();
+
+    // Decrease the count of waiting threads of the node
+    if (node.counter.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        // The last thread of the node arrives at the parent node
+        bool last = (node.parent != nullptr) ? Arrive(*node.parent, episode) : true;
+
+        // Reset waiting threads counter and release the node threads
+        node.counter.store(node.size, std::memory_order_relaxed);
+        node.generation.store(episode + 1, std::memory_order_release);
+
+        return last;
+    }
+
+    // Spin-wait for the node release
+    spin.Reset();
+    while (node.generation.load(std::memory_order_acquire) == episode)
+        spin.Spin();
+
+    return false;
+}
+
+} // namespace CppCommon
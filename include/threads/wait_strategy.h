@@ -0,0 +1,141 @@
+/*!
+    \file wait_strategy.h
+    \brief Sequence wait strategies definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WAIT_STRATEGY_H
+#define CPPCOMMON_THREADS_WAIT_STRATEGY_H
+
+#include "threads/event_count.h"
+#include "threads/thread.h"
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Busy spin wait strategy
+/*!
+    Busy spin wait strategy polls the awaited sequence in a tight loop.
+    Gives the lowest latency, but burns the CPU core of the waiting thread,
+    so the number of waiting threads should not exceed the number of
+    available CPU cores.
+
+    Thread-safe.
+*/
+class BusySpinWaitStrategy
+{
+public:
+    //! Wait until the available sequence reaches the given one
+    /*!
+        \param sequence - Awaited sequence
+        \param available - Available sequence provider (functor returning int64_t)
+        \param alerted - Alert flag to stop waiting
+        \return Available sequence (less than the awaited one if the wait was alerted)
+    */
+    template <class TAvailable>
+    int64_t WaitFor(int64_t sequence, TAvailable available, const std::atomic<bool>& alerted)
+    {
+        int64_t result;
+        while ((result = available()) < sequence)
+            if (alerted.load(std::memory_order_acquire))
+                return available();
+        return result;
+    }
+
+    //! Signal all waiting threads about the sequence change
+    void Signal() noexcept {}
+};
+
+//! Yielding wait strategy
+/*!
+    Yielding wait strategy polls the awaited sequence for a while and then
+    yields the CPU core to other threads between the polls. Good compromise
+    between latency and CPU usage when the number of waiting threads could
+    exceed the number of available CPU cores.
+
+    Thread-safe.
+*/
+class YieldingWaitStrategy
+{
+public:
+    //! Wait until the available sequence reaches the given one
+    /*!
+        \param sequence - Awaited sequence
+        \param available - Available sequence provider (functor returning int64_t)
+        \param alerted - Alert flag to stop waiting
+        \return Available sequence (less than the awaited one if the wait was alerted)
+    */
+    template <class TAvailable>
+    int64_t WaitFor(int64_t sequence, TAvailable available, const std::atomic<bool>& alerted)
+    {
+        int64_t result;
+        for (int spin = 0; (result = available()) < sequence; ++spin)
+        {
+            if (alerted.load(std::memory_order_acquire))
+                return available();
+            if (spin >= SPIN_TRIES)
+                Thread::Yield();
+        }
+        return result;
+    }
+
+    //! Signal all waiting threads about the sequence change
+    void Signal() noexcept {}
+
+private:
+    static const int SPIN_TRIES = 100;
+};
+
+//! Blocking wait strategy
+/*!
+    Blocking wait strategy polls the awaited sequence for a short while and
+    then parks the waiting thread on an event count. Signal issues a wake-up
+    system call only if some thread is really parked, so signaling is cheap
+    while all waiters keep up with the sequence. Gives the lowest CPU usage at
+    the cost of the wake-up latency.
+
+    Thread-safe.
+*/
+class BlockingWaitStrategy
+{
+public:
+    BlockingWaitStrategy() = default;
+    BlockingWaitStrategy(const BlockingWaitStrategy&) = delete;
+    BlockingWaitStrategy(BlockingWaitStrategy&&) = delete;
+    ~BlockingWaitStrategy() = default;
+
+    BlockingWaitStrategy& operator=(const BlockingWaitStrategy&) = delete;
+    BlockingWaitStrategy& operator=(BlockingWaitStrategy&&) = delete;
+
+    //! Wait until the available sequence reaches the given one
+    /*!
+        \param sequence - Awaited sequence
+        \param available - Available sequence provider (functor returning int64_t)
+        \param alerted - Alert flag to stop waiting
+        \return Available sequence (less than the awaited one if the wait was alerted)
+    */
+    template <class TAvailable>
+    int64_t WaitFor(int64_t sequence, TAvailable available, const std::atomic<bool>& alerted)
+    {
+        int64_t result = 0;
+        _event.Wait([&result, &available, &alerted, sequence]() { result = available(); return (result >= sequence) || alerted.load(std::memory_order_acquire); }, SPIN_TRIES);
+        return (result >= sequence) ? result : available();
+    }
+
+    //! Signal all waiting threads about the sequence change
+    void Signal() noexcept { _event.NotifyAll(); }
+
+private:
+    static const int SPIN_TRIES = 100;
+
+    alignas(CACHE_LINE_SIZE) EventCount _event;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_WAIT_STRATEGY_H
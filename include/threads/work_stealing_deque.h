@@ -0,0 +1,120 @@
+/*!
+    \file work_stealing_deque.h
+    \brief Work-stealing lock-free deque definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+#define CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
+
+#include "utility/cache_line.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Work-stealing lock-free deque
+/*!
+    Work-stealing deque is owned by a single thread which pushes and pops
+    items at the bottom end in LIFO order. Any other thread could steal items
+    from the top end in FIFO order. Owner operations do not use atomic
+    read-modify-write operations unless the deque contains the last item.
+
+    Deque grows when it is full. Previous buffers are kept until the deque is
+    destroyed, because thieves could still read from them.
+
+    Item type must be trivially copyable (usually a pointer to the task).
+
+    Thread-safe (Push() and Pop() only from the owner thread).
+
+    C++ implementation of Chase-Lev work-stealing deque for weak memory models
+    https://www.di.ens.fr/~zappa/readings/ppopp13.pdf
+*/
+template<typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Work-stealing deque item type must be trivially copyable!");
+
+public:
+    //! Default class constructor
+    /*!
+        \param capacity - Initial deque capacity (must be a power of two, default is 1024)
+    */
+    explicit WorkStealingDeque(size_t capacity = 1024);
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    ~WorkStealingDeque() = default;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    //! Check if the deque is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is deque empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get deque capacity
+    size_t capacity() const noexcept { return (size_t)_buffer.load(std::memory_order_relaxed)->capacity; }
+    //! Get deque size
+    size_t size() const noexcept;
+
+    //! Push an item to the bottom of the deque (owner thread method)
+    /*!
+        Deque grows if it is full.
+
+        \param item - Item to push
+    */
+    void Push(T item);
+
+    //! Pop an item from the bottom of the deque (owner thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to pop
+        \return 'true' if the item was successfully popped, 'false' if the deque is empty
+    */
+    bool Pop(T& item);
+
+    //! Steal an item from the top of the deque (any thread method)
+    /*!
+        Will not block.
+
+        \param item - Item to steal
+        \return 'true' if the item was successfully stolen, 'false' if the deque is empty or another thread won the race
+    */
+    bool Steal(T& item);
+
+private:
+    struct Buffer
+    {
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+
+        explicit Buffer(int64_t size) : capacity(size), mask(size - 1), items(new std::atomic<T>[size]) {}
+
+        T Load(int64_t index) const noexcept { return items[index & mask].load(std::memory_order_relaxed); }
+        void Store(int64_t index, T item) noexcept { items[index & mask].store(item, std::memory_order_relaxed); }
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _top;
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> _bottom;
+    std::atomic<Buffer*> _buffer;
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+
+    //! Grow the deque buffer (owner thread method)
+    Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom);
+};
+
+} // namespace CppCommon
+
+#include "work_stealing_deque.inl"
+
+#endif // CPPCOMMON_THREADS_WORK_STEALING_DEQUE_H
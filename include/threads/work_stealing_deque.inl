@@ -0,0 +1,108 @@
+/*!
+    \file work_stealing_deque.inl
+    \brief Work-stealing lock-free deque inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : _top(0), _bottom(0)
+{
+    assert((capacity > 1) && "Work-stealing deque capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Work-stealing deque capacity must be a power of two!");
+
+    _buffers.emplace_back(new Buffer((int64_t)capacity));
+    _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+template<typename T>
+inline size_t WorkStealingDeque<T>::size() const noexcept
+{
+    int64_t bottom = _bottom.load(std::memory_order_acquire);
+    int64_t top = _top.load(std::memory_order_acquire);
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+template<typename T>
+inline void WorkStealingDeque<T>::Push(T item)
+{
+    int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    int64_t top = _top.load(std::memory_order_acquire);
+    Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+
+    // Grow the full deque
+    if ((bottom - top) > (buffer->capacity - 1))
+        buffer = Grow(buffer, top, bottom);
+
+    buffer->Store(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Pop(T& item)
+{
+    int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = _buffer.load(std::memory_order_relaxed);
+
+    // Reserve the bottom item before checking the top. Paired with the fence in Steal().
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    // Check if the deque is empty
+    if (top > bottom)
+    {
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = buffer->Load(bottom);
+    if (top < bottom)
+        return true;
+
+    // The last item races with thieves
+    bool success = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return success;
+}
+
+template<typename T>
+inline bool WorkStealingDeque<T>::Steal(T& item)
+{
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    // Check if the deque is empty
+    if (top >= bottom)
+        return false;
+
+    // Read the item before claiming it, the buffer slot could be overwritten after the claim
+    Buffer* buffer = _buffer.load(std::memory_order_acquire);
+    T result = buffer->Load(top);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    item = result;
+    return true;
+}
+
+template<typename T>
+inline typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::Grow(Buffer* buffer, int64_t top, int64_t bottom)
+{
+    // Copy all items into the buffer of the double capacity
+    Buffer* grown = new Buffer(buffer->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i)
+        grown->Store(i, buffer->Load(i));
+
+    // Keep the previous buffer alive for concurrent thieves
+    _buffers.emplace_back(grown);
+    _buffer.store(grown, std::memory_order_release);
+    return grown;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,225 @@
+/*!
+    \file work_stealing_pool.h
+    \brief Work-stealing thread pool definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_WORK_STEALING_POOL_H
+#define CPPCOMMON_THREADS_WORK_STEALING_POOL_H
+
+#include "common/function.h"
+#include "threads/event_count.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/work_stealing_deque.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace CppCommon {
+
+//! Work-stealing thread pool
+/*!
+    Work-stealing thread pool runs tasks on a fixed set of worker threads.
+    Each worker owns a Chase-Lev deque: tasks spawned by the worker are pushed
+    to and popped from its bottom (LIFO, cache friendly), while idle workers
+    steal tasks from the top of random victims (FIFO, large chunks of work).
+    Tasks submitted from other threads go through the shared injection queue.
+
+    Tasks are stored in the allocation free Function<> instances of the
+    preallocated tasks table, so submitting a task does not allocate memory.
+    Fork/join helpers (Invoke(), ParallelFor()) keep their tasks on the stack
+    of the forking thread and help to run other tasks while joining.
+
+    Idle workers spin for a while and then park on the event count until new
+    tasks are pushed.
+
+    Tasks must not throw exceptions.
+
+    Thread-safe.
+*/
+class WorkStealingPool
+{
+public:
+    //! Maximal size of the task closure in bytes
+    static const size_t TASK_SIZE = 128;
+
+    //! Pool task
+    typedef Function<void(), TASK_SIZE> Task;
+
+    //! Default class constructor
+    /*!
+        When the affinity is enabled workers are bound round-robin to the
+        logical CPUs allowed by the affinity mask of the creating thread.
+
+        \param workers - Workers count (default is 0 for CPU::PhysicalCores())
+        \param affinity - Bind workers to CPU cores (default is true)
+        \param tasks - Maximal count of pending submitted tasks (must be a power of two, default is 4096)
+    */
+    explicit WorkStealingPool(size_t workers = 0, bool affinity = true, size_t tasks = 4096);
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool(WorkStealingPool&&) = delete;
+    //! Wait for all submitted tasks and stop workers
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&&) = delete;
+
+    //! Get workers count
+    size_t workers() const noexcept { return _workers.size(); }
+    //! Get count of pending submitted tasks
+    size_t pending() const noexcept { return _pending.load(std::memory_order_acquire); }
+
+    //! Get the index of the current worker thread of the pool
+    /*!
+        \return Worker index or -1 if the current thread is not a worker of the pool
+    */
+    int worker() const noexcept;
+
+    //! Submit the task to the pool (any thread method)
+    /*!
+        Tasks submitted by workers are pushed to their own deques, tasks
+        submitted by other threads are pushed to the injection queue.
+
+        If the tasks table is full, worker threads run the task directly
+        and other threads are blocked until a free slot appears.
+
+        \param task - Task to submit
+    */
+    void Submit(Task task);
+
+    //! Wait for all submitted tasks to complete (any thread method)
+    /*!
+        Worker threads help to run other tasks while waiting. When called
+        from inside of tasks, tasks which are waiting themselves are not
+        waited for, so the call does not deadlock on its own task.
+
+        Must not be called from functions forked by Invoke() or ParallelFor().
+
+        Will block.
+    */
+    void Wait();
+
+    //! Run the given function inside the pool and wait for it
+    /*!
+        Function is called directly if the current thread is a worker of
+        the pool, otherwise it is injected into the pool and the current
+        thread is blocked until it is completed.
+
+        \param function - Function to run
+    */
+    template <class TFunction>
+    void Run(TFunction&& function);
+
+    //! Invoke two functions in parallel and wait for both of them (fork/join)
+    /*!
+        The second function is forked to the deque of the current worker and
+        could be stolen by other workers, the first one is called directly.
+
+        \param function1 - First function
+        \param function2 - Second function
+    */
+    template <class TFunction1, class TFunction2>
+    void Invoke(TFunction1&& function1, TFunction2&& function2);
+
+    //! Call the given function for each index in the given range in parallel
+    /*!
+        The range is recursively split in halves with Invoke() until the
+        chunk size is not greater than the given grain size.
+
+        \param first - First index of the range
+        \param last - Last index of the range (not included)
+        \param grain - Grain size (default is 1)
+        \param function - Function to call with the index
+    */
+    template <class TFunction>
+    void ParallelFor(size_t first, size_t last, size_t grain, TFunction&& function);
+
+private:
+    // Job is the unit of work in the workers deques
+    struct Job
+    {
+        void (*execute)(Job* job);
+    };
+
+    // Job of the submitted task
+    struct TaskJob : public Job
+    {
+        WorkStealingPool* pool;
+        uint32_t index;
+        Task task;
+    };
+
+    // Stack-allocated job of the forking thread
+    template <class TFunction>
+    struct ForkJob : public Job
+    {
+        TFunction* function;
+        WorkStealingPool* pool;
+        std::atomic<bool> done;
+
+        ForkJob(TFunction& fn, WorkStealingPool* owner) : function(&fn), pool(owner), done(false)
+        {
+            execute = [](Job* job)
+            {
+                ForkJob* self = static_cast<ForkJob*>(job);
+                (*self->function)();
+
+                // The job could be destroyed by the joining thread right after it is done
+                WorkStealingPool* notify = self->pool;
+                self->done.store(true, std::memory_order_release);
+                if (notify != nullptr)
+                    notify->_completion.NotifyAll();
+            };
+        }
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Worker
+    {
+        size_t index;
+        uint64_t seed;
+        size_t tasks;
+        size_t waiting;
+        WorkStealingDeque<Job*> deque;
+        std::thread thread;
+
+        explicit Worker(size_t i) : index(i), seed(i + 1), tasks(0), waiting(0) {}
+    };
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::unique_ptr<TaskJob[]> _tasks;
+    MPMCRingQueue<uint32_t> _free;
+    MPMCRingQueue<Job*> _inject;
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> _stop;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> _pending;
+    std::atomic<size_t> _waiting;
+    alignas(CACHE_LINE_SIZE) EventCount _idle;
+    alignas(CACHE_LINE_SIZE) EventCount _completion;
+
+    //! Get the current worker of the pool
+    Worker* Current() const noexcept;
+    //! Push the job to the current worker deque or to the injection queue and wake an idle worker
+    void Push(Job* job);
+    //! Find a job for the given worker
+    Job* Find(Worker& worker);
+    //! Find and execute one job for the given worker
+    bool Help(Worker& worker);
+    //! Wait for the given done flag, helping to run other jobs on the worker thread
+    void Join(const std::atomic<bool>& done);
+
+    //! Worker thread loop
+    void Loop(Worker& worker, int cpu);
+};
+
+/*! \example threads_work_stealing_pool.cpp Work-stealing thread pool example */
+
+} // namespace CppCommon
+
+#include "work_stealing_pool.inl"
+
+#endif // CPPCOMMON_THREADS_WORK_STEALING_POOL_H
@@ -0,0 +1,66 @@
+/*!
+    \file work_stealing_pool.inl
+    \brief Work-stealing thread pool inline implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template <class TFunction>
+inline void WorkStealingPool::Run(TFunction&& function)
+{
+    if (Current() != nullptr)
+    {
+        function();
+        return;
+    }
+
+    // Inject the function into the pool and wait for it
+    ForkJob<typename std::remove_reference<TFunction>::type> job(function, this);
+    Push(&job);
+    Join(job.done);
+}
+
+template <class TFunction1, class TFunction2>
+inline void WorkStealingPool::Invoke(TFunction1&& function1, TFunction2&& function2)
+{
+    if (Current() == nullptr)
+    {
+        Run([this, &function1, &function2]() { Invoke(function1, function2); });
+        return;
+    }
+
+    // Fork the second function, so idle workers could steal it
+    ForkJob<typename std::remove_reference<TFunction2>::type> job(function2, nullptr);
+    Push(&job);
+
+    function1();
+
+    // Join the second function. If it was not stolen it will be popped back and executed by the current worker.
+    Join(job.done);
+}
+
+template <class TFunction>
+inline void WorkStealingPool::ParallelFor(size_t first, size_t last, size_t grain, TFunction&& function)
+{
+    if (Current() == nullptr)
+    {
+        Run([this, first, last, grain, &function]() { ParallelFor(first, last, grain, function); });
+        return;
+    }
+
+    if ((last - first) <= std::max(grain, (size_t)1))
+    {
+        for (size_t i = first; i < last; ++i)
+            function(i);
+        return;
+    }
+
+    size_t middle = first + (last - first) / 2;
+    Invoke([this, first, middle, grain, &function]() { ParallelFor(first, middle, grain, function); },
+           [this, middle, last, grain, &function]() { ParallelFor(middle, last, grain, function); });
+}
+
+} // namespace CppCommon
@@ -0,0 +1,39 @@
+/*!
+    \file cache_line.h
+    \brief Cache line size definition
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_UTILITY_CACHE_LINE_H
+#define CPPCOMMON_UTILITY_CACHE_LINE_H
+
+#include <cstddef>
+#include <new>
+
+namespace CppCommon {
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+
+//! Minimal offset between two objects to avoid false sharing
+/*!
+    Fields modified by different threads should be placed at least this
+    number of bytes apart (e.g. with alignas(CACHE_LINE_SIZE)).
+*/
+#if defined(__cpp_lib_hardware_interference_size)
+constexpr size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
+#else
+constexpr size_t CACHE_LINE_SIZE = 64;
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12)
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_UTILITY_CACHE_LINE_H
@@ -5,6 +5,7 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 
 #include <array>
 
@@ -59,6 +60,29 @@ private:
     }
 };
 
+class MappedFileReadFixture : public FileReadFixture
+{
+protected:
+    MappedFile mapped;
+
+    MappedFileReadFixture() : mapped("test.tmp") {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FileReadFixture::Initialize(context);
+
+        // Map file for sequential reading
+        mapped.Map(false, 0, 0, true);
+        mapped.Advise(MappedFileAdvice::SEQUENTIAL);
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        mapped.Unmap();
+        FileReadFixture::Cleanup(context);
+    }
+};
+
 BENCHMARK_FIXTURE(FileWriteFixture, "File::Write()", operations)
 {
     file.Write(buffer.data(), buffer.size());
@@ -71,4 +95,10 @@ BENCHMARK_FIXTURE(FileReadFixture, "File::Read()", operations)
     context.metrics().AddBytes(buffer.size());
 }
 
+BENCHMARK_FIXTURE(MappedFileReadFixture, "MappedFile::Read()", operations)
+{
+    mapped.Read(buffer.data(), buffer.size());
+    context.metrics().AddBytes(buffer.size());
+}
+
 BENCHMARK_MAIN()
@@ -8,6 +8,7 @@
 #include "memory/allocator_arena.h"
 #include "memory/allocator_heap.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_profiler.h"
 
 #include <vector>
 
@@ -62,6 +63,18 @@ protected:
     void Reset() override { manager.reset(); }
 };
 
+class ProfilerMemoryManagerFixture : public MemoryManagerFixture
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    ProfilerMemoryManager<DefaultMemoryManager> manager;
+
+    ProfilerMemoryManagerFixture() : manager(auxiliary) { MemoryProfiler::Enable(); }
+    ~ProfilerMemoryManagerFixture() { MemoryProfiler::Disable(); MemoryProfiler::Reset(); }
+
+    void Reset() override { manager.reset(); }
+};
+
 template <class TMemoryManagerFixture>
 class MallocFixture : public TMemoryManagerFixture
 {
@@ -191,4 +204,30 @@ BENCHMARK_FIXTURE(FreeFixture<PoolMemoryManagerFixture>, "PoolMemoryManager.free
     context.metrics().AddBytes(context.y());
 }
 
+BENCHMARK_FIXTURE(MallocFixture<ProfilerMemoryManagerFixture>, "ProfilerMemoryManager.malloc", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ProfilerMemoryManagerFixture>, "ProfilerMemoryManager.free", CppBenchmark::Settings().Pair(10000000, 16))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(MallocFixture<ProfilerMemoryManagerFixture>, "ProfilerMemoryManager.malloc", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->pointers.push_back(this->manager.malloc(context.y()));
+    context.metrics().AddBytes(context.y());
+}
+
+BENCHMARK_FIXTURE(FreeFixture<ProfilerMemoryManagerFixture>, "ProfilerMemoryManager.free", CppBenchmark::Settings().Pair(1000000, 256))
+{
+    this->manager.free(this->pointers.back(), context.y());
+    this->pointers.pop_back();
+    context.metrics().AddBytes(context.y());
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,112 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "memory/memory.h"
+
+#include <vector>
+
+using namespace CppCommon;
+
+const auto settings = CppBenchmark::Settings().Param(4096).Param(1048576).Param(67108864);
+
+class MemoryFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    std::vector<uint8_t> buffer;
+
+    void Initialize(CppBenchmark::Context& context) override { buffer.resize(context.x(), 0); }
+    void Cleanup(CppBenchmark::Context& context) override { buffer.clear(); }
+};
+
+void IsZero(CppBenchmark::Context& context, const std::vector<uint8_t>& buffer, MemoryKernel kernel)
+{
+    if (!Memory::IsKernelSupported(kernel))
+        return;
+
+    if (!Memory::IsZero(buffer.data(), buffer.size(), kernel))
+        context.metrics().SetCustom("Error", "Buffer is not zero!");
+    context.metrics().AddBytes(buffer.size());
+}
+
+void ZeroFill(CppBenchmark::Context& context, std::vector<uint8_t>& buffer, MemoryKernel kernel)
+{
+    if (!Memory::IsKernelSupported(kernel))
+        return;
+
+    Memory::ZeroFill(buffer.data(), buffer.size(), kernel);
+    context.metrics().AddBytes(buffer.size());
+}
+
+void RandomFill(CppBenchmark::Context& context, std::vector<uint8_t>& buffer, MemoryKernel kernel)
+{
+    if (!Memory::IsKernelSupported(kernel))
+        return;
+
+    Memory::RandomFill(buffer.data(), buffer.size(), kernel);
+    context.metrics().AddBytes(buffer.size());
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::IsZero<SCALAR>", settings)
+{
+    IsZero(context, buffer, MemoryKernel::SCALAR);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::IsZero<SSE2>", settings)
+{
+    IsZero(context, buffer, MemoryKernel::SSE2);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::IsZero<AVX2>", settings)
+{
+    IsZero(context, buffer, MemoryKernel::AVX2);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::IsZero<AVX512>", settings)
+{
+    IsZero(context, buffer, MemoryKernel::AVX512);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::ZeroFill<SCALAR>", settings)
+{
+    ZeroFill(context, buffer, MemoryKernel::SCALAR);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::ZeroFill<SSE2>", settings)
+{
+    ZeroFill(context, buffer, MemoryKernel::SSE2);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::ZeroFill<AVX2>", settings)
+{
+    ZeroFill(context, buffer, MemoryKernel::AVX2);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::ZeroFill<AVX512>", settings)
+{
+    ZeroFill(context, buffer, MemoryKernel::AVX512);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::RandomFill<SCALAR>", settings)
+{
+    RandomFill(context, buffer, MemoryKernel::SCALAR);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::RandomFill<SSE2>", settings)
+{
+    RandomFill(context, buffer, MemoryKernel::SSE2);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::RandomFill<AVX2>", settings)
+{
+    RandomFill(context, buffer, MemoryKernel::AVX2);
+}
+
+BENCHMARK_FIXTURE(MemoryFixture, "Memory::RandomFill<AVX512>", settings)
+{
+    RandomFill(context, buffer, MemoryKernel::AVX512);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,224 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "filesystem/file.h"
+#include "memory/allocator.h"
+#include "memory/allocator_arena.h"
+#include "memory/allocator_heap.h"
+#include "memory/allocator_pool.h"
+#include "memory/allocator_profiler.h"
+#include "memory/allocator_shared.h"
+#include "memory/allocator_stack.h"
+#include "memory/allocator_trace.h"
+#include "system/environment.h"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace CppCommon;
+
+// Replay the memory trace from the file given by the environment variable or the synthetic workload trace
+const char* TRACE_ENVAR = "CPPCOMMON_MEMORY_TRACE";
+
+// Process memory sampling period in trace events
+const size_t sampling = 4096;
+
+// Record the synthetic workload trace: containers of mixed sizes and lifetimes
+MemoryTrace RecordWorkloadTrace()
+{
+    MemoryTrace trace;
+    DefaultMemoryManager auxiliary;
+    TraceMemoryManager<DefaultMemoryManager> manager(auxiliary, trace);
+
+    {
+        TraceAllocator<char> char_alloc(manager);
+        TraceAllocator<std::pair<const int, std::vector<char, TraceAllocator<char>>>> map_alloc(manager);
+        TraceAllocator<std::pair<const int, int>> hash_alloc(manager);
+        TraceAllocator<int> list_alloc(manager);
+
+        std::map<int, std::vector<char, TraceAllocator<char>>, std::less<int>, decltype(map_alloc)> messages(map_alloc);
+        std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, decltype(hash_alloc)> index(hash_alloc);
+        std::list<int, decltype(list_alloc)> queue(list_alloc);
+
+        std::mt19937 generator(42);
+        std::geometric_distribution<int> payload(0.01);
+        std::uniform_int_distribution<int> action(0, 99);
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            // Long living messages with power-law sizes
+            auto& message = messages.emplace(i, std::vector<char, TraceAllocator<char>>(char_alloc)).first->second;
+            message.resize(1 + payload(generator));
+            index[i] = i;
+            queue.push_back(i);
+
+            // Expire old messages
+            int choice = action(generator);
+            if ((choice < 45) && !queue.empty())
+            {
+                int key = queue.front();
+                queue.pop_front();
+                messages.erase(key);
+                index.erase(key);
+            }
+            // Grow recent messages
+            else if ((choice < 50) && !messages.empty())
+                messages.rbegin()->second.resize(messages.rbegin()->second.size() * 2);
+        }
+    }
+
+    return trace;
+}
+
+const MemoryTrace& GetTrace()
+{
+    static MemoryTrace trace = []()
+    {
+        std::string path = Environment::GetEnvar(TRACE_ENVAR);
+        if (path.empty())
+            return RecordWorkloadTrace();
+
+        MemoryTrace result;
+        File file(path);
+        file.Open(true, false);
+        result.Load(file);
+        file.Close();
+        return result;
+    }();
+    return trace;
+}
+
+template <class TMemoryManager>
+class TraceReplayFixture : public virtual CppBenchmark::Fixture
+{
+protected:
+    // Replay the trace and report throughput, peak process memory and fragmentation
+    void Replay(CppBenchmark::Context& context, TMemoryManager& manager)
+    {
+        const MemoryTrace& trace = GetTrace();
+
+        int64_t base = Memory::RamProcess();
+        int64_t peak = base;
+        size_t failed = trace.Replay(manager, [&peak]() { peak = std::max(peak, Memory::RamProcess()); }, sampling);
+
+        // Fragmentation is the part of the process memory growth which is not used by live allocations
+        int64_t growth = std::max<int64_t>(peak - base, 0);
+        double fragmentation = (growth > (int64_t)trace.peak()) ? (1.0 - (double)trace.peak() / (double)growth) : 0.0;
+
+        context.metrics().AddOperations(trace.size());
+        context.metrics().SetCustom("trace.peak", (int64_t)trace.peak());
+        context.metrics().SetCustom("rss.peak", growth);
+        context.metrics().SetCustom("fragmentation", fragmentation);
+        context.metrics().SetCustom("failed", (int64_t)failed);
+    }
+};
+
+class DefaultReplayFixture : public TraceReplayFixture<DefaultMemoryManager>
+{
+protected:
+    DefaultMemoryManager manager;
+};
+
+class HeapReplayFixture : public TraceReplayFixture<HeapMemoryManager>
+{
+protected:
+    HeapMemoryManager manager;
+};
+
+class ArenaReplayFixture : public TraceReplayFixture<ArenaMemoryManager<DefaultMemoryManager>>
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> manager;
+
+    ArenaReplayFixture() : manager(auxiliary) {}
+
+    void Cleanup(CppBenchmark::Context& context) override { manager.reset(); }
+};
+
+class PoolReplayFixture : public TraceReplayFixture<PoolMemoryManager<DefaultMemoryManager>>
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    PoolMemoryManager<DefaultMemoryManager> manager;
+
+    PoolReplayFixture() : manager(auxiliary) {}
+
+    void Cleanup(CppBenchmark::Context& context) override { manager.reset(); }
+};
+
+class StackReplayFixture : public TraceReplayFixture<StackMemoryManager<1048576>>
+{
+protected:
+    std::unique_ptr<StackMemoryManager<1048576>> manager;
+
+    StackReplayFixture() : manager(std::make_unique<StackMemoryManager<1048576>>()) {}
+
+    void Cleanup(CppBenchmark::Context& context) override { manager->reset(); }
+};
+
+class SharedReplayFixture : public TraceReplayFixture<SharedMemoryManager>
+{
+protected:
+    std::vector<std::max_align_t> buffer;
+    SharedMemoryManager& manager;
+
+    SharedReplayFixture() : buffer(GetTrace().peak() / sizeof(std::max_align_t) * 4 + 65536), manager(SharedMemoryManager::Create(buffer.data(), buffer.size() * sizeof(std::max_align_t))) {}
+
+    void Cleanup(CppBenchmark::Context& context) override { manager.reset(); }
+};
+
+class ProfilerReplayFixture : public TraceReplayFixture<ProfilerMemoryManager<DefaultMemoryManager>>
+{
+protected:
+    DefaultMemoryManager auxiliary;
+    ProfilerMemoryManager<DefaultMemoryManager> manager;
+
+    ProfilerReplayFixture() : manager(auxiliary) { MemoryProfiler::Enable(); }
+    ~ProfilerReplayFixture() { MemoryProfiler::Disable(); MemoryProfiler::Reset(); }
+};
+
+BENCHMARK_FIXTURE(DefaultReplayFixture, "Replay.DefaultMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, manager);
+}
+
+BENCHMARK_FIXTURE(HeapReplayFixture, "Replay.HeapMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, manager);
+}
+
+BENCHMARK_FIXTURE(ArenaReplayFixture, "Replay.ArenaMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, manager);
+}
+
+BENCHMARK_FIXTURE(PoolReplayFixture, "Replay.PoolMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, manager);
+}
+
+BENCHMARK_FIXTURE(StackReplayFixture, "Replay.StackMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, *manager);
+}
+
+BENCHMARK_FIXTURE(SharedReplayFixture, "Replay.SharedMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, manager);
+}
+
+BENCHMARK_FIXTURE(ProfilerReplayFixture, "Replay.ProfilerMemoryManager", CppBenchmark::Settings().Operations(1).Attempts(3))
+{
+    Replay(context, manager);
+}
+
+BENCHMARK_MAIN()
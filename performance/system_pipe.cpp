@@ -5,8 +5,12 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "system/pipe.h"
+#include "threads/shared_mpmc_ring_queue.h"
+#include "threads/shared_spsc_ring_buffer.h"
+#include "threads/shared_spsc_ring_queue.h"
 
 #include <functional>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -16,7 +20,31 @@ const uint64_t bytes_to_produce = 2097152;
 const int item_size_from = 1;
 const int item_size_to = 262144;
 const auto settings = CppBenchmark::Settings().ParamRange(item_size_from, item_size_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+const uint64_t round_trips = 100000;
+const size_t shared_capacity = 1048576;
 
+// Shared memory ring buffer with the pipe interface
+class SharedPipe
+{
+public:
+    SharedPipe() : _reader("system_pipe_perf", shared_capacity), _writer("system_pipe_perf", shared_capacity) {}
+
+    size_t Read(void* buffer, size_t size)
+    {
+        return _reader.Dequeue(buffer, size) ? size : 0;
+    }
+
+    size_t Write(const void* buffer, size_t size)
+    {
+        return _writer.Enqueue(buffer, size) ? size : 0;
+    }
+
+private:
+    SharedSPSCRingBuffer _reader;
+    SharedSPSCRingBuffer _writer;
+};
+
+template <class TPipe>
 void produce_consume(CppBenchmark::Context& context)
 {
     const uint64_t item_size = context.x();
@@ -24,7 +52,7 @@ void produce_consume(CppBenchmark::Context& context)
     uint64_t crc = 0;
 
     // Create communication pipe
-    Pipe pipe;
+    TPipe pipe;
 
     // Start consumer thread
     auto consumer = std::thread([&pipe, item_size, items_to_produce, &crc]()
@@ -33,8 +61,16 @@ void produce_consume(CppBenchmark::Context& context)
 
         for (uint64_t i = 0; i < items_to_produce; ++i)
         {
-            // Read the item from the pipe
-            if (pipe.Read(item, item_size) != item_size)
+            // Read the item from the pipe (big items could be read in several parts)
+            uint64_t size = 0;
+            while (size < item_size)
+            {
+                size_t result = pipe.Read(item + size, item_size - size);
+                if (result == 0)
+                    break;
+                size += result;
+            }
+            if (size != item_size)
                 break;
 
             // Emulate consuming
@@ -73,9 +109,87 @@ void produce_consume(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC", crc);
 }
 
+// Round trip of the message through the request and the response channels
+template <class TChannel>
+void ping_pong(CppBenchmark::Context& context, TChannel& request, TChannel& response)
+{
+    uint64_t crc = 0;
+
+    // Start echo thread
+    auto echo = std::thread([&request, &response]()
+    {
+        for (uint64_t i = 0; i < round_trips; ++i)
+        {
+            uint64_t message;
+            if (!request.Receive(message) || !response.Send(message))
+                break;
+        }
+    });
+
+    for (uint64_t i = 0; i < round_trips; ++i)
+    {
+        uint64_t message;
+        if (!request.Send(i) || !response.Receive(message))
+            break;
+        crc += message;
+    }
+
+    // Wait for the echo thread
+    echo.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(round_trips);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+struct PipeChannel
+{
+    Pipe pipe;
+
+    bool Send(uint64_t message) { return pipe.Write(&message, sizeof(message)) == sizeof(message); }
+    bool Receive(uint64_t& message) { return pipe.Read(&message, sizeof(message)) == sizeof(message); }
+};
+
+template <class TQueue>
+struct SharedQueueChannel
+{
+    TQueue queue;
+
+    explicit SharedQueueChannel(const std::string& name) : queue(name, 1024) {}
+
+    bool Send(uint64_t message) { return queue.Enqueue(message); }
+    bool Receive(uint64_t& message) { return queue.Dequeue(message); }
+};
+
 BENCHMARK("Pipe", settings)
 {
-    produce_consume(context);
+    produce_consume<Pipe>(context);
+}
+
+BENCHMARK("SharedSPSCRingBuffer", settings)
+{
+    produce_consume<SharedPipe>(context);
+}
+
+BENCHMARK("Pipe round trip")
+{
+    PipeChannel request;
+    PipeChannel response;
+    ping_pong(context, request, response);
+}
+
+BENCHMARK("SharedSPSCRingQueue round trip")
+{
+    SharedQueueChannel<SharedSPSCRingQueue<uint64_t>> request("system_pipe_request_perf");
+    SharedQueueChannel<SharedSPSCRingQueue<uint64_t>> response("system_pipe_response_perf");
+    ping_pong(context, request, response);
+}
+
+BENCHMARK("SharedMPMCRingQueue round trip")
+{
+    SharedQueueChannel<SharedMPMCRingQueue<uint64_t>> request("system_pipe_request_perf");
+    SharedQueueChannel<SharedMPMCRingQueue<uint64_t>> response("system_pipe_response_perf");
+    ping_pong(context, request, response);
 }
 
 BENCHMARK_MAIN()
@@ -0,0 +1,82 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/barrier.h"
+#include "threads/dissemination_barrier.h"
+#include "threads/spin_barrier.h"
+#include "threads/tree_barrier.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const int episodes_to_wait = 10000;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Indexed barrier adapter for barriers without thread indexes
+template <class TBarrier>
+class IndexedBarrier : public TBarrier
+{
+public:
+    explicit IndexedBarrier(int threads) : TBarrier(threads) {}
+
+    bool Wait(int index) { return TBarrier::Wait(); }
+};
+
+template <class TBarrier>
+void wait(CppBenchmark::Context& context)
+{
+    const int threads_count = context.x();
+    uint64_t crc = 0;
+
+    // Create barrier synchronization primitive
+    TBarrier barrier(threads_count);
+
+    // Start waiting threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&barrier, &crc, thread]()
+        {
+            for (int i = 0; i < episodes_to_wait; ++i)
+                if (barrier.Wait(thread))
+                    ++crc;
+        });
+    }
+
+    // Wait for all waiting threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(episodes_to_wait - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Barrier", settings)
+{
+    wait<IndexedBarrier<Barrier>>(context);
+}
+
+BENCHMARK("SpinBarrier", settings)
+{
+    wait<IndexedBarrier<SpinBarrier>>(context);
+}
+
+BENCHMARK("TreeBarrier", settings)
+{
+    wait<TreeBarrier>(context);
+}
+
+BENCHMARK("DisseminationBarrier", settings)
+{
+    wait<DisseminationBarrier>(context);
+}
+
+BENCHMARK_MAIN()
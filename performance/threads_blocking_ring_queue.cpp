@@ -0,0 +1,100 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/blocking_ring_queue.h"
+#include "threads/spsc_ring_queue.h"
+#include "threads/wait_queue.h"
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int producers_from = 1;
+const int producers_to = 8;
+const size_t queue_capacity = 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<class TQueue>
+void produce_consume(CppBenchmark::Context& context, TQueue& queue, int producers_count)
+{
+    uint64_t crc = 0;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            // Dequeue the item or end consume
+            int item;
+            if (!queue.Dequeue(item))
+                break;
+
+            // Consume the item
+            crc += item;
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue the item or end produce
+                if (!queue.Enqueue((int)(items * producer + i)))
+                    break;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the queue
+    queue.Close();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(int));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("BlockingRingQueue<MPMCRingQueue>-producers", settings)
+{
+    BlockingRingQueue<int> queue(queue_capacity);
+    produce_consume(context, queue, context.x());
+}
+
+BENCHMARK("BlockingRingQueue<MPMCRingQueue>-park-producers", settings)
+{
+    BlockingRingQueue<int> queue(queue_capacity, 0);
+    produce_consume(context, queue, context.x());
+}
+
+BENCHMARK("BlockingRingQueue<SPSCRingQueue>")
+{
+    BlockingRingQueue<int, SPSCRingQueue<int>> queue(queue_capacity);
+    produce_consume(context, queue, 1);
+}
+
+BENCHMARK("WaitQueue-producers", settings)
+{
+    WaitQueue<int> queue(queue_capacity);
+    produce_consume(context, queue, context.x());
+}
+
+BENCHMARK_MAIN()
@@ -4,7 +4,10 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/adaptive_mutex.h"
 #include "threads/critical_section.h"
+#include "threads/lock_profiler.h"
+#include "threads/spin_lock.h"
 
 #include <thread>
 #include <vector>
@@ -16,13 +19,21 @@ const int producers_from = 1;
 const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+// Profiled critical section registered under the benchmark lock site
+class ProfiledCriticalSection : public ProfiledLock<CriticalSection>
+{
+public:
+    ProfiledCriticalSection() : ProfiledLock<CriticalSection>("critical_section_perf") {}
+};
+
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
-    // Create critical section synchronization primitive
-    CriticalSection lock;
+    // Create lock synchronization primitive
+    TLock lock;
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -33,7 +44,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<CriticalSection> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +61,29 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("CriticalSection", settings)
 {
-    produce(context);
+    produce<CriticalSection>(context);
+}
+
+BENCHMARK("ProfiledLock<CriticalSection>-disabled", settings)
+{
+    produce<ProfiledCriticalSection>(context);
+}
+
+BENCHMARK("ProfiledLock<CriticalSection>-enabled", settings)
+{
+    LockProfiler::Enable();
+    produce<ProfiledCriticalSection>(context);
+    LockProfiler::Disable();
+}
+
+BENCHMARK("AdaptiveMutex", settings)
+{
+    produce<AdaptiveMutex>(context);
+}
+
+BENCHMARK("SpinLock", settings)
+{
+    produce<SpinLock>(context);
 }
 
 BENCHMARK_MAIN()
@@ -0,0 +1,214 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/disruptor.h"
+#include "threads/spsc_ring_queue.h"
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int stages_count = 3;
+const int producers_from = 1;
+const int producers_to = 8;
+const size_t ring_capacity = 1024;
+const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TWaitStrategy>
+void disruptor_pipeline(CppBenchmark::Context& context)
+{
+    uint64_t crc = 0;
+
+    // Create disruptor with the pipeline of consumer stages
+    Disruptor<uint64_t, TWaitStrategy> disruptor(ring_capacity);
+    std::vector<typename Disruptor<uint64_t, TWaitStrategy>::Consumer*> stages;
+    stages.push_back(&disruptor.AddConsumer());
+    for (int stage = 1; stage < stages_count; ++stage)
+        stages.push_back(&disruptor.AddConsumer({ stages.back() }));
+
+    // Start intermediate stages threads which update items in place
+    std::vector<std::thread> consumers;
+    for (int stage = 0; stage < (stages_count - 1); ++stage)
+    {
+        consumers.emplace_back([consumer = stages[stage]]()
+        {
+            while (consumer->Consume([](uint64_t& item, int64_t, bool) { ++item; }) > 0);
+        });
+    }
+
+    // Start the final stage thread
+    consumers.emplace_back([consumer = stages.back(), &crc]()
+    {
+        while (consumer->Consume([&crc](uint64_t& item, int64_t, bool) { crc += item; }) > 0);
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&disruptor]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+            if (!disruptor.Produce([i](uint64_t& item, int64_t) { item = i; }))
+                break;
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Close the disruptor
+    disruptor.Close();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+void queues_pipeline(CppBenchmark::Context& context)
+{
+    uint64_t crc = 0;
+
+    // Create the chain of single producer / single consumer ring queues
+    std::vector<std::unique_ptr<SPSCRingQueue<uint64_t>>> queues;
+    for (int stage = 0; stage < stages_count; ++stage)
+        queues.emplace_back(new SPSCRingQueue<uint64_t>(ring_capacity));
+
+    // Start intermediate stages threads which copy items into the next queue
+    std::vector<std::thread> consumers;
+    for (int stage = 0; stage < (stages_count - 1); ++stage)
+    {
+        consumers.emplace_back([input = queues[stage].get(), output = queues[stage + 1].get()]()
+        {
+            for (uint64_t i = 0; i < items_to_produce; ++i)
+            {
+                uint64_t item;
+                while (!input->Dequeue(item))
+                    std::this_thread::yield();
+                ++item;
+                while (!output->Enqueue(item))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Start the final stage thread
+    consumers.emplace_back([input = queues.back().get(), &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+        {
+            uint64_t item;
+            while (!input->Dequeue(item))
+                std::this_thread::yield();
+            crc += item;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([input = queues.front().get()]()
+    {
+        for (uint64_t i = 0; i < items_to_produce; ++i)
+            while (!input->Enqueue(i))
+                std::this_thread::yield();
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+template <class TWaitStrategy>
+void disruptor_producers(CppBenchmark::Context& context)
+{
+    const int producers_count = context.x();
+    uint64_t crc = 0;
+
+    // Create multiple producers disruptor with a single consumer
+    Disruptor<uint64_t, TWaitStrategy> disruptor(ring_capacity, true);
+    auto& consumer = disruptor.AddConsumer();
+
+    // Start consumer thread
+    auto consumer_thread = std::thread([&consumer, &crc]()
+    {
+        while (consumer.Consume([&crc](uint64_t& item, int64_t, bool) { crc += item; }) > 0);
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&disruptor, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items; ++i)
+                if (!disruptor.Produce([=](uint64_t& item, int64_t) { item = items * producer + i; }))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the disruptor
+    disruptor.Close();
+
+    // Wait for the consumer thread
+    consumer_thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Disruptor<BusySpinWaitStrategy>-pipeline")
+{
+    disruptor_pipeline<BusySpinWaitStrategy>(context);
+}
+
+BENCHMARK("Disruptor<YieldingWaitStrategy>-pipeline")
+{
+    disruptor_pipeline<YieldingWaitStrategy>(context);
+}
+
+BENCHMARK("Disruptor<BlockingWaitStrategy>-pipeline")
+{
+    disruptor_pipeline<BlockingWaitStrategy>(context);
+}
+
+BENCHMARK("SPSCRingQueue-pipeline")
+{
+    queues_pipeline(context);
+}
+
+BENCHMARK("Disruptor<YieldingWaitStrategy>-producers", settings)
+{
+    disruptor_producers<YieldingWaitStrategy>(context);
+}
+
+BENCHMARK("Disruptor<BlockingWaitStrategy>-producers", settings)
+{
+    disruptor_producers<BlockingWaitStrategy>(context);
+}
+
+BENCHMARK_MAIN()
@@ -5,6 +5,7 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "threads/file_lock.h"
+#include "threads/shared_file_lock.h"
 
 #include <thread>
 #include <vector>
@@ -19,6 +20,7 @@ const int writers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          writers_from, writers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TFileLock>
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
@@ -27,7 +29,7 @@ void produce(CppBenchmark::Context& context)
     uint64_t writers_crc = 0;
 
     // Create file-lock synchronization primitive
-    FileLock lock_master(".lock");
+    TFileLock lock_master(".lock");
 
     // Start readers threads
     std::vector<std::thread> readers;
@@ -35,12 +37,12 @@ void produce(CppBenchmark::Context& context)
     {
         readers.emplace_back([&readers_crc, reader, readers_count]()
         {
-            FileLock lock_slave(".lock");
+            TFileLock lock_slave(".lock");
 
             uint64_t items = (items_to_produce / readers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                ReadLocker<FileLock> locker(lock_slave);
+                ReadLocker<TFileLock> locker(lock_slave);
                 readers_crc += (reader * items) + i;
             }
         });
@@ -52,12 +54,12 @@ void produce(CppBenchmark::Context& context)
     {
         writers.emplace_back([&writers_crc, writer, writers_count]()
         {
-            FileLock lock_slave(".lock");
+            TFileLock lock_slave(".lock");
 
             uint64_t items = (items_to_produce / writers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                WriteLocker<FileLock> locker(lock_slave);
+                WriteLocker<TFileLock> locker(lock_slave);
                 writers_crc += (writer * items) + i;
             }
         });
@@ -79,7 +81,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("FileLock", settings)
 {
-    produce(context);
+    produce<FileLock>(context);
+}
+
+BENCHMARK("SharedFileLock", settings)
+{
+    produce<SharedFileLock>(context);
 }
 
 BENCHMARK_MAIN()
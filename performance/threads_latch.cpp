@@ -0,0 +1,57 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/latch.h"
+
+#include <deque>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const int rounds_to_wait = 10000;
+const int threads_from = 1;
+const int threads_to = 64;
+const auto settings = CppBenchmark::Settings().ParamRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+BENCHMARK("Latch", settings)
+{
+    const int threads_count = context.x();
+    uint64_t crc = 0;
+
+    // Create latches for all rounds
+    std::deque<Latch> latches;
+    for (int i = 0; i < rounds_to_wait; ++i)
+        latches.emplace_back(threads_count);
+
+    // Start counting down threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&latches]()
+        {
+            for (auto& latch : latches)
+                latch.CountDownAndWait();
+        });
+    }
+
+    // Wait for each round
+    for (auto& latch : latches)
+    {
+        latch.Wait();
+        ++crc;
+    }
+
+    // Wait for all counting down threads
+    for (auto& thread : threads)
+        thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(rounds_to_wait - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,129 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/mpmc_linked_queue.h"
+#include "threads/mpmc_ring_queue.h"
+#include "threads/wait_queue.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t items_to_produce = 10000000;
+const int threads_from = 1;
+const int threads_to = 8;
+const auto settings = CppBenchmark::Settings().PairRange(threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; }, threads_from, threads_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template<typename T, class TQueue>
+void produce_consume(CppBenchmark::Context& context, TQueue& queue, const std::function<void()>& wait_strategy, const std::function<void()>& close = nullptr)
+{
+    const int producers_count = context.x();
+    const int consumers_count = context.y();
+    std::atomic<uint64_t> consumed(0);
+    std::atomic<uint64_t> crc(0);
+
+    // Start consumer threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &wait_strategy, &consumed, &crc]()
+        {
+            uint64_t sum = 0;
+            while (consumed.load(std::memory_order_relaxed) < items_to_produce)
+            {
+                // Dequeue using the given waiting strategy
+                T item;
+                if (!queue.Dequeue(item))
+                {
+                    wait_strategy();
+                    continue;
+                }
+
+                // Consume the item
+                sum += item;
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+            crc += sum;
+        });
+    }
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count]()
+        {
+            uint64_t items = (items_to_produce / producers_count);
+            uint64_t first = items * producer;
+            // The last producer produces the remaining items
+            if (producer == (producers_count - 1))
+                items = items_to_produce - first;
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                // Enqueue using the given waiting strategy
+                while (!queue.Enqueue((T)(first + i)))
+                    wait_strategy();
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the blocking queue to release waiting consumers
+    if (close)
+        close();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("MPMCLinkedQueue<SpinWait>", settings)
+{
+    MPMCLinkedQueue<uint64_t> queue;
+    produce_consume<uint64_t>(context, queue, []{});
+    context.metrics().SetCustom("MPMCLinkedQueue.segment", (unsigned)queue.segment());
+}
+
+BENCHMARK("MPMCLinkedQueue<YieldWait>", settings)
+{
+    MPMCLinkedQueue<uint64_t> queue;
+    produce_consume<uint64_t>(context, queue, []{ std::this_thread::yield(); });
+    context.metrics().SetCustom("MPMCLinkedQueue.segment", (unsigned)queue.segment());
+}
+
+BENCHMARK("MPMCRingQueue<SpinWait>", settings)
+{
+    MPMCRingQueue<uint64_t> queue(1048576);
+    produce_consume<uint64_t>(context, queue, []{});
+    context.metrics().SetCustom("MPMCRingQueue.capacity", (unsigned)queue.capacity());
+}
+
+BENCHMARK("MPMCRingQueue<YieldWait>", settings)
+{
+    MPMCRingQueue<uint64_t> queue(1048576);
+    produce_consume<uint64_t>(context, queue, []{ std::this_thread::yield(); });
+    context.metrics().SetCustom("MPMCRingQueue.capacity", (unsigned)queue.capacity());
+}
+
+BENCHMARK("WaitQueue", settings)
+{
+    WaitQueue<uint64_t> queue(1048576);
+    produce_consume<uint64_t>(context, queue, []{}, [&queue]{ queue.Close(); });
+}
+
+BENCHMARK_MAIN()
@@ -6,6 +6,7 @@
 
 #include "threads/mpmc_ring_queue.h"
 
+#include <algorithm>
 #include <functional>
 #include <thread>
 #include <vector>
@@ -15,7 +16,10 @@ using namespace CppCommon;
 const uint64_t items_to_produce = 10000000;
 const int producers_from = 1;
 const int producers_to = 8;
+const int batch_from = 32;
+const int batch_to = 256;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const auto bulk_settings = CppBenchmark::Settings().PairRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; }, batch_from, batch_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
 template<typename T, uint64_t N>
 void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
@@ -72,6 +76,81 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N>
+void produce_consume_bulk(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int producers_count = context.x();
+    const size_t batch = context.y();
+    uint64_t crc = 0;
+
+    // Create multiple producers / multiple consumers wait-free ring queue
+    MPMCRingQueue<T> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, batch]()
+    {
+        std::vector<T> items(batch);
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Dequeue the bulk of items using the given waiting strategy
+            size_t count;
+            while ((count = queue.DequeueBulk(items.data(), batch)) == 0)
+                wait_strategy();
+
+            // Consume items
+            for (size_t j = 0; j < count; ++j)
+                crc += items[j];
+
+            // Increase the items counter
+            i += count;
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count, batch]()
+        {
+            std::vector<T> bulk(batch);
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items;)
+            {
+                // Prepare the bulk of items
+                size_t count = (size_t)std::min<uint64_t>(batch, items - i);
+                for (size_t j = 0; j < count; ++j)
+                    bulk[j] = (T)(items * producer + i + j);
+
+                // Enqueue the bulk of items using the given waiting strategy
+                for (size_t enqueued = 0; enqueued < count;)
+                {
+                    size_t result = queue.EnqueueBulk(bulk.data() + enqueued, count - enqueued);
+                    if (result == 0)
+                        wait_strategy();
+                    enqueued += result;
+                }
+
+                // Increase the items counter
+                i += count;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("MPMCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("MPMCRingQueue<SpinWait>-producers", settings)
 {
     produce_consume<int, 1048576>(context, []{});
@@ -82,4 +161,14 @@ BENCHMARK("MPMCRingQueue<YieldWait>-producers", settings)
     produce_consume<int, 1048576>(context, []{ std::this_thread::yield(); });
 }
 
+BENCHMARK("MPMCRingQueue<SpinWait>-producers-bulk", bulk_settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{});
+}
+
+BENCHMARK("MPMCRingQueue<YieldWait>-producers-bulk", bulk_settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
 BENCHMARK_MAIN()
@@ -15,7 +15,7 @@ const uint64_t bytes_to_produce = 134217728;
 const int item_size_from = 4;
 const int item_size_to = 4096;
 const int producers_from = 1;
-const int producers_to = 8;
+const int producers_to = 64;
 const auto settings = CppBenchmark::Settings().PairRange(item_size_from, item_size_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
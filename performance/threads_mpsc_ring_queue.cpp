@@ -6,6 +6,7 @@
 
 #include "threads/mpsc_ring_queue.h"
 
+#include <algorithm>
 #include <functional>
 #include <thread>
 #include <vector>
@@ -14,17 +15,20 @@ using namespace CppCommon;
 
 const uint64_t items_to_produce = 10000000;
 const int producers_from = 1;
-const int producers_to = 8;
+const int producers_to = 64;
+const int batch_from = 32;
+const int batch_to = 256;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const auto bulk_settings = CppBenchmark::Settings().PairRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; }, batch_from, batch_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
-template<typename T, uint64_t N, bool BatchMode>
+template<typename T, uint64_t N, bool BatchMode, bool Ordered = false>
 void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
     // Create multiple producers / single consumer wait-free ring queue
-    MPSCRingQueue<T> queue(N, producers_count);
+    MPSCRingQueue<T> queue(N, producers_count, Ordered);
 
     // Start consumer thread
     auto consumer = std::thread([&queue, &wait_strategy, &crc]()
@@ -93,6 +97,80 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N>
+void produce_consume_bulk(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int producers_count = context.x();
+    const size_t batch = context.y();
+    uint64_t crc = 0;
+
+    // Create multiple producers / single consumer wait-free ring queue
+    MPSCRingQueue<T> queue(N, producers_count);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, batch]()
+    {
+        std::vector<T> items(batch);
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Dequeue the bulk of items using the given waiting strategy
+            size_t count;
+            while ((count = queue.DequeueBulk(items.data(), batch)) == 0)
+                wait_strategy();
+
+            // Consume items
+            for (size_t j = 0; j < count; ++j)
+                crc += items[j];
+
+            // Increase the items counter
+            i += count;
+        }
+    });
+
+    // Start producer threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &wait_strategy, producer, producers_count, batch]()
+        {
+            std::vector<T> bulk(batch);
+            uint64_t items = (items_to_produce / producers_count);
+            for (uint64_t i = 0; i < items;)
+            {
+                // Prepare the bulk of items
+                size_t count = (size_t)std::min<uint64_t>(batch, items - i);
+                for (size_t j = 0; j < count; ++j)
+                    bulk[j] = (T)(items * producer + i + j);
+
+                // Enqueue the bulk of items using the given waiting strategy
+                for (size_t enqueued = 0; enqueued < count;)
+                {
+                    size_t result = queue.EnqueueBulk(bulk.data() + enqueued, count - enqueued);
+                    if (result == 0)
+                        wait_strategy();
+                    enqueued += result;
+                }
+
+                // Increase the items counter
+                i += count;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("MPSCRingBatcher<SpinWait>-producers", settings)
 {
     produce_consume<int, 1048576, true>(context, []{});
@@ -113,4 +191,24 @@ BENCHMARK("MPSCRingQueue<YieldWait>-producers", settings)
     produce_consume<int, 1048576, false>(context, []{ std::this_thread::yield(); });
 }
 
+BENCHMARK("MPSCRingQueue<SpinWait>-producers-ordered", settings)
+{
+    produce_consume<int, 1048576, false, true>(context, []{});
+}
+
+BENCHMARK("MPSCRingQueue<YieldWait>-producers-ordered", settings)
+{
+    produce_consume<int, 1048576, false, true>(context, []{ std::this_thread::yield(); });
+}
+
+BENCHMARK("MPSCRingQueue<SpinWait>-producers-bulk", bulk_settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{});
+}
+
+BENCHMARK("MPSCRingQueue<YieldWait>-producers-bulk", bulk_settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
 BENCHMARK_MAIN()
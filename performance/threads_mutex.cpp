@@ -4,6 +4,7 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/adaptive_mutex.h"
 #include "threads/mutex.h"
 
 #include <thread>
@@ -16,13 +17,14 @@ const int producers_from = 1;
 const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
-    // Create mutex synchronization primitive
-    Mutex lock;
+    // Create lock synchronization primitive
+    TLock lock;
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -33,7 +35,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<Mutex> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +52,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("Mutex", settings)
 {
-    produce(context);
+    produce<Mutex>(context);
+}
+
+BENCHMARK("AdaptiveMutex", settings)
+{
+    produce<AdaptiveMutex>(context);
 }
 
 BENCHMARK_MAIN()
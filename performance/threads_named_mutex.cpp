@@ -5,7 +5,9 @@
 #include "benchmark/cppbenchmark.h"
 
 #include "threads/named_mutex.h"
+#include "threads/named_robust_mutex.h"
 
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -16,27 +18,28 @@ const int producers_from = 1;
 const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
-void produce(CppBenchmark::Context& context)
+template <class TLock>
+void produce(CppBenchmark::Context& context, const std::string& name)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
-    // Create named mutex master
-    NamedMutex lock_master("named_mutex_perf");
+    // Create named lock master
+    TLock lock_master(name);
 
     // Start producer threads
     std::vector<std::thread> producers;
     for (int producer = 0; producer < producers_count; ++producer)
     {
-        producers.emplace_back([&crc, producer, producers_count]()
+        producers.emplace_back([&crc, &name, producer, producers_count]()
         {
-            // Create named mutex slave
-            NamedMutex lock_slave("named_mutex_perf");
+            // Create named lock slave
+            TLock lock_slave(name);
 
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<NamedMutex> locker(lock_slave);
+                Locker<TLock> locker(lock_slave);
                 crc += (producer * items) + i;
             }
         });
@@ -53,7 +56,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("NamedMutex", settings)
 {
-    produce(context);
+    produce<NamedMutex>(context, "named_mutex_perf");
+}
+
+BENCHMARK("NamedRobustMutex", settings)
+{
+    produce<NamedRobustMutex>(context, "named_robust_mutex_perf");
 }
 
 BENCHMARK_MAIN()
@@ -0,0 +1,145 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/epoch_reclamation.h"
+#include "threads/hazard_pointers.h"
+#include "threads/quiescent_reclamation.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t reads_to_perform = 10000000;
+const int list_size = 16;
+const int readers_from = 1;
+const int readers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Read-mostly linked list. Writer replaces the whole list with its copy and retires the old one.
+struct Node
+{
+    uint64_t value;
+    Node* next;
+};
+
+Node* CreateList()
+{
+    Node* head = nullptr;
+    for (int i = list_size; i > 0; --i)
+        head = new Node{ (uint64_t)i, head };
+    return head;
+}
+
+void DeleteList(void* ptr, void* context = nullptr)
+{
+    Node* node = (Node*)ptr;
+    while (node != nullptr)
+    {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+uint64_t ReadList(const Node* node)
+{
+    uint64_t sum = 0;
+    for (; node != nullptr; node = node->next)
+        sum += node->value;
+    return sum;
+}
+
+void read_update(CppBenchmark::Context& context, const std::function<uint64_t(std::atomic<Node*>&)>& read, const std::function<void(std::atomic<Node*>&)>& update, const std::function<void()>& finish)
+{
+    const int readers_count = context.x();
+    std::atomic<uint64_t> crc(0);
+    std::atomic<int> running(readers_count);
+    uint64_t updates = 0;
+
+    std::atomic<Node*> list(CreateList());
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&read, &finish, &list, &crc, &running, readers_count]()
+        {
+            uint64_t sum = 0;
+            uint64_t reads = (reads_to_perform / readers_count);
+            for (uint64_t i = 0; i < reads; ++i)
+                sum += read(list);
+            finish();
+            crc += sum;
+            --running;
+        });
+    }
+
+    // Update the list with a single writer while readers are running
+    while (running > 0)
+    {
+        update(list);
+        ++updates;
+        Thread::Yield();
+    }
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    DeleteList(list.load());
+
+    // Update benchmark metrics
+    uint64_t reads = (reads_to_perform / readers_count) * readers_count;
+    context.metrics().AddOperations(reads);
+    context.metrics().AddItems(reads * list_size);
+    context.metrics().SetCustom("Updates", updates);
+    context.metrics().SetCustom("CRC", crc.load());
+}
+
+BENCHMARK("Leaking", settings)
+{
+    // Baseline: retired lists are deleted only after all readers are finished
+    std::vector<Node*> retired;
+    read_update(context,
+        [](std::atomic<Node*>& list) { return ReadList(list.load(std::memory_order_acquire)); },
+        [&retired](std::atomic<Node*>& list) { retired.push_back(list.exchange(CreateList(), std::memory_order_acq_rel)); },
+        []{});
+    for (auto node : retired)
+        DeleteList(node);
+}
+
+BENCHMARK("HazardPointers", settings)
+{
+    HazardPointers domain;
+    read_update(context,
+        [&domain](std::atomic<Node*>& list) { HazardPointers::Guard guard(domain); return ReadList(guard.Protect(0, list)); },
+        [&domain](std::atomic<Node*>& list) { domain.Retire(list.exchange(CreateList(), std::memory_order_acq_rel), DeleteList); },
+        []{});
+}
+
+BENCHMARK("EpochReclamation", settings)
+{
+    EpochReclamation domain;
+    read_update(context,
+        [&domain](std::atomic<Node*>& list) { EpochReclamation::Guard guard(domain); return ReadList(list.load(std::memory_order_acquire)); },
+        [&domain](std::atomic<Node*>& list) { domain.Retire(list.exchange(CreateList(), std::memory_order_acq_rel), DeleteList); },
+        []{});
+}
+
+BENCHMARK("QuiescentReclamation", settings)
+{
+    QuiescentReclamation domain;
+    read_update(context,
+        [&domain](std::atomic<Node*>& list) { domain.Quiescent(); return ReadList(list.load(std::memory_order_acquire)); },
+        [&domain](std::atomic<Node*>& list) { domain.Retire(list.exchange(CreateList(), std::memory_order_acq_rel), DeleteList); },
+        [&domain]{ domain.Offline(); });
+}
+
+BENCHMARK_MAIN()
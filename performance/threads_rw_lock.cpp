@@ -4,8 +4,10 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/distributed_rw_lock.h"
 #include "threads/rw_lock.h"
 
+#include <atomic>
 #include <thread>
 #include <vector>
 
@@ -18,17 +20,50 @@ const int writers_from = 1;
 const int writers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(readers_from, readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          writers_from, writers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const int only_readers_to = 64;
+const auto read_settings = CppBenchmark::Settings().ParamRange(readers_from, only_readers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
-void produce(CppBenchmark::Context& context)
+template <class TLock>
+void read(CppBenchmark::Context& context, TLock& lock)
+{
+    const int readers_count = context.x();
+    std::atomic<uint64_t> readers_crc(0);
+    uint64_t value = 0;
+
+    // Start readers threads
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < readers_count; ++reader)
+    {
+        readers.emplace_back([&lock, &readers_crc, &value, reader, readers_count]()
+        {
+            uint64_t crc = 0;
+            uint64_t items = (items_to_produce / readers_count);
+            for (uint64_t i = 0; i < items; ++i)
+            {
+                ReadLocker<TLock> locker(lock);
+                crc += (reader * items) + i + value;
+            }
+            readers_crc += crc;
+        });
+    }
+
+    // Wait for all readers threads
+    for (auto& reader : readers)
+        reader.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().SetCustom("CRC-Readers", readers_crc.load());
+}
+
+template <class TLock>
+void produce(CppBenchmark::Context& context, TLock& lock)
 {
     const int readers_count = context.x();
     const int writers_count = context.y();
     uint64_t readers_crc = 0;
     uint64_t writers_crc = 0;
 
-    // Create read/write lock synchronization primitive
-    RWLock lock;
-
     // Start readers threads
     std::vector<std::thread> readers;
     for (int reader = 0; reader < readers_count; ++reader)
@@ -38,7 +73,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / readers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                ReadLocker<RWLock> locker(lock);
+                ReadLocker<TLock> locker(lock);
                 readers_crc += (reader * items) + i;
             }
         });
@@ -53,7 +88,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / writers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                WriteLocker<RWLock> locker(lock);
+                WriteLocker<TLock> locker(lock);
                 writers_crc += (writer * items) + i;
             }
         });
@@ -75,7 +110,32 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("RWLock", settings)
 {
-    produce(context);
+    RWLock lock;
+    produce(context, lock);
+}
+
+BENCHMARK("DistributedRWLock-writer-preference", settings)
+{
+    DistributedRWLock lock(true);
+    produce(context, lock);
+}
+
+BENCHMARK("DistributedRWLock-reader-preference", settings)
+{
+    DistributedRWLock lock(false);
+    produce(context, lock);
+}
+
+BENCHMARK("RWLock-read", read_settings)
+{
+    RWLock lock;
+    read(context, lock);
+}
+
+BENCHMARK("DistributedRWLock-read", read_settings)
+{
+    DistributedRWLock lock;
+    read(context, lock);
 }
 
 BENCHMARK_MAIN()
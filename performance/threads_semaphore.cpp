@@ -4,6 +4,7 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/futex_semaphore.h"
 #include "threads/semaphore.h"
 
 #include <thread>
@@ -19,6 +20,12 @@ const int producers_to = 32;
 const auto settings = CppBenchmark::Settings().PairRange(semaphore_from, semaphore_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; },
                                                          producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+const int rounds_to_release = 10000;
+const int waiters_from = 1;
+const int waiters_to = 32;
+const auto release_settings = CppBenchmark::Settings().ParamRange(waiters_from, waiters_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+template <class TSemaphore>
 void produce(CppBenchmark::Context& context)
 {
     const int semaphore_count = context.x();
@@ -26,7 +33,7 @@ void produce(CppBenchmark::Context& context)
     uint64_t crc = 0;
 
     // Create semaphore synchronization primitive
-    Semaphore lock(semaphore_count);
+    TSemaphore lock(semaphore_count);
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -37,7 +44,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<Semaphore> locker(lock);
+                Locker<TSemaphore> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -52,9 +59,85 @@ void produce(CppBenchmark::Context& context)
     context.metrics().SetCustom("CRC", crc);
 }
 
+// Release the given count of semaphore resources one by one
+template <class TSemaphore>
+void release(TSemaphore& semaphore, int count)
+{
+    for (int i = 0; i < count; ++i)
+        semaphore.Unlock();
+}
+
+// Release the given count of futex semaphore resources at once
+void release(FutexSemaphore& semaphore, int count)
+{
+    semaphore.Unlock(count);
+}
+
+template <class TSemaphore>
+void wake(CppBenchmark::Context& context)
+{
+    const int waiters_count = context.x();
+    uint64_t crc = 0;
+
+    // Create fully acquired start and done semaphores
+    TSemaphore start(waiters_count);
+    TSemaphore done(waiters_count);
+    for (int i = 0; i < waiters_count; ++i)
+    {
+        start.Lock();
+        done.Lock();
+    }
+
+    // Start waiter threads
+    std::vector<std::thread> waiters;
+    for (int waiter = 0; waiter < waiters_count; ++waiter)
+    {
+        waiters.emplace_back([&start, &done]()
+        {
+            for (int i = 0; i < rounds_to_release; ++i)
+            {
+                start.Lock();
+                done.Unlock();
+            }
+        });
+    }
+
+    // Wake all waiters and wait for them in each round
+    for (int i = 0; i < rounds_to_release; ++i)
+    {
+        release(start, waiters_count);
+        for (int j = 0; j < waiters_count; ++j)
+            done.Lock();
+        ++crc;
+    }
+
+    // Wait for all waiter threads
+    for (auto& waiter : waiters)
+        waiter.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(rounds_to_release - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("Semaphore", settings)
 {
-    produce(context);
+    produce<Semaphore>(context);
+}
+
+BENCHMARK("FutexSemaphore", settings)
+{
+    produce<FutexSemaphore>(context);
+}
+
+BENCHMARK("Semaphore-wake", release_settings)
+{
+    wake<Semaphore>(context);
+}
+
+BENCHMARK("FutexSemaphore-wake", release_settings)
+{
+    wake<FutexSemaphore>(context);
 }
 
 BENCHMARK_MAIN()
@@ -24,6 +24,7 @@ struct Data
     uint64_t c;
 };
 
+template <bool field>
 void produce(CppBenchmark::Context& context)
 {
     const int readers_count = context.x();
@@ -40,8 +41,9 @@ void produce(CppBenchmark::Context& context)
         {
             for (;;)
             {
-                Data data = lock.Read();
-                if ((data.a + data.b + data.c) == (items_to_produce + 300))
+                // Field read loads only the words covering the required field
+                uint64_t item = field ? lock.Read(&Data::a) : lock.Read().a;
+                if (item == items_to_produce)
                     return;
                 Thread::Yield();
             }
@@ -72,7 +74,12 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("SeqLock", settings)
 {
-    produce(context);
+    produce<false>(context);
+}
+
+BENCHMARK("SeqLock-field", settings)
+{
+    produce<true>(context);
 }
 
 BENCHMARK_MAIN()
@@ -4,7 +4,11 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "threads/adaptive_mutex.h"
+#include "threads/clh_lock.h"
+#include "threads/mcs_lock.h"
 #include "threads/spin_lock.h"
+#include "threads/ticket_lock.h"
 
 #include <thread>
 #include <vector>
@@ -13,16 +17,17 @@ using namespace CppCommon;
 
 const uint64_t items_to_produce = 10000000;
 const int producers_from = 1;
-const int producers_to = 32;
+const int producers_to = 64;
 const auto settings = CppBenchmark::Settings().ParamRange(producers_from, producers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
+template <class TLock>
 void produce(CppBenchmark::Context& context)
 {
     const int producers_count = context.x();
     uint64_t crc = 0;
 
-    // Create spin-lock synchronization primitive
-    SpinLock lock;
+    // Create lock synchronization primitive
+    TLock lock;
 
     // Start producer threads
     std::vector<std::thread> producers;
@@ -33,7 +38,7 @@ void produce(CppBenchmark::Context& context)
             uint64_t items = (items_to_produce / producers_count);
             for (uint64_t i = 0; i < items; ++i)
             {
-                Locker<SpinLock> locker(lock);
+                Locker<TLock> locker(lock);
                 crc += (producer * items) + i;
             }
         });
@@ -50,7 +55,27 @@ void produce(CppBenchmark::Context& context)
 
 BENCHMARK("SpinLock", settings)
 {
-    produce(context);
+    produce<SpinLock>(context);
+}
+
+BENCHMARK("AdaptiveMutex", settings)
+{
+    produce<AdaptiveMutex>(context);
+}
+
+BENCHMARK("TicketLock", settings)
+{
+    produce<TicketLock>(context);
+}
+
+BENCHMARK("MCSLock", settings)
+{
+    produce<MCSLock>(context);
+}
+
+BENCHMARK("CLHLock", settings)
+{
+    produce<CLHLock>(context);
 }
 
 BENCHMARK_MAIN()
@@ -4,8 +4,11 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "system/cpu.h"
 #include "threads/spsc_ring_buffer.h"
+#include "threads/thread.h"
 
+#include <bitset>
 #include <functional>
 #include <thread>
 
@@ -15,9 +18,20 @@ const uint64_t bytes_to_produce = 100000000;
 const int item_size_from = 4;
 const int item_size_to = 4096;
 const auto settings = CppBenchmark::Settings().ParamRange(item_size_from, item_size_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+const int message_size_from = 1024;
+const int message_size_to = 4096;
+const auto zero_copy_settings = CppBenchmark::Settings().ParamRange(message_size_from, message_size_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Pin the current thread to the given logical core
+void pin(int core)
+{
+    std::bitset<64> affinity;
+    affinity.set(core % CPU::LogicalCores());
+    Thread::SetAffinity(affinity);
+}
 
 template<uint64_t N>
-void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy, bool pinned = false)
 {
     const int item_size = context.x();
     const uint64_t items_to_produce = bytes_to_produce / item_size;
@@ -27,8 +41,12 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     SPSCRingBuffer buffer(N);
 
     // Start consumer thread
-    auto consumer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce, &crc]()
+    auto consumer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce, &crc, pinned]()
     {
+        // Pin the consumer thread to the second core
+        if (pinned)
+            pin(1);
+
         // Use big items buffer to enable items batching
         uint8_t* items = new uint8_t[N];
 
@@ -52,8 +70,12 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     });
 
     // Start producer thread
-    auto producer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce]()
+    auto producer = std::thread([&buffer, &wait_strategy, item_size, items_to_produce, pinned]()
     {
+        // Pin the producer thread to the first core
+        if (pinned)
+            pin(0);
+
         uint8_t item[item_size_to];
 
         for (uint64_t i = 0; i < items_to_produce; ++i)
@@ -82,6 +104,78 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<uint64_t N, bool Mirrored>
+void produce_consume_zero_copy(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const int message_size = context.x();
+    const uint64_t messages_to_produce = bytes_to_produce / message_size;
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring buffer
+    SPSCRingBuffer buffer(N, Mirrored);
+
+    // Start consumer thread
+    auto consumer = std::thread([&buffer, &wait_strategy, message_size, messages_to_produce, &crc]()
+    {
+        const uint64_t bytes = messages_to_produce * message_size;
+
+        for (uint64_t consumed = 0; consumed < bytes;)
+        {
+            // Peek using the given waiting strategy
+            size_t size;
+            const uint8_t* messages;
+            while ((messages = (const uint8_t*)buffer.Peek(size)) == nullptr)
+                wait_strategy();
+
+            // Emulate consuming directly from the ring buffer
+            for (uint64_t j = 0; j < size; ++j)
+                crc += messages[j];
+
+            // Release the consumed region
+            buffer.Release(size);
+            consumed += size;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&buffer, &wait_strategy, message_size, messages_to_produce]()
+    {
+        for (uint64_t i = 0; i < messages_to_produce; ++i)
+        {
+            // Message could be split in non-mirrored mode
+            for (size_t offset = 0; offset < (size_t)message_size;)
+            {
+                // Reserve using the given waiting strategy
+                size_t size;
+                uint8_t* message;
+                while ((message = (uint8_t*)buffer.Reserve(size = message_size - offset)) == nullptr)
+                    wait_strategy();
+
+                // Emulate serializing directly into the ring buffer
+                for (size_t j = 0; j < size; ++j)
+                    message[j] = (uint8_t)(offset + j);
+
+                // Commit the serialized region
+                buffer.Commit(size);
+                offset += size;
+            }
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(messages_to_produce - 1);
+    context.metrics().AddItems(messages_to_produce);
+    context.metrics().AddBytes(messages_to_produce * message_size);
+    context.metrics().SetCustom("SPSCRingBuffer.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("SPSCRingBuffer<SpinWait>", settings)
 {
     produce_consume<1048576>(context, []{});
@@ -92,4 +186,24 @@ BENCHMARK("SPSCRingBuffer<YieldWait>", settings)
     produce_consume<1048576>(context, []{ std::this_thread::yield(); });
 }
 
+BENCHMARK("SPSCRingBuffer<SpinWait>-cross-core", settings)
+{
+    produce_consume<1048576>(context, []{}, true);
+}
+
+BENCHMARK("SPSCRingBuffer<SpinWait>-copy", zero_copy_settings)
+{
+    produce_consume<1048576>(context, []{});
+}
+
+BENCHMARK("SPSCRingBuffer<SpinWait>-zero-copy", zero_copy_settings)
+{
+    produce_consume_zero_copy<1048576, false>(context, []{});
+}
+
+BENCHMARK("SPSCRingBuffer<SpinWait>-zero-copy-mirrored", zero_copy_settings)
+{
+    produce_consume_zero_copy<1048576, true>(context, []{});
+}
+
 BENCHMARK_MAIN()
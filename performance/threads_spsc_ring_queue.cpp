@@ -4,17 +4,33 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "system/cpu.h"
 #include "threads/spsc_ring_queue.h"
+#include "threads/thread.h"
 
+#include <algorithm>
+#include <bitset>
 #include <functional>
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
 const uint64_t items_to_produce = 100000000;
+const int batch_from = 32;
+const int batch_to = 256;
+const auto settings = CppBenchmark::Settings().ParamRange(batch_from, batch_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+// Pin the current thread to the given logical core
+void pin(int core)
+{
+    std::bitset<64> affinity;
+    affinity.set(core % CPU::LogicalCores());
+    Thread::SetAffinity(affinity);
+}
 
 template<typename T, uint64_t N>
-void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+void produce_consume(CppBenchmark::Context& context, const std::function<void()>& wait_strategy, bool pinned = false)
 {
     uint64_t crc = 0;
 
@@ -22,8 +38,12 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     SPSCRingQueue<T> queue(N);
 
     // Start consumer thread
-    auto consumer = std::thread([&queue, &wait_strategy, &crc]()
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, pinned]()
     {
+        // Pin the consumer thread to the second core
+        if (pinned)
+            pin(1);
+
         for (uint64_t i = 0; i < items_to_produce; ++i)
         {
             // Dequeue using the given waiting strategy
@@ -37,8 +57,12 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     });
 
     // Start producer thread
-    auto producer = std::thread([&queue, &wait_strategy]()
+    auto producer = std::thread([&queue, &wait_strategy, pinned]()
     {
+        // Pin the producer thread to the first core
+        if (pinned)
+            pin(0);
+
         for (uint64_t i = 0; i < items_to_produce; ++i)
         {
             // Enqueue using the given waiting strategy
@@ -61,6 +85,74 @@ void produce_consume(CppBenchmark::Context& context, const std::function<void()>
     context.metrics().SetCustom("CRC", crc);
 }
 
+template<typename T, uint64_t N>
+void produce_consume_bulk(CppBenchmark::Context& context, const std::function<void()>& wait_strategy)
+{
+    const size_t batch = context.x();
+    uint64_t crc = 0;
+
+    // Create single producer / single consumer wait-free ring queue
+    SPSCRingQueue<T> queue(N);
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &wait_strategy, &crc, batch]()
+    {
+        std::vector<T> items(batch);
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Dequeue the bulk of items using the given waiting strategy
+            size_t count;
+            while ((count = queue.DequeueBulk(items.data(), batch)) == 0)
+                wait_strategy();
+
+            // Consume items
+            for (size_t j = 0; j < count; ++j)
+                crc += items[j];
+
+            // Increase the items counter
+            i += count;
+        }
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue, &wait_strategy, batch]()
+    {
+        std::vector<T> items(batch);
+        for (uint64_t i = 0; i < items_to_produce;)
+        {
+            // Prepare the bulk of items
+            size_t count = (size_t)std::min<uint64_t>(batch, items_to_produce - i);
+            for (size_t j = 0; j < count; ++j)
+                items[j] = (T)(i + j);
+
+            // Enqueue the bulk of items using the given waiting strategy
+            for (size_t enqueued = 0; enqueued < count;)
+            {
+                size_t result = queue.EnqueueBulk(items.data() + enqueued, count - enqueued);
+                if (result == 0)
+                    wait_strategy();
+                enqueued += result;
+            }
+
+            // Increase the items counter
+            i += count;
+        }
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce - 1);
+    context.metrics().AddItems(items_to_produce);
+    context.metrics().AddBytes(items_to_produce * sizeof(T));
+    context.metrics().SetCustom("SPSCRingQueue.capacity", N);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("SPSCRingQueue<SpinWait>")
 {
     produce_consume<int, 1048576>(context, []{});
@@ -71,4 +163,19 @@ BENCHMARK("SPSCRingQueue<YieldWait>")
     produce_consume<int, 1048576>(context, []{ std::this_thread::yield(); });
 }
 
+BENCHMARK("SPSCRingQueue<SpinWait>-cross-core")
+{
+    produce_consume<int, 1048576>(context, []{}, true);
+}
+
+BENCHMARK("SPSCRingQueue<SpinWait>-bulk", settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{});
+}
+
+BENCHMARK("SPSCRingQueue<YieldWait>-bulk", settings)
+{
+    produce_consume_bulk<int, 1048576>(context, []{ std::this_thread::yield(); });
+}
+
 BENCHMARK_MAIN()
@@ -0,0 +1,135 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/async_event_auto_reset.h"
+#include "threads/async_wait_queue.h"
+#include "threads/event_auto_reset.h"
+#include "threads/scheduler.h"
+#include "threads/wait_queue.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+const uint64_t items_to_switch = 1000000;
+const uint64_t items_to_produce = 1000000;
+
+// Ping-pong between two coroutines resumed by each other
+Task<> Ping(AsyncEventAutoReset& ping, AsyncEventAutoReset& pong, uint64_t& crc)
+{
+    for (uint64_t i = 0; i < items_to_switch; ++i)
+    {
+        co_await ping.Wait();
+        crc += i;
+        pong.Signal();
+    }
+}
+
+Task<> Pong(AsyncEventAutoReset& ping, AsyncEventAutoReset& pong)
+{
+    for (uint64_t i = 0; i < items_to_switch; ++i)
+    {
+        ping.Signal();
+        co_await pong.Wait();
+    }
+}
+
+Task<> Produce(AsyncWaitQueue<uint64_t>& queue)
+{
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+        co_await queue.Enqueue(i);
+    queue.Close();
+}
+
+Task<> Consume(AsyncWaitQueue<uint64_t>& queue, uint64_t& crc)
+{
+    uint64_t item;
+    while (co_await queue.Dequeue(item))
+        crc += item;
+}
+
+BENCHMARK("PingPong-EventAutoReset-threads")
+{
+    EventAutoReset ping;
+    EventAutoReset pong;
+    uint64_t crc = 0;
+
+    std::thread thread([&ping, &pong, &crc]()
+    {
+        for (uint64_t i = 0; i < items_to_switch; ++i)
+        {
+            ping.Wait();
+            crc += i;
+            pong.Signal();
+        }
+    });
+
+    for (uint64_t i = 0; i < items_to_switch; ++i)
+    {
+        ping.Signal();
+        pong.Wait();
+    }
+
+    thread.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * items_to_switch);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("PingPong-AsyncEventAutoReset-coroutines")
+{
+    InlineScheduler scheduler;
+    AsyncEventAutoReset ping;
+    AsyncEventAutoReset pong;
+    uint64_t crc = 0;
+
+    scheduler.Spawn(Ping(ping, pong, crc));
+    Pong(ping, pong).Get();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(2 * items_to_switch);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Queue-WaitQueue-threads")
+{
+    WaitQueue<uint64_t> queue(1024);
+    uint64_t crc = 0;
+
+    std::thread consumer([&queue, &crc]()
+    {
+        uint64_t item;
+        while (queue.Dequeue(item))
+            crc += item;
+    });
+
+    for (uint64_t i = 0; i < items_to_produce; ++i)
+        queue.Enqueue(i);
+    queue.Close();
+
+    consumer.join();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("Queue-AsyncWaitQueue-coroutines")
+{
+    InlineScheduler scheduler;
+    AsyncWaitQueue<uint64_t> queue(1024);
+    uint64_t crc = 0;
+
+    scheduler.Spawn(Consume(queue, crc));
+    Produce(queue).Get();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(items_to_produce);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,138 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "threads/work_stealing_pool.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+
+const int fibonacci_number = 30;
+const int fibonacci_cutoff = 12;
+const size_t sort_size = 1000000;
+const size_t sort_cutoff = 4096;
+const size_t for_size = 10000000;
+const size_t for_grain = 16384;
+const int workers_from = 1;
+const int workers_to = 8;
+const auto settings = CppBenchmark::Settings().ParamRange(workers_from, workers_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
+
+uint64_t Fibonacci(int n)
+{
+    return (n < 2) ? n : Fibonacci(n - 1) + Fibonacci(n - 2);
+}
+
+uint64_t Fibonacci(WorkStealingPool& pool, int n)
+{
+    if (n < fibonacci_cutoff)
+        return Fibonacci(n);
+
+    uint64_t x, y;
+    pool.Invoke([&]() { x = Fibonacci(pool, n - 1); }, [&]() { y = Fibonacci(pool, n - 2); });
+    return x + y;
+}
+
+void Sort(WorkStealingPool& pool, int* first, int* last, int* buffer)
+{
+    size_t size = last - first;
+    if (size <= sort_cutoff)
+    {
+        std::sort(first, last);
+        return;
+    }
+
+    // Parallel merge sort
+    int* middle = first + size / 2;
+    pool.Invoke([&]() { Sort(pool, first, middle, buffer); }, [&]() { Sort(pool, middle, last, buffer + size / 2); });
+    std::merge(first, middle, middle, last, buffer);
+    std::copy(buffer, buffer + size, first);
+}
+
+std::vector<int> Shuffled()
+{
+    std::vector<int> items(sort_size);
+    std::iota(items.begin(), items.end(), 0);
+    std::shuffle(items.begin(), items.end(), std::mt19937(0));
+    return items;
+}
+
+BENCHMARK("Fibonacci-sequential")
+{
+    uint64_t result = Fibonacci(fibonacci_number);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(result);
+    context.metrics().SetCustom("CRC", result);
+}
+
+BENCHMARK("Fibonacci-WorkStealingPool", settings)
+{
+    WorkStealingPool pool(context.x());
+
+    uint64_t result = 0;
+    pool.Run([&]() { result = Fibonacci(pool, fibonacci_number); });
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(result);
+    context.metrics().SetCustom("CRC", result);
+}
+
+BENCHMARK("Sort-sequential")
+{
+    std::vector<int> items = Shuffled();
+
+    std::sort(items.begin(), items.end());
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items.size());
+    context.metrics().AddBytes(items.size() * sizeof(int));
+    context.metrics().SetCustom("Sorted", std::is_sorted(items.begin(), items.end()) ? 1u : 0u);
+}
+
+BENCHMARK("Sort-WorkStealingPool", settings)
+{
+    WorkStealingPool pool(context.x());
+    std::vector<int> items = Shuffled();
+    std::vector<int> buffer(items.size());
+
+    pool.Run([&]() { Sort(pool, items.data(), items.data() + items.size(), buffer.data()); });
+
+    // Update benchmark metrics
+    context.metrics().AddItems(items.size());
+    context.metrics().AddBytes(items.size() * sizeof(int));
+    context.metrics().SetCustom("Sorted", std::is_sorted(items.begin(), items.end()) ? 1u : 0u);
+}
+
+BENCHMARK("ParallelFor-sequential")
+{
+    std::vector<uint64_t> items(for_size);
+
+    for (size_t i = 0; i < for_size; ++i)
+        items[i] = i * i;
+
+    // Update benchmark metrics
+    context.metrics().AddItems(for_size);
+    context.metrics().AddBytes(for_size * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", std::accumulate(items.begin(), items.end(), (uint64_t)0));
+}
+
+BENCHMARK("ParallelFor-WorkStealingPool", settings)
+{
+    WorkStealingPool pool(context.x());
+    std::vector<uint64_t> items(for_size);
+
+    pool.ParallelFor(0, for_size, for_grain, [&items](size_t i) { items[i] = i * i; });
+
+    // Update benchmark metrics
+    context.metrics().AddItems(for_size);
+    context.metrics().AddBytes(for_size * sizeof(uint64_t));
+    context.metrics().SetCustom("CRC", std::accumulate(items.begin(), items.end(), (uint64_t)0));
+}
+
+BENCHMARK_MAIN()
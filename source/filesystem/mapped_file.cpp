@@ -0,0 +1,507 @@
+/*!
+    \file mapped_file.cpp
+    \brief Filesystem memory-mapped file implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/mapped_file.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class MappedFile::Impl
+{
+    friend class MappedFile;
+
+public:
+    explicit Impl(const Path* path) : _path(path), _write(false), _populate(false), _base(nullptr), _length(0), _offset(0), _size(0), _position(0)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _file = -1;
+        _granularity = (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(_WIN32) || defined(_WIN64)
+        _file = INVALID_HANDLE_VALUE;
+        _mapping = nullptr;
+        SYSTEM_INFO si;
+        GetSystemInfo(&si);
+        _granularity = (size_t)si.dwAllocationGranularity;
+#endif
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            if (IsMapped())
+                Unmap();
+        }
+        catch (const FileSystemException& ex)
+        {
+            fatality(FileSystemException(ex.string()).Attach(path()));
+        }
+    }
+
+    const Path& path() const { return *_path; }
+
+    uint8_t* data() const noexcept { return (_base != nullptr) ? (_base + (size_t)(_offset % _granularity)) : nullptr; }
+    uint64_t offset() const noexcept { return _offset; }
+    size_t size() const noexcept { return _size; }
+    size_t position() const noexcept { return _position; }
+
+    uint64_t file_size() const
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct stat status;
+        int result = IsMapped() ? fstat(_file, &status) : stat(path().string().c_str(), &status);
+        if (result != 0)
+            throwex FileSystemException("Cannot get the current file size!").Attach(path());
+        return (uint64_t)status.st_size;
+#elif defined(_WIN32) || defined(_WIN64)
+        if (IsMapped())
+        {
+            LARGE_INTEGER result;
+            if (!GetFileSizeEx(_file, &result))
+                throwex FileSystemException("Cannot get the current file size!").Attach(path());
+            return (uint64_t)result.QuadPart;
+        }
+        else
+        {
+            WIN32_FILE_ATTRIBUTE_DATA fad;
+            if (!GetFileAttributesExW(path().wstring().c_str(), GetFileExInfoStandard, &fad))
+                throwex FileSystemException("Cannot get the current file size!").Attach(path());
+
+            LARGE_INTEGER result;
+            result.HighPart = fad.nFileSizeHigh;
+            result.LowPart = fad.nFileSizeLow;
+            return (uint64_t)result.QuadPart;
+        }
+#endif
+    }
+
+    bool IsMapped() const noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return (_file >= 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        return (_file != INVALID_HANDLE_VALUE);
+#endif
+    }
+
+    bool IsWritable() const noexcept
+    {
+        return IsMapped() && _write;
+    }
+
+    void Map(bool write, uint64_t offset, size_t size, bool populate)
+    {
+        // Unmap previously mapped file
+        assert(!IsMapped() && "File is already mapped!");
+        if (IsMapped())
+            Unmap();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _file = open(path().string().c_str(), (write ? O_RDWR : O_RDONLY));
+        if (_file < 0)
+            throwex FileSystemException("Cannot open the file for mapping!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        _file = CreateFileW(path().wstring().c_str(), GENERIC_READ | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open the file for mapping!").Attach(path());
+#endif
+        _write = write;
+        _populate = populate;
+
+        try
+        {
+            MapWindow(offset, size);
+        }
+        catch (...)
+        {
+            CloseFile();
+            throw;
+        }
+    }
+
+    void Remap(uint64_t offset, size_t size)
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        UnmapWindow();
+        MapWindow(offset, size);
+    }
+
+    void Resize(uint64_t size)
+    {
+        assert(IsWritable() && "File is not mapped for writing!");
+        if (!IsWritable())
+            throwex FileSystemException("File is not mapped for writing!").Attach(path());
+
+        // Mapped window must be released before the file truncation
+        uint64_t offset = std::min(_offset, size);
+        size_t position = _position;
+        UnmapWindow();
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = ftruncate(_file, (off_t)size);
+        if (result != 0)
+            throwex FileSystemException("Cannot resize the mapped file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        LARGE_INTEGER seek;
+        seek.QuadPart = (LONGLONG)size;
+        if (!SetFilePointerEx(_file, seek, nullptr, FILE_BEGIN) || !SetEndOfFile(_file))
+            throwex FileSystemException("Cannot resize the mapped file!").Attach(path());
+#endif
+
+        MapWindow(offset, 0);
+
+        // Keep the position to continue writing after the file is grown
+        _position = std::min(position, _size);
+    }
+
+    void Unmap()
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        UnmapWindow();
+        CloseFile();
+    }
+
+    void Advise(MappedFileAdvice advice, size_t offset, size_t size)
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        uint8_t* address;
+        size_t length;
+        if (!AlignRange(offset, size, address, length))
+            return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flags = MADV_NORMAL;
+        switch (advice)
+        {
+            case MappedFileAdvice::NORMAL:
+                flags = MADV_NORMAL;
+                break;
+            case MappedFileAdvice::SEQUENTIAL:
+                flags = MADV_SEQUENTIAL;
+                break;
+            case MappedFileAdvice::RANDOM:
+                flags = MADV_RANDOM;
+                break;
+            case MappedFileAdvice::WILLNEED:
+                flags = MADV_WILLNEED;
+                break;
+            case MappedFileAdvice::DONTNEED:
+                flags = MADV_DONTNEED;
+                break;
+        }
+        int result = madvise(address, length, flags);
+        if (result != 0)
+            throwex FileSystemException("Cannot advise the mapped file access pattern!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        // Only prefetching is supported by Windows API
+#if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+        if (advice == MappedFileAdvice::WILLNEED)
+        {
+            WIN32_MEMORY_RANGE_ENTRY range;
+            range.VirtualAddress = address;
+            range.NumberOfBytes = length;
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        }
+#endif
+#endif
+    }
+
+    size_t Read(uint8_t* buffer, size_t size)
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        size_t result = std::min(size, _size - _position);
+        if (result > 0)
+        {
+            std::memcpy(buffer, data() + _position, result);
+            _position += result;
+        }
+        return result;
+    }
+
+    size_t Write(const uint8_t* buffer, size_t size)
+    {
+        assert(IsWritable() && "File is not mapped for writing!");
+        if (!IsWritable())
+            throwex FileSystemException("File is not mapped for writing!").Attach(path());
+
+        size_t result = std::min(size, _size - _position);
+        if (result > 0)
+        {
+            std::memcpy(data() + _position, buffer, result);
+            _position += result;
+        }
+        return result;
+    }
+
+    void Seek(size_t position)
+    {
+        assert((position <= _size) && "Seek position is out of the mapped window!");
+        if (position > _size)
+            throwex FileSystemException("Cannot seek the mapped file!").Attach(path());
+
+        _position = position;
+    }
+
+    void Flush(size_t offset, size_t size, bool async)
+    {
+        assert(IsWritable() && "File is not mapped for writing!");
+        if (!IsWritable())
+            throwex FileSystemException("File is not mapped for writing!").Attach(path());
+
+        uint8_t* address;
+        size_t length;
+        if (!AlignRange(offset, size, address, length))
+            return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = msync(address, length, (async ? MS_ASYNC : MS_SYNC));
+        if (result != 0)
+            throwex FileSystemException("Cannot flush the mapped file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!FlushViewOfFile(address, length))
+            throwex FileSystemException("Cannot flush the mapped file!").Attach(path());
+        if (!async && !FlushFileBuffers(_file))
+            throwex FileSystemException("Cannot flush the mapped file!").Attach(path());
+#endif
+    }
+
+private:
+    const Path* _path;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int _file;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _file;
+    HANDLE _mapping;
+#endif
+    bool _write;
+    bool _populate;
+    size_t _granularity;
+    uint8_t* _base;
+    size_t _length;
+    uint64_t _offset;
+    size_t _size;
+    size_t _position;
+
+    void MapWindow(uint64_t offset, size_t size)
+    {
+        uint64_t total = file_size();
+        if ((offset > total) || (size > (total - offset)))
+            throwex FileSystemException("Mapped window is out of the file bounds!").Attach(path());
+        if (size == 0)
+            size = (size_t)(total - offset);
+
+        _offset = offset;
+        _size = size;
+        _position = 0;
+
+        // Empty window cannot be mapped
+        if (size == 0)
+            return;
+
+        // Mapping offset must be aligned to the allocation granularity
+        uint64_t aligned = offset - (offset % _granularity);
+        size_t length = size + (size_t)(offset - aligned);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        if (_populate)
+            flags |= MAP_POPULATE;
+#endif
+        void* base = mmap(nullptr, length, (PROT_READ | (_write ? PROT_WRITE : 0)), flags, _file, (off_t)aligned);
+        if (base == MAP_FAILED)
+            throwex FileSystemException("Cannot map the file into the memory!").Attach(path());
+#if !defined(MAP_POPULATE)
+        if (_populate)
+            madvise(base, length, MADV_WILLNEED);
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+        _mapping = CreateFileMappingW(_file, nullptr, (_write ? PAGE_READWRITE : PAGE_READONLY), 0, 0, nullptr);
+        if (_mapping == nullptr)
+            throwex FileSystemException("Cannot create the file mapping!").Attach(path());
+        void* base = MapViewOfFile(_mapping, (_write ? FILE_MAP_WRITE : FILE_MAP_READ), (DWORD)(aligned >> 32), (DWORD)(aligned & 0xFFFFFFFF), length);
+        if (base == nullptr)
+        {
+            CloseHandle(_mapping);
+            _mapping = nullptr;
+            throwex FileSystemException("Cannot map the file into the memory!").Attach(path());
+        }
+#endif
+        _base = (uint8_t*)base;
+        _length = length;
+
+#if defined(_WIN32) || defined(_WIN64)
+        if (_populate)
+            Advise(MappedFileAdvice::WILLNEED, 0, 0);
+#endif
+    }
+
+    void UnmapWindow()
+    {
+        if (_base != nullptr)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            int result = munmap(_base, _length);
+            if (result != 0)
+                throwex FileSystemException("Cannot unmap the file from the memory!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+            if (!UnmapViewOfFile(_base))
+                throwex FileSystemException("Cannot unmap the file from the memory!").Attach(path());
+            if (!CloseHandle(_mapping))
+                throwex FileSystemException("Cannot close the file mapping!").Attach(path());
+            _mapping = nullptr;
+#endif
+        }
+        _base = nullptr;
+        _length = 0;
+        _offset = 0;
+        _size = 0;
+        _position = 0;
+    }
+
+    void CloseFile()
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = close(_file);
+        _file = -1;
+        if (result != 0)
+            throwex FileSystemException("Cannot close the mapped file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        BOOL result = CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+        if (!result)
+            throwex FileSystemException("Cannot close the mapped file!").Attach(path());
+#endif
+        _write = false;
+        _populate = false;
+    }
+
+    // Convert the mapped window range into the page aligned memory range
+    bool AlignRange(size_t offset, size_t size, uint8_t*& address, size_t& length) const
+    {
+        assert((offset <= _size) && "Range offset is out of the mapped window!");
+        if (offset > _size)
+            throwex FileSystemException("Range is out of the mapped window!").Attach(path());
+        if (size == 0)
+            size = _size - offset;
+        assert((size <= (_size - offset)) && "Range size is out of the mapped window!");
+        if (size > (_size - offset))
+            throwex FileSystemException("Range is out of the mapped window!").Attach(path());
+        if ((_base == nullptr) || (size == 0))
+            return false;
+
+        // Mapped window base is always aligned to the allocation granularity
+        size_t begin = (size_t)(data() - _base) + offset;
+        size_t aligned = begin - (begin % _granularity);
+        address = _base + aligned;
+        length = begin + size - aligned;
+        return true;
+    }
+};
+
+//! @endcond
+
+MappedFile::MappedFile() : Path()
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "MappedFile::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "MappedFile::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(this);
+}
+
+MappedFile::MappedFile(const Path& path) : Path(path)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "MappedFile::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "MappedFile::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(this);
+}
+
+MappedFile::MappedFile(MappedFile&& file) noexcept : MappedFile()
+{
+    file.swap(*this);
+}
+
+MappedFile::~MappedFile()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+{
+    MappedFile(std::move(file)).swap(*this);
+    return *this;
+}
+
+uint8_t* MappedFile::data() noexcept { return impl().data(); }
+const uint8_t* MappedFile::data() const noexcept { return impl().data(); }
+uint64_t MappedFile::offset() const noexcept { return impl().offset(); }
+size_t MappedFile::size() const noexcept { return impl().size(); }
+size_t MappedFile::position() const noexcept { return impl().position(); }
+uint64_t MappedFile::file_size() const { return impl().file_size(); }
+
+bool MappedFile::IsMapped() const noexcept { return impl().IsMapped(); }
+bool MappedFile::IsWritable() const noexcept { return impl().IsWritable(); }
+
+void MappedFile::Map(bool write, uint64_t offset, size_t size, bool populate) { return impl().Map(write, offset, size, populate); }
+void MappedFile::Remap(uint64_t offset, size_t size) { return impl().Remap(offset, size); }
+void MappedFile::Resize(uint64_t size) { return impl().Resize(size); }
+void MappedFile::Unmap() { return impl().Unmap(); }
+
+void MappedFile::Advise(MappedFileAdvice advice, size_t offset, size_t size) { return impl().Advise(advice, offset, size); }
+
+size_t MappedFile::Read(void* buffer, size_t size) { return impl().Read((uint8_t*)buffer, size); }
+size_t MappedFile::Write(const void* buffer, size_t size) { return impl().Write((const uint8_t*)buffer, size); }
+void MappedFile::Seek(size_t position) { return impl().Seek(position); }
+void MappedFile::Flush(size_t offset, size_t size, bool async) { return impl().Flush(offset, size, async); }
+
+void MappedFile::swap(MappedFile& file) noexcept
+{
+    using std::swap;
+    Path::swap(file);
+    swap(_storage, file._storage);
+    swap(impl()._path, file.impl()._path);
+}
+
+} // namespace CppCommon
@@ -14,6 +14,12 @@
 
 #include "memory/memory.h"
 
+#include "time/timestamp.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <random>
+
 #if defined(__APPLE__)
 #include <mach/mach.h>
 #include <sys/sysctl.h>
@@ -26,10 +32,512 @@
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #include <wincrypt.h>
+#include <psapi.h>
+#endif
+
+#if defined(__x86_64__) || defined(__amd64__) || defined(_M_X64)
+#define CPPCOMMON_MEMORY_SIMD
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+#if defined(CPPCOMMON_MEMORY_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define CPPCOMMON_MEMORY_TARGET(features) __attribute__((target(features)))
+#else
+#define CPPCOMMON_MEMORY_TARGET(features)
 #endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+MemoryKernel DetectMemoryKernel() noexcept
+{
+#if defined(CPPCOMMON_MEMORY_SIMD)
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int ids = info[0];
+    if (ids < 1)
+        return MemoryKernel::SSE2;
+
+    // Check OS support of AVX (XMM/YMM) and AVX-512 (opmask/ZMM) registers state
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (ids < 7))
+        return MemoryKernel::SSE2;
+    unsigned long long xcr0 = _xgetbv(0);
+    bool avx_state = ((xcr0 & 0x06) == 0x06);
+    bool avx512_state = ((xcr0 & 0xE6) == 0xE6);
+
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0;
+    bool avx512f = (info[1] & (1 << 16)) != 0;
+    if (avx512f && avx512_state)
+        return MemoryKernel::AVX512;
+    if (avx2 && avx_state)
+        return MemoryKernel::AVX2;
+    return MemoryKernel::SSE2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return MemoryKernel::AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return MemoryKernel::AVX2;
+    return MemoryKernel::SSE2;
+#endif
+#else
+    return MemoryKernel::SCALAR;
+#endif
+}
+
+// Compiler barrier which makes the given buffer content observable
+inline void CompilerBarrier(void* buffer) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r"(buffer) : "memory");
+#elif defined(_MSC_VER)
+    _ReadWriteBarrier();
+    *(volatile uint8_t*)&buffer;
+#endif
+}
+
+// Non-temporal stores threshold to avoid cache pollution when zero filling huge buffers
+const size_t NON_TEMPORAL_THRESHOLD = 4 * 1024 * 1024;
+
+// xoshiro256** generator state for up to 8 parallel lanes (structure of arrays to load lanes with a single vector)
+struct alignas(64) RandomState
+{
+    uint64_t s[4][8];
+    bool seeded;
+};
+
+thread_local RandomState random_state = {};
+
+uint64_t SplitMix64(uint64_t& x) noexcept
+{
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+RandomState& GetRandomState() noexcept
+{
+    RandomState& state = random_state;
+    if (!state.seeded)
+    {
+        uint64_t seed = Timestamp::rdts() ^ (uint64_t)(uintptr_t)&state;
+        try
+        {
+            std::random_device device;
+            seed ^= ((uint64_t)device() << 32) | device();
+        }
+        catch (...) {}
+
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < 8; ++j)
+                state.s[i][j] = SplitMix64(seed);
+        state.seeded = true;
+    }
+    return state;
+}
+
+inline uint64_t RotateLeft(uint64_t x, int k) noexcept
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// Generate the next random value for the given lane
+inline uint64_t NextRandom(RandomState& state, size_t lane) noexcept
+{
+    uint64_t* s0 = &state.s[0][lane];
+    uint64_t* s1 = &state.s[1][lane];
+    uint64_t* s2 = &state.s[2][lane];
+    uint64_t* s3 = &state.s[3][lane];
+
+    const uint64_t result = RotateLeft(*s1 * 5, 7) * 9;
+    const uint64_t t = *s1 << 17;
+
+    *s2 ^= *s0;
+    *s3 ^= *s1;
+    *s1 ^= *s2;
+    *s0 ^= *s3;
+    *s2 ^= t;
+    *s3 = RotateLeft(*s3, 45);
+
+    return result;
+}
+
+bool IsZeroScalar(const uint8_t* buffer, size_t size) noexcept
+{
+    // Check unaligned head bytes
+    while ((size > 0) && (((uintptr_t)buffer & (sizeof(uint64_t) - 1)) != 0))
+    {
+        if (*buffer++ != 0)
+            return false;
+        --size;
+    }
+
+    // Check 64 bytes per iteration
+    while (size >= 64)
+    {
+        uint64_t ptr[8];
+        std::memcpy(ptr, buffer, sizeof(ptr));
+        if ((ptr[0] | ptr[1] | ptr[2] | ptr[3] | ptr[4] | ptr[5] | ptr[6] | ptr[7]) != 0)
+            return false;
+        buffer += 64;
+        size -= 64;
+    }
+
+    // Check tail words
+    while (size >= sizeof(uint64_t))
+    {
+        uint64_t value;
+        std::memcpy(&value, buffer, sizeof(value));
+        if (value != 0)
+            return false;
+        buffer += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+    }
+
+    // Check tail bytes
+    while (size > 0)
+    {
+        if (*buffer++ != 0)
+            return false;
+        --size;
+    }
+
+    return true;
+}
+
+void ZeroFillScalar(uint8_t* buffer, size_t size) noexcept
+{
+#if defined(_WIN32) || defined(_WIN64)
+    SecureZeroMemory(buffer, size);
+#else
+    std::memset(buffer, 0, size);
+#endif
+}
+
+void RandomFillScalar(RandomState& state, uint8_t* buffer, size_t size) noexcept
+{
+    while (size >= sizeof(uint64_t))
+    {
+        uint64_t value = NextRandom(state, 0);
+        std::memcpy(buffer, &value, sizeof(uint64_t));
+        buffer += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+    }
+    if (size > 0)
+    {
+        uint64_t value = NextRandom(state, 0);
+        std::memcpy(buffer, &value, size);
+    }
+}
+
+#if defined(CPPCOMMON_MEMORY_SIMD)
+
+bool IsZeroSSE2(const uint8_t* buffer, size_t size) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    // Check 64 bytes per iteration
+    while (size >= 64)
+    {
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(buffer + 0));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(buffer + 16));
+        __m128i v2 = _mm_loadu_si128((const __m128i*)(buffer + 32));
+        __m128i v3 = _mm_loadu_si128((const __m128i*)(buffer + 48));
+        __m128i v = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) != 0xFFFF)
+            return false;
+        buffer += 64;
+        size -= 64;
+    }
+
+    return IsZeroScalar(buffer, size);
+}
+
+CPPCOMMON_MEMORY_TARGET("avx2")
+bool IsZeroAVX2(const uint8_t* buffer, size_t size) noexcept
+{
+    // Check 128 bytes per iteration
+    while (size >= 128)
+    {
+        __m256i v0 = _mm256_loadu_si256((const __m256i*)(buffer + 0));
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(buffer + 32));
+        __m256i v2 = _mm256_loadu_si256((const __m256i*)(buffer + 64));
+        __m256i v3 = _mm256_loadu_si256((const __m256i*)(buffer + 96));
+        __m256i v = _mm256_or_si256(_mm256_or_si256(v0, v1), _mm256_or_si256(v2, v3));
+        if (!_mm256_testz_si256(v, v))
+            return false;
+        buffer += 128;
+        size -= 128;
+    }
+
+    return IsZeroSSE2(buffer, size);
+}
+
+CPPCOMMON_MEMORY_TARGET("avx512f")
+bool IsZeroAVX512(const uint8_t* buffer, size_t size) noexcept
+{
+    // Check 256 bytes per iteration
+    while (size >= 256)
+    {
+        __m512i v0 = _mm512_loadu_si512((const void*)(buffer + 0));
+        __m512i v1 = _mm512_loadu_si512((const void*)(buffer + 64));
+        __m512i v2 = _mm512_loadu_si512((const void*)(buffer + 128));
+        __m512i v3 = _mm512_loadu_si512((const void*)(buffer + 192));
+        __m512i v = _mm512_or_si512(_mm512_or_si512(v0, v1), _mm512_or_si512(v2, v3));
+        if (_mm512_test_epi64_mask(v, v) != 0)
+            return false;
+        buffer += 256;
+        size -= 256;
+    }
+
+    return IsZeroSSE2(buffer, size);
+}
+
+void ZeroFillSSE2(uint8_t* buffer, size_t size) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    if (size < 16)
+        return ZeroFillScalar(buffer, size);
+
+    // Fill unaligned head and tail
+    _mm_storeu_si128((__m128i*)buffer, zero);
+    _mm_storeu_si128((__m128i*)(buffer + size - 16), zero);
+
+    // Fill aligned body
+    uint8_t* ptr = (uint8_t*)(((uintptr_t)buffer + 16) & ~(uintptr_t)15);
+    uint8_t* end = (uint8_t*)(((uintptr_t)buffer + size) & ~(uintptr_t)15);
+    if (size >= NON_TEMPORAL_THRESHOLD)
+    {
+        for (; ptr < end; ptr += 16)
+            _mm_stream_si128((__m128i*)ptr, zero);
+        _mm_sfence();
+    }
+    else
+    {
+        for (; ptr < end; ptr += 16)
+            _mm_store_si128((__m128i*)ptr, zero);
+    }
+}
+
+CPPCOMMON_MEMORY_TARGET("avx2")
+void ZeroFillAVX2(uint8_t* buffer, size_t size) noexcept
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    if (size < 32)
+        return ZeroFillSSE2(buffer, size);
+
+    // Fill unaligned head and tail
+    _mm256_storeu_si256((__m256i*)buffer, zero);
+    _mm256_storeu_si256((__m256i*)(buffer + size - 32), zero);
+
+    // Fill aligned body
+    uint8_t* ptr = (uint8_t*)(((uintptr_t)buffer + 32) & ~(uintptr_t)31);
+    uint8_t* end = (uint8_t*)(((uintptr_t)buffer + size) & ~(uintptr_t)31);
+    if (size >= NON_TEMPORAL_THRESHOLD)
+    {
+        for (; ptr < end; ptr += 32)
+            _mm256_stream_si256((__m256i*)ptr, zero);
+        _mm_sfence();
+    }
+    else
+    {
+        for (; ptr < end; ptr += 32)
+            _mm256_store_si256((__m256i*)ptr, zero);
+    }
+}
+
+CPPCOMMON_MEMORY_TARGET("avx512f")
+void ZeroFillAVX512(uint8_t* buffer, size_t size) noexcept
+{
+    const __m512i zero = _mm512_setzero_si512();
+
+    if (size < 64)
+        return ZeroFillSSE2(buffer, size);
+
+    // Fill unaligned head and tail
+    _mm512_storeu_si512((void*)buffer, zero);
+    _mm512_storeu_si512((void*)(buffer + size - 64), zero);
+
+    // Fill aligned body
+    uint8_t* ptr = (uint8_t*)(((uintptr_t)buffer + 64) & ~(uintptr_t)63);
+    uint8_t* end = (uint8_t*)(((uintptr_t)buffer + size) & ~(uintptr_t)63);
+    if (size >= NON_TEMPORAL_THRESHOLD)
+    {
+        for (; ptr < end; ptr += 64)
+            _mm512_stream_si512((__m512i*)ptr, zero);
+        _mm_sfence();
+    }
+    else
+    {
+        for (; ptr < end; ptr += 64)
+            _mm512_store_si512((void*)ptr, zero);
+    }
+}
+
+// xoshiro256** step for 2 lanes (multiplications by 5 and 9 are replaced with shifts and additions)
+inline __m128i NextRandomSSE2(__m128i& s0, __m128i& s1, __m128i& s2, __m128i& s3) noexcept
+{
+    __m128i x = _mm_add_epi64(_mm_slli_epi64(s1, 2), s1);
+    x = _mm_or_si128(_mm_slli_epi64(x, 7), _mm_srli_epi64(x, 57));
+    __m128i result = _mm_add_epi64(_mm_slli_epi64(x, 3), x);
+
+    __m128i t = _mm_slli_epi64(s1, 17);
+    s2 = _mm_xor_si128(s2, s0);
+    s3 = _mm_xor_si128(s3, s1);
+    s1 = _mm_xor_si128(s1, s2);
+    s0 = _mm_xor_si128(s0, s3);
+    s2 = _mm_xor_si128(s2, t);
+    s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+
+    return result;
+}
+
+void RandomFillSSE2(RandomState& state, uint8_t* buffer, size_t size) noexcept
+{
+    __m128i s0 = _mm_load_si128((const __m128i*)state.s[0]);
+    __m128i s1 = _mm_load_si128((const __m128i*)state.s[1]);
+    __m128i s2 = _mm_load_si128((const __m128i*)state.s[2]);
+    __m128i s3 = _mm_load_si128((const __m128i*)state.s[3]);
+
+    while (size >= 16)
+    {
+        _mm_storeu_si128((__m128i*)buffer, NextRandomSSE2(s0, s1, s2, s3));
+        buffer += 16;
+        size -= 16;
+    }
+    if (size > 0)
+    {
+        alignas(16) uint8_t tail[16];
+        _mm_store_si128((__m128i*)tail, NextRandomSSE2(s0, s1, s2, s3));
+        std::memcpy(buffer, tail, size);
+    }
+
+    _mm_store_si128((__m128i*)state.s[0], s0);
+    _mm_store_si128((__m128i*)state.s[1], s1);
+    _mm_store_si128((__m128i*)state.s[2], s2);
+    _mm_store_si128((__m128i*)state.s[3], s3);
+}
+
+// xoshiro256** step for 4 lanes
+CPPCOMMON_MEMORY_TARGET("avx2")
+inline __m256i NextRandomAVX2(__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3) noexcept
+{
+    __m256i x = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+    x = _mm256_or_si256(_mm256_slli_epi64(x, 7), _mm256_srli_epi64(x, 57));
+    __m256i result = _mm256_add_epi64(_mm256_slli_epi64(x, 3), x);
+
+    __m256i t = _mm256_slli_epi64(s1, 17);
+    s2 = _mm256_xor_si256(s2, s0);
+    s3 = _mm256_xor_si256(s3, s1);
+    s1 = _mm256_xor_si256(s1, s2);
+    s0 = _mm256_xor_si256(s0, s3);
+    s2 = _mm256_xor_si256(s2, t);
+    s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+
+    return result;
+}
+
+CPPCOMMON_MEMORY_TARGET("avx2")
+void RandomFillAVX2(RandomState& state, uint8_t* buffer, size_t size) noexcept
+{
+    __m256i s0 = _mm256_load_si256((const __m256i*)state.s[0]);
+    __m256i s1 = _mm256_load_si256((const __m256i*)state.s[1]);
+    __m256i s2 = _mm256_load_si256((const __m256i*)state.s[2]);
+    __m256i s3 = _mm256_load_si256((const __m256i*)state.s[3]);
+
+    while (size >= 32)
+    {
+        _mm256_storeu_si256((__m256i*)buffer, NextRandomAVX2(s0, s1, s2, s3));
+        buffer += 32;
+        size -= 32;
+    }
+    if (size > 0)
+    {
+        alignas(32) uint8_t tail[32];
+        _mm256_store_si256((__m256i*)tail, NextRandomAVX2(s0, s1, s2, s3));
+        std::memcpy(buffer, tail, size);
+    }
+
+    _mm256_store_si256((__m256i*)state.s[0], s0);
+    _mm256_store_si256((__m256i*)state.s[1], s1);
+    _mm256_store_si256((__m256i*)state.s[2], s2);
+    _mm256_store_si256((__m256i*)state.s[3], s3);
+}
+
+// GCC reports the undefined pass-through operand of unmasked AVX-512 shifts and rotates as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// xoshiro256** step for 8 lanes
+CPPCOMMON_MEMORY_TARGET("avx512f")
+inline __m512i NextRandomAVX512(__m512i& s0, __m512i& s1, __m512i& s2, __m512i& s3) noexcept
+{
+    __m512i x = _mm512_add_epi64(_mm512_slli_epi64(s1, 2), s1);
+    x = _mm512_rol_epi64(x, 7);
+    __m512i result = _mm512_add_epi64(_mm512_slli_epi64(x, 3), x);
+
+    __m512i t = _mm512_slli_epi64(s1, 17);
+    s2 = _mm512_xor_si512(s2, s0);
+    s3 = _mm512_xor_si512(s3, s1);
+    s1 = _mm512_xor_si512(s1, s2);
+    s0 = _mm512_xor_si512(s0, s3);
+    s2 = _mm512_xor_si512(s2, t);
+    s3 = _mm512_rol_epi64(s3, 45);
+
+    return result;
+}
+
+CPPCOMMON_MEMORY_TARGET("avx512f")
+void RandomFillAVX512(RandomState& state, uint8_t* buffer, size_t size) noexcept
+{
+    __m512i s0 = _mm512_load_si512((const void*)state.s[0]);
+    __m512i s1 = _mm512_load_si512((const void*)state.s[1]);
+    __m512i s2 = _mm512_load_si512((const void*)state.s[2]);
+    __m512i s3 = _mm512_load_si512((const void*)state.s[3]);
+
+    while (size >= 64)
+    {
+        _mm512_storeu_si512((void*)buffer, NextRandomAVX512(s0, s1, s2, s3));
+        buffer += 64;
+        size -= 64;
+    }
+    if (size > 0)
+    {
+        alignas(64) uint8_t tail[64];
+        _mm512_store_si512((void*)tail, NextRandomAVX512(s0, s1, s2, s3));
+        std::memcpy(buffer, tail, size);
+    }
+
+    _mm512_store_si512((void*)state.s[0], s0);
+    _mm512_store_si512((void*)state.s[1], s1);
+    _mm512_store_si512((void*)state.s[2], s2);
+    _mm512_store_si512((void*)state.s[3], s3);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
 int64_t Memory::RamTotal()
 {
 #if defined(__APPLE__)
@@ -92,45 +600,123 @@ int64_t Memory::RamFree()
 #endif
 }
 
-bool Memory::IsZero(const void* buffer, size_t size) noexcept
+int64_t Memory::RamProcess()
 {
-    const char* ptr = (const char*)buffer;
-    for (size_t i = 0; i < size; ++i)
-        if (ptr[i] != 0)
-            return false;
-    return true;
-}
+#if defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    kern_return_t kernReturn = task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count);
+    if (kernReturn != KERN_SUCCESS)
+        return -1;
 
-void Memory::ZeroFill(void* buffer, size_t size)
-{
-#ifdef __STDC_LIB_EXT1__
-    memset_s(buffer, size, 0, size);
+    return (int64_t)info.resident_size;
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+    int fd = open("/proc/self/statm", O_RDONLY);
+    if (fd < 0)
+        return -1;
+
+    char buffer[128];
+    ssize_t size = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (size <= 0)
+        return -1;
+    buffer[size] = 0;
+
+    // The second field is the count of resident pages
+    int64_t pages = 0;
+    int64_t resident = 0;
+    if (sscanf(buffer, "%" SCNd64 " %" SCNd64, &pages, &resident) != 2)
+        return -1;
+
+    int64_t page_size = sysconf(_SC_PAGESIZE);
+    if ((resident >= 0) && (page_size > 0))
+        return resident * page_size;
+
+    return -1;
 #elif defined(_WIN32) || defined(_WIN64)
-    SecureZeroMemory(buffer, size);
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return -1;
+
+    return (int64_t)counters.WorkingSetSize;
 #else
-    volatile char* ptr = (volatile char*)buffer;
-    while (size--)
-        *ptr++ = 0;
+    #error Unsupported platform
 #endif
 }
 
-void Memory::RandomFill(void* buffer, size_t size)
+MemoryKernel Memory::Kernel() noexcept
 {
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    int fd = open("/dev/urandom", O_RDONLY);
-    if (fd < 0)
-        throwex SystemException("Cannot open '/dev/urandom' file for reading!");
-    ssize_t count = read(fd, buffer, size);
-    if (count < 0)
-        throwex SystemException("Cannot read from '/dev/urandom' file!");
-    int result = close(fd);
-    if (result != 0)
-        throwex SystemException("Cannot close '/dev/urandom' file!");
-#elif defined(_WIN32) || defined(_WIN64)
-    char* ptr = (char*)buffer;
-    for(size_t i = 0; i < size; ++i)
-        ptr[i] = rand() % 256;
+    static MemoryKernel kernel = Internals::DetectMemoryKernel();
+    return kernel;
+}
+
+bool Memory::IsKernelSupported(MemoryKernel kernel) noexcept
+{
+    return (kernel <= Kernel());
+}
+
+bool Memory::IsZero(const void* buffer, size_t size, MemoryKernel kernel) noexcept
+{
+    switch (std::min(kernel, Kernel()))
+    {
+#if defined(CPPCOMMON_MEMORY_SIMD)
+        case MemoryKernel::AVX512:
+            return Internals::IsZeroAVX512((const uint8_t*)buffer, size);
+        case MemoryKernel::AVX2:
+            return Internals::IsZeroAVX2((const uint8_t*)buffer, size);
+        case MemoryKernel::SSE2:
+            return Internals::IsZeroSSE2((const uint8_t*)buffer, size);
+#endif
+        default:
+            return Internals::IsZeroScalar((const uint8_t*)buffer, size);
+    }
+}
+
+void Memory::ZeroFill(void* buffer, size_t size, MemoryKernel kernel)
+{
+    switch (std::min(kernel, Kernel()))
+    {
+#if defined(CPPCOMMON_MEMORY_SIMD)
+        case MemoryKernel::AVX512:
+            Internals::ZeroFillAVX512((uint8_t*)buffer, size);
+            break;
+        case MemoryKernel::AVX2:
+            Internals::ZeroFillAVX2((uint8_t*)buffer, size);
+            break;
+        case MemoryKernel::SSE2:
+            Internals::ZeroFillSSE2((uint8_t*)buffer, size);
+            break;
+#endif
+        default:
+            Internals::ZeroFillScalar((uint8_t*)buffer, size);
+            break;
+    }
+
+    // Prevent the compiler to optimize out zero fill of the buffer which is not used anymore
+    Internals::CompilerBarrier(buffer);
+}
+
+void Memory::RandomFill(void* buffer, size_t size, MemoryKernel kernel)
+{
+    auto& state = Internals::GetRandomState();
+
+    switch (std::min(kernel, Kernel()))
+    {
+#if defined(CPPCOMMON_MEMORY_SIMD)
+        case MemoryKernel::AVX512:
+            Internals::RandomFillAVX512(state, (uint8_t*)buffer, size);
+            break;
+        case MemoryKernel::AVX2:
+            Internals::RandomFillAVX2(state, (uint8_t*)buffer, size);
+            break;
+        case MemoryKernel::SSE2:
+            Internals::RandomFillSSE2(state, (uint8_t*)buffer, size);
+            break;
 #endif
+        default:
+            Internals::RandomFillScalar(state, (uint8_t*)buffer, size);
+            break;
+    }
 }
 
 void Memory::CryptoFill(void* buffer, size_t size)
@@ -0,0 +1,305 @@
+/*!
+    \file memory_profiler.cpp
+    \brief Memory allocation profiler implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/memory_profiler.h"
+
+#include "system/stack_trace.h"
+#include "threads/spin_lock.h"
+
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Statistics shards count (must be a power of two)
+const size_t MEMORY_PROFILER_SHARDS = 16;
+
+// Statistics shard, every thread updates its own shard to avoid cache line bouncing
+struct alignas(128) MemoryProfilerShard
+{
+    std::atomic<uint64_t> allocations;
+    std::atomic<uint64_t> deallocations;
+    std::atomic<uint64_t> allocated;
+    std::atomic<uint64_t> deallocated;
+    std::atomic<uint64_t> samples;
+    std::atomic<uint64_t> histogram[MemoryProfiler::HISTOGRAM_SIZE];
+};
+
+// Sampled call stack
+struct MemoryProfilerStack
+{
+    uint64_t samples;
+    uint64_t sampled;
+    double estimated;
+};
+
+// Sampled call stacks table. It is never destroyed to allow recording deallocations during the process exit.
+struct MemoryProfilerStacks
+{
+    SpinLock lock;
+    std::unordered_map<std::string, MemoryProfilerStack> stacks;
+};
+
+std::atomic<bool> memory_profiler_enabled(false);
+std::atomic<size_t> memory_profiler_interval(512 * 1024);
+std::atomic<uint64_t> memory_profiler_generation(1);
+std::atomic<size_t> memory_profiler_shard(0);
+MemoryProfilerShard memory_profiler_shards[MEMORY_PROFILER_SHARDS];
+
+// Thread local profiler state
+thread_local size_t memory_profiler_thread_shard = (size_t)-1;
+thread_local int64_t memory_profiler_thread_countdown = 0;
+thread_local uint64_t memory_profiler_thread_generation = 0;
+thread_local uint64_t memory_profiler_thread_random = 0;
+thread_local bool memory_profiler_thread_sampling = false;
+
+MemoryProfilerStacks& GetMemoryProfilerStacks()
+{
+    static MemoryProfilerStacks* stacks = new MemoryProfilerStacks();
+    return *stacks;
+}
+
+MemoryProfilerShard& GetMemoryProfilerShard() noexcept
+{
+    if (memory_profiler_thread_shard == (size_t)-1)
+        memory_profiler_thread_shard = memory_profiler_shard.fetch_add(1, std::memory_order_relaxed) & (MEMORY_PROFILER_SHARDS - 1);
+    return memory_profiler_shards[memory_profiler_thread_shard];
+}
+
+// Exponentially distributed distance to the next sample with the given mean (Poisson process over allocated bytes)
+int64_t NextSamplingCountdown(size_t interval) noexcept
+{
+    // Seed xorshift generator with a thread local address
+    if (memory_profiler_thread_random == 0)
+        memory_profiler_thread_random = ((uint64_t)(uintptr_t)&memory_profiler_thread_random * 0x9E3779B97F4A7C15ull) | 1;
+
+    uint64_t x = memory_profiler_thread_random;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    memory_profiler_thread_random = x;
+
+    // Uniform random value in range (0, 1]
+    double u = ((double)(x >> 11) + 1.0) / 9007199254740992.0;
+    return (int64_t)(-std::log(u) * (double)interval) + 1;
+}
+
+void SampleAllocation(size_t size, size_t interval) noexcept
+{
+    // Avoid recursive sampling of allocations made by the sampling itself
+    memory_profiler_thread_sampling = true;
+
+    try
+    {
+        // Capture the current call stack skipping profiler frames
+        StackTrace trace(2);
+
+        // Build folded call stack from the outermost to the innermost frame
+        std::string folded;
+        const auto& frames = trace.frames();
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it)
+        {
+            if (!folded.empty())
+                folded += ';';
+            if (!it->function.empty())
+                folded += it->function;
+            else
+            {
+                std::stringstream ss;
+                ss << "0x" << std::hex << std::uppercase << (uintptr_t)it->address;
+                folded += ss.str();
+            }
+        }
+        if (folded.empty())
+            folded = "<unknown>";
+
+        // Estimate allocated bytes represented by the sample: size / P(sampled)
+        double probability = 1.0 - std::exp(-(double)size / (double)interval);
+        double estimated = (probability > 0.0) ? ((double)size / probability) : (double)interval;
+
+        // Register the sample in the call stacks table
+        auto& table = GetMemoryProfilerStacks();
+        Locker<SpinLock> locker(table.lock);
+        auto& stack = table.stacks[folded];
+        stack.samples += 1;
+        stack.sampled += size;
+        stack.estimated += estimated;
+    }
+    catch (...) {}
+
+    memory_profiler_thread_sampling = false;
+}
+
+} // namespace Internals
+//! @endcond
+
+std::ostream& operator<<(std::ostream& os, const MemoryProfiler::Statistics& statistics)
+{
+    os << "Allocations: " << statistics.allocations << std::endl;
+    os << "Deallocations: " << statistics.deallocations << std::endl;
+    os << "Allocated bytes: " << statistics.allocated << std::endl;
+    os << "Deallocated bytes: " << statistics.deallocated << std::endl;
+    os << "Live allocations: " << statistics.live_allocations() << std::endl;
+    os << "Live bytes: " << statistics.live_allocated() << std::endl;
+    os << "Samples: " << statistics.samples << std::endl;
+    os << "Size histogram:" << std::endl;
+    for (size_t i = 0; i < MemoryProfiler::HISTOGRAM_SIZE; ++i)
+    {
+        if (statistics.histogram[i] == 0)
+            continue;
+        uint64_t from = (i == 0) ? 0 : (1ull << (i - 1));
+        uint64_t to = (i == 0) ? 0 : ((i < 64) ? ((1ull << i) - 1) : std::numeric_limits<uint64_t>::max());
+        os << '[' << std::setw(20) << from << " - " << std::setw(20) << to << "]: " << statistics.histogram[i] << std::endl;
+    }
+    return os;
+}
+
+bool MemoryProfiler::IsEnabled() noexcept
+{
+    return Internals::memory_profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void MemoryProfiler::Enable() noexcept
+{
+    Internals::memory_profiler_enabled.store(true, std::memory_order_relaxed);
+}
+
+void MemoryProfiler::Disable() noexcept
+{
+    Internals::memory_profiler_enabled.store(false, std::memory_order_relaxed);
+}
+
+size_t MemoryProfiler::GetSamplingInterval() noexcept
+{
+    return Internals::memory_profiler_interval.load(std::memory_order_relaxed);
+}
+
+void MemoryProfiler::SetSamplingInterval(size_t interval) noexcept
+{
+    Internals::memory_profiler_interval.store(interval, std::memory_order_relaxed);
+
+    // Countdowns of all threads will be seeded again with the new sampling interval
+    Internals::memory_profiler_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryProfiler::RecordAllocation(size_t size) noexcept
+{
+    if (!Internals::memory_profiler_enabled.load(std::memory_order_relaxed))
+        return;
+
+    // Update allocation statistics
+    auto& shard = Internals::GetMemoryProfilerShard();
+    shard.allocations.fetch_add(1, std::memory_order_relaxed);
+    shard.allocated.fetch_add(size, std::memory_order_relaxed);
+    shard.histogram[std::bit_width(size)].fetch_add(1, std::memory_order_relaxed);
+
+    // Check if the allocation should be sampled
+    size_t interval = Internals::memory_profiler_interval.load(std::memory_order_relaxed);
+    if ((interval == 0) || Internals::memory_profiler_thread_sampling)
+        return;
+
+    // Seed the countdown on the first allocation of the thread (otherwise it is always sampled)
+    // and after the sampling interval is changed
+    uint64_t generation = Internals::memory_profiler_generation.load(std::memory_order_relaxed);
+    if (Internals::memory_profiler_thread_generation != generation)
+    {
+        Internals::memory_profiler_thread_generation = generation;
+        Internals::memory_profiler_thread_countdown = Internals::NextSamplingCountdown(interval);
+    }
+    Internals::memory_profiler_thread_countdown -= (int64_t)size;
+    if (Internals::memory_profiler_thread_countdown > 0)
+        return;
+
+    // Schedule the next sample and sample the current allocation
+    Internals::memory_profiler_thread_countdown = Internals::NextSamplingCountdown(interval);
+    shard.samples.fetch_add(1, std::memory_order_relaxed);
+    Internals::SampleAllocation(size, interval);
+}
+
+void MemoryProfiler::RecordDeallocation(size_t size) noexcept
+{
+    if (!Internals::memory_profiler_enabled.load(std::memory_order_relaxed))
+        return;
+
+    // Update deallocation statistics
+    auto& shard = Internals::GetMemoryProfilerShard();
+    shard.deallocations.fetch_add(1, std::memory_order_relaxed);
+    shard.deallocated.fetch_add(size, std::memory_order_relaxed);
+}
+
+MemoryProfiler::Statistics MemoryProfiler::GetStatistics() noexcept
+{
+    Statistics statistics = {};
+    for (const auto& shard : Internals::memory_profiler_shards)
+    {
+        statistics.allocations += shard.allocations.load(std::memory_order_relaxed);
+        statistics.deallocations += shard.deallocations.load(std::memory_order_relaxed);
+        statistics.allocated += shard.allocated.load(std::memory_order_relaxed);
+        statistics.deallocated += shard.deallocated.load(std::memory_order_relaxed);
+        statistics.samples += shard.samples.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            statistics.histogram[i] += shard.histogram[i].load(std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
+void MemoryProfiler::DumpFlameGraph(std::ostream& stream)
+{
+    // Copy sampled call stacks to avoid output under the lock
+    std::unordered_map<std::string, Internals::MemoryProfilerStack> stacks;
+    {
+        Internals::memory_profiler_thread_sampling = true;
+        auto& table = Internals::GetMemoryProfilerStacks();
+        Locker<SpinLock> locker(table.lock);
+        stacks = table.stacks;
+        Internals::memory_profiler_thread_sampling = false;
+    }
+
+    for (const auto& stack : stacks)
+        stream << stack.first << ' ' << (uint64_t)std::llround(stack.second.estimated) << std::endl;
+}
+
+std::string MemoryProfiler::DumpFlameGraph()
+{
+    std::stringstream ss;
+    DumpFlameGraph(ss);
+    return ss.str();
+}
+
+void MemoryProfiler::Reset()
+{
+    for (auto& shard : Internals::memory_profiler_shards)
+    {
+        shard.allocations.store(0, std::memory_order_relaxed);
+        shard.deallocations.store(0, std::memory_order_relaxed);
+        shard.allocated.store(0, std::memory_order_relaxed);
+        shard.deallocated.store(0, std::memory_order_relaxed);
+        shard.samples.store(0, std::memory_order_relaxed);
+        for (auto& bucket : shard.histogram)
+            bucket.store(0, std::memory_order_relaxed);
+    }
+
+    std::unordered_map<std::string, Internals::MemoryProfilerStack> stacks;
+    {
+        Internals::memory_profiler_thread_sampling = true;
+        auto& table = Internals::GetMemoryProfilerStacks();
+        Locker<SpinLock> locker(table.lock);
+        std::swap(stacks, table.stacks);
+        Internals::memory_profiler_thread_sampling = false;
+    }
+}
+
+} // namespace CppCommon
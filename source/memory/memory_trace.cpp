@@ -0,0 +1,204 @@
+/*!
+    \file memory_trace.cpp
+    \brief Memory allocation trace implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/memory_trace.h"
+
+#include "errors/exceptions.h"
+#include "memory/memory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Memory trace binary format signature and version
+const char MEMORY_TRACE_SIGNATURE[4] = { 'M', 'T', 'R', 'C' };
+const uint64_t MEMORY_TRACE_VERSION = 1;
+
+// Memory trace event tag: the lowest bit is set for deallocations, other bits store log2 of the allocation alignment
+const uint8_t MEMORY_TRACE_DEALLOCATION = 1;
+
+void WriteVarint(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back((uint8_t)value);
+}
+
+uint64_t ReadVarint(const std::vector<uint8_t>& buffer, size_t& offset)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (offset >= buffer.size())
+            throwex ArgumentException("Invalid memory trace: unexpected end of data!");
+
+        uint8_t byte = buffer[offset++];
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+    throwex ArgumentException("Invalid memory trace: variable-length integer is too long!");
+}
+
+} // namespace Internals
+//! @endcond
+
+void MemoryTrace::RecordAllocation(const void* ptr, size_t size, size_t alignment)
+{
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    if (ptr == nullptr)
+        return;
+
+    _pointers[ptr] = _allocations;
+    AddAllocation(size, alignment);
+}
+
+void MemoryTrace::RecordDeallocation(const void* ptr, [[maybe_unused]] size_t size)
+{
+    auto it = _pointers.find(ptr);
+    if (it == _pointers.end())
+        return;
+
+    size_t id = it->second;
+    assert((size == _sizes[id]) && "Deallocated block size must be equal to the allocated one!");
+    _pointers.erase(it);
+    AddDeallocation(id);
+}
+
+void MemoryTrace::Save(Writer& writer) const
+{
+    std::vector<uint8_t> buffer;
+    buffer.reserve(16 + _events.size() * 3);
+
+    buffer.insert(buffer.end(), std::begin(Internals::MEMORY_TRACE_SIGNATURE), std::end(Internals::MEMORY_TRACE_SIGNATURE));
+    Internals::WriteVarint(buffer, Internals::MEMORY_TRACE_VERSION);
+    Internals::WriteVarint(buffer, _events.size());
+
+    size_t allocations = 0;
+    for (const auto& event : _events)
+    {
+        if (event.allocation)
+        {
+            buffer.push_back((uint8_t)(std::countr_zero(event.alignment) << 1));
+            Internals::WriteVarint(buffer, event.size);
+            ++allocations;
+        }
+        else
+        {
+            // Recent allocations are usually freed first, so the distance is small
+            buffer.push_back(Internals::MEMORY_TRACE_DEALLOCATION);
+            Internals::WriteVarint(buffer, allocations - 1 - event.id);
+        }
+    }
+
+    writer.Write(buffer.data(), buffer.size());
+}
+
+void MemoryTrace::Load(Reader& reader)
+{
+    std::vector<uint8_t> buffer = reader.ReadAllBytes();
+
+    if ((buffer.size() < sizeof(Internals::MEMORY_TRACE_SIGNATURE)) || (std::memcmp(buffer.data(), Internals::MEMORY_TRACE_SIGNATURE, sizeof(Internals::MEMORY_TRACE_SIGNATURE)) != 0))
+        throwex ArgumentException("Invalid memory trace: wrong signature!");
+
+    size_t offset = sizeof(Internals::MEMORY_TRACE_SIGNATURE);
+    if (Internals::ReadVarint(buffer, offset) != Internals::MEMORY_TRACE_VERSION)
+        throwex ArgumentException("Invalid memory trace: unsupported version!");
+
+    uint64_t count = Internals::ReadVarint(buffer, offset);
+    if (count > (buffer.size() - offset))
+        throwex ArgumentException("Invalid memory trace: wrong events count!");
+
+    MemoryTrace trace;
+    trace._events.reserve((size_t)count);
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        if (offset >= buffer.size())
+            throwex ArgumentException("Invalid memory trace: unexpected end of data!");
+
+        uint8_t tag = buffer[offset++];
+        if ((tag & Internals::MEMORY_TRACE_DEALLOCATION) == 0)
+        {
+            size_t shift = tag >> 1;
+            if (shift >= (sizeof(size_t) * 8))
+                throwex ArgumentException("Invalid memory trace: wrong allocation alignment!");
+
+            uint64_t size = Internals::ReadVarint(buffer, offset);
+            trace.AddAllocation((size_t)size, (size_t)1 << shift);
+        }
+        else
+        {
+            uint64_t distance = Internals::ReadVarint(buffer, offset);
+            if (distance >= trace._allocations)
+                throwex ArgumentException("Invalid memory trace: wrong deallocation identifier!");
+
+            trace.AddDeallocation(trace._allocations - 1 - (size_t)distance);
+        }
+    }
+
+    swap(trace);
+}
+
+void MemoryTrace::Clear()
+{
+    _events.clear();
+    _sizes.clear();
+    _pointers.clear();
+    _allocations = 0;
+    _live = 0;
+    _live_allocations = 0;
+    _peak = 0;
+    _peak_allocations = 0;
+}
+
+void MemoryTrace::AddAllocation(size_t size, size_t alignment)
+{
+    _events.push_back({ true, _allocations, size, alignment });
+    _sizes.push_back(size);
+    ++_allocations;
+
+    // Update live statistics
+    _live += size;
+    ++_live_allocations;
+    _peak = std::max(_peak, _live);
+    _peak_allocations = std::max(_peak_allocations, _live_allocations);
+}
+
+void MemoryTrace::AddDeallocation(size_t id)
+{
+    size_t size = _sizes[id];
+    _events.push_back({ false, id, size, 0 });
+
+    // Update live statistics
+    _live -= size;
+    --_live_allocations;
+}
+
+void MemoryTrace::swap(MemoryTrace& trace) noexcept
+{
+    using std::swap;
+    swap(_events, trace._events);
+    swap(_sizes, trace._sizes);
+    swap(_pointers, trace._pointers);
+    swap(_allocations, trace._allocations);
+    swap(_live, trace._live);
+    swap(_live_allocations, trace._live_allocations);
+    swap(_peak, trace._peak);
+    swap(_peak_allocations, trace._peak_allocations);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,152 @@
+/*!
+    \file mirrored_memory.cpp
+    \brief Mirrored memory buffer implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "memory/mirrored_memory.h"
+
+#include "errors/fatal.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+int CreateAnonymousMemoryFile()
+{
+#if defined(__linux__)
+    return memfd_create("cppcommon-mirrored-memory", MFD_CLOEXEC);
+#else
+    static std::atomic<uint64_t> counter(0);
+
+    // Create a uniquely named shared memory object and unlink it immediately
+    std::string name = "/cppcommon-mirrored-memory-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+    int file = shm_open(name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
+    if (file != -1)
+        shm_unlink(name.c_str());
+    return file;
+#endif
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+MirroredMemory::MirroredMemory(size_t size) : _ptr(nullptr), _size(size)
+{
+    assert((size > 0) && "Mirrored memory buffer size must be greater than zero!");
+    assert(((size % Granularity()) == 0) && "Mirrored memory buffer size must be a multiple of the virtual memory granularity!");
+    if ((size == 0) || ((size % Granularity()) != 0))
+        throwex ArgumentException("Invalid mirrored memory buffer size!");
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Create an anonymous memory file
+    int file = Internals::CreateAnonymousMemoryFile();
+    if (file == -1)
+        throwex SystemException("Failed to create an anonymous memory file!");
+
+    if (ftruncate(file, (off_t)size) != 0)
+    {
+        close(file);
+        throwex SystemException("Failed to truncate an anonymous memory file!");
+    }
+
+    // Reserve the virtual memory region for the buffer and its mirror
+    uint8_t* base = (uint8_t*)mmap(nullptr, 2 * size, PROT_NONE, (MAP_PRIVATE | MAP_ANONYMOUS), -1, 0);
+    if (base == MAP_FAILED)
+    {
+        close(file);
+        throwex SystemException("Failed to reserve a mirrored memory region!");
+    }
+
+    // Map the anonymous memory file twice into the reserved region
+    void* buffer = mmap(base, size, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_FIXED), file, 0);
+    void* mirror = mmap(base + size, size, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_FIXED), file, 0);
+    close(file);
+    if ((buffer != base) || (mirror != (base + size)))
+    {
+        munmap(base, 2 * size);
+        throwex SystemException("Failed to map a mirrored memory buffer!");
+    }
+
+    _ptr = base;
+#elif defined(_WIN32) || defined(_WIN64)
+    // Create an anonymous file mapping
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)(size & 0xFFFFFFFF), nullptr);
+    if (mapping == nullptr)
+        throwex SystemException("Failed to create an anonymous file mapping!");
+
+    // Another thread could take the free region between its release and mapping, so try several times
+    for (int attempt = 0; (attempt < 16) && (_ptr == nullptr); ++attempt)
+    {
+        // Find the free virtual memory region for the buffer and its mirror
+        uint8_t* base = (uint8_t*)VirtualAlloc(nullptr, 2 * size, MEM_RESERVE, PAGE_NOACCESS);
+        if (base == nullptr)
+            break;
+        VirtualFree(base, 0, MEM_RELEASE);
+
+        // Map the file mapping twice into the found region
+        void* buffer = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, base);
+        void* mirror = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, base + size);
+        if ((buffer == base) && (mirror == (base + size)))
+            _ptr = base;
+        else
+        {
+            if (buffer != nullptr)
+                UnmapViewOfFile(buffer);
+            if (mirror != nullptr)
+                UnmapViewOfFile(mirror);
+        }
+    }
+
+    // Mapped views keep the file mapping alive
+    CloseHandle(mapping);
+
+    if (_ptr == nullptr)
+        throwex SystemException("Failed to map a mirrored memory buffer!");
+#endif
+}
+
+MirroredMemory::~MirroredMemory()
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int result = munmap(_ptr, 2 * _size);
+    if (result != 0)
+        fatality(SystemException("Failed to unmap a mirrored memory buffer!"));
+#elif defined(_WIN32) || defined(_WIN64)
+    if (!UnmapViewOfFile(_ptr) || !UnmapViewOfFile((uint8_t*)_ptr + _size))
+        fatality(SystemException("Failed to unmap a mirrored memory buffer!"));
+#endif
+}
+
+size_t MirroredMemory::Granularity() noexcept
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    return (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(_WIN32) || defined(_WIN64)
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (size_t)si.dwAllocationGranularity;
+#endif
+}
+
+} // namespace CppCommon
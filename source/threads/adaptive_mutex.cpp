@@ -0,0 +1,63 @@
+/*!
+    \file adaptive_mutex.cpp
+    \brief Adaptive mutex synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/adaptive_mutex.h"
+
+#include "threads/spin_wait.h"
+
+namespace CppCommon {
+
+bool AdaptiveMutex::Spin() noexcept
+{
+    // Do not spin if other threads are already parked
+    uint64_t start = Timestamp::rdts();
+    uint32_t state;
+    while ((state = _state.load(std::memory_order_relaxed)) != UNLOCKED)
+    {
+        if ((state == CONTENDED) || ((Timestamp::rdts() - start) >= SPIN_CYCLES))
+            return false;
+        SpinWait::Pause();
+    }
+    return true;
+}
+
+void AdaptiveMutex::LockSlow() noexcept
+{
+    // Spin while the owner is likely to release the mutex soon
+    if (Spin() && TryLock())
+        return;
+
+    // Mark the mutex as contended and park until it is released
+    while (_state.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+        Futex::Wait(_state, CONTENDED);
+}
+
+bool AdaptiveMutex::TryLockFor(const Timespan& timespan) noexcept
+{
+    if (TryLock())
+        return true;
+
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+
+    // Spin while the owner is likely to release the mutex soon
+    if (Spin() && TryLock())
+        return true;
+
+    // Mark the mutex as contended and park until it is released or the timeout is occurred
+    while (_state.exchange(CONTENDED, std::memory_order_acquire) != UNLOCKED)
+    {
+        Timestamp now = NanoTimestamp();
+        if (now >= finish)
+            return false;
+        Futex::WaitFor(_state, CONTENDED, finish - now);
+    }
+    return true;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,54 @@
+/*!
+    \file async_event_auto_reset.cpp
+    \brief Awaitable auto-reset event synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_event_auto_reset.h"
+
+namespace CppCommon {
+
+void AsyncEventAutoReset::Signal()
+{
+    AsyncWaiter* waiter;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        // Resume the next waiter or keep the event signaled
+        waiter = _waiters.Pop();
+        if (waiter == nullptr)
+            _signaled = true;
+    }
+
+    if (waiter != nullptr)
+        waiter->handle.resume();
+}
+
+bool AsyncEventAutoReset::TryWait()
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (!_signaled)
+        return false;
+
+    _signaled = false;
+    return true;
+}
+
+bool AsyncEventAutoReset::Suspend(AsyncWaiter* waiter)
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (_signaled)
+    {
+        _signaled = false;
+        return false;
+    }
+
+    _waiters.Push(waiter);
+    return true;
+}
+
+} // namespace CppCommon
@@ -0,0 +1,48 @@
+/*!
+    \file async_event_manual_reset.cpp
+    \brief Awaitable manual-reset event synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_event_manual_reset.h"
+
+namespace CppCommon {
+
+void AsyncEventManualReset::Reset()
+{
+    Locker<SpinLock> locker(_lock);
+    _signaled = false;
+}
+
+void AsyncEventManualReset::Signal()
+{
+    AsyncWaiter* waiters;
+    {
+        Locker<SpinLock> locker(_lock);
+        _signaled = true;
+        waiters = _waiters.PopAll();
+    }
+
+    AsyncWaiters::ResumeAll(waiters);
+}
+
+bool AsyncEventManualReset::TryWait()
+{
+    Locker<SpinLock> locker(_lock);
+    return _signaled;
+}
+
+bool AsyncEventManualReset::Suspend(AsyncWaiter* waiter)
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (_signaled)
+        return false;
+
+    _waiters.Push(waiter);
+    return true;
+}
+
+} // namespace CppCommon
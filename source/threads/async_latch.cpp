@@ -0,0 +1,65 @@
+/*!
+    \file async_latch.cpp
+    \brief Awaitable latch synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_latch.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+int AsyncLatch::counter() const noexcept
+{
+    Locker<SpinLock> locker(_lock);
+    return _counter;
+}
+
+void AsyncLatch::Reset(int counter)
+{
+    Locker<SpinLock> locker(_lock);
+    assert(_waiters.empty() && "Latch must not have suspended coroutines on reset!");
+    _counter = counter;
+}
+
+void AsyncLatch::CountDown(int count)
+{
+    AsyncWaiter* waiters = nullptr;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        if (_counter <= 0)
+            return;
+
+        _counter -= count;
+        if (_counter <= 0)
+        {
+            _counter = 0;
+            waiters = _waiters.PopAll();
+        }
+    }
+
+    AsyncWaiters::ResumeAll(waiters);
+}
+
+bool AsyncLatch::TryWait()
+{
+    Locker<SpinLock> locker(_lock);
+    return (_counter == 0);
+}
+
+bool AsyncLatch::Suspend(AsyncWaiter* waiter)
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (_counter == 0)
+        return false;
+
+    _waiters.Push(waiter);
+    return true;
+}
+
+} // namespace CppCommon
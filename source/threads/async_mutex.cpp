@@ -0,0 +1,54 @@
+/*!
+    \file async_mutex.cpp
+    \brief Awaitable mutex synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_mutex.h"
+
+namespace CppCommon {
+
+bool AsyncMutex::TryLock()
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (_locked)
+        return false;
+
+    _locked = true;
+    return true;
+}
+
+bool AsyncMutex::Suspend(AsyncWaiter* waiter)
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (!_locked)
+    {
+        _locked = true;
+        return false;
+    }
+
+    _waiters.Push(waiter);
+    return true;
+}
+
+void AsyncMutex::Unlock()
+{
+    AsyncWaiter* waiter;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        // Hand the ownership over to the next waiter
+        waiter = _waiters.Pop();
+        if (waiter == nullptr)
+            _locked = false;
+    }
+
+    if (waiter != nullptr)
+        waiter->handle.resume();
+}
+
+} // namespace CppCommon
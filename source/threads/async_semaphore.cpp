@@ -0,0 +1,67 @@
+/*!
+    \file async_semaphore.cpp
+    \brief Awaitable semaphore synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_semaphore.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+AsyncSemaphore::AsyncSemaphore(int resources) : _resources(resources)
+{
+    assert((resources > 0) && "Semaphore resources counter must be greater than zero!");
+}
+
+int AsyncSemaphore::resources() const noexcept
+{
+    Locker<SpinLock> locker(_lock);
+    return _resources;
+}
+
+bool AsyncSemaphore::TryLock()
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (_resources == 0)
+        return false;
+
+    --_resources;
+    return true;
+}
+
+bool AsyncSemaphore::Suspend(AsyncWaiter* waiter)
+{
+    Locker<SpinLock> locker(_lock);
+
+    if (_resources > 0)
+    {
+        --_resources;
+        return false;
+    }
+
+    _waiters.Push(waiter);
+    return true;
+}
+
+void AsyncSemaphore::Unlock()
+{
+    AsyncWaiter* waiter;
+    {
+        Locker<SpinLock> locker(_lock);
+
+        // Hand the released resource over to the next waiter
+        waiter = _waiters.Pop();
+        if (waiter == nullptr)
+            ++_resources;
+    }
+
+    if (waiter != nullptr)
+        waiter->handle.resume();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,151 @@
+/*!
+    \file distributed_rw_lock.cpp
+    \brief Distributed read/write lock synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/distributed_rw_lock.h"
+
+#include "system/cpu.h"
+#include "threads/spin_wait.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+uint32_t ReaderSlotIndex() noexcept
+{
+    // Assign reader slots to threads round-robin
+    static std::atomic<uint32_t> counter(0);
+    thread_local uint32_t index = counter.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+} // namespace Internals
+//! @endcond
+
+DistributedRWLock::DistributedRWLock(bool writer_preference) : _writer_preference(writer_preference), _state(0)
+{
+    // Round up the count of reader slots to the power of two
+    size_t cores = (size_t)std::max(CPU::LogicalCores(), 1);
+    size_t slots = 1;
+    while (slots < cores)
+        slots <<= 1;
+
+    _slots.reset(new Slot[slots]);
+    _mask = slots - 1;
+}
+
+DistributedRWLock::Slot& DistributedRWLock::Current() noexcept
+{
+    return _slots[Internals::ReaderSlotIndex() & _mask];
+}
+
+bool DistributedRWLock::Drained() const noexcept
+{
+    for (size_t i = 0; i <= _mask; ++i)
+        if (_slots[i].readers.load(std::memory_order_seq_cst) != 0)
+            return false;
+    return true;
+}
+
+void DistributedRWLock::Raise() noexcept
+{
+    // Paired with the reader slot increment followed by the writer flag check
+    _state.store(WRITER, std::memory_order_seq_cst);
+}
+
+void DistributedRWLock::Drop() noexcept
+{
+    if ((_state.exchange(0, std::memory_order_release) & WAITERS) != 0)
+        Futex::WakeAll(_state);
+}
+
+bool DistributedRWLock::TryLockRead() noexcept
+{
+    Slot& slot = Current();
+    slot.readers.fetch_add(1, std::memory_order_seq_cst);
+    if ((_state.load(std::memory_order_seq_cst) & WRITER) == 0)
+        return true;
+
+    // Step back for the writer
+    slot.readers.fetch_sub(1, std::memory_order_release);
+    return false;
+}
+
+bool DistributedRWLock::TryLockWrite() noexcept
+{
+    if (!_writers.TryLock())
+        return false;
+
+    Raise();
+    if (Drained())
+        return true;
+
+    // Step back for the active readers
+    Drop();
+    _writers.Unlock();
+    return false;
+}
+
+void DistributedRWLock::LockRead() noexcept
+{
+    Slot& slot = Current();
+    for (;;)
+    {
+        slot.readers.fetch_add(1, std::memory_order_seq_cst);
+        if ((_state.load(std::memory_order_seq_cst) & WRITER) == 0)
+            return;
+
+        // Step back for the writer and park until it is done
+        slot.readers.fetch_sub(1, std::memory_order_release);
+        uint32_t state;
+        while (((state = _state.fetch_or(WAITERS, std::memory_order_acquire)) & WRITER) != 0)
+            Futex::Wait(_state, state | WAITERS);
+    }
+}
+
+void DistributedRWLock::LockWrite() noexcept
+{
+    _writers.Lock();
+
+    SpinWait spin;
+    for (;;)
+    {
+        Raise();
+
+        // Wait for active readers to drain while new readers are blocked
+        if (_writer_preference)
+        {
+            while (!Drained())
+                spin.Spin();
+            return;
+        }
+
+        if (Drained())
+            return;
+
+        // Step back for the active readers and retry when they are gone
+        Drop();
+        while (!Drained())
+            spin.Spin();
+    }
+}
+
+void DistributedRWLock::UnlockRead() noexcept
+{
+    Current().readers.fetch_sub(1, std::memory_order_release);
+}
+
+void DistributedRWLock::UnlockWrite() noexcept
+{
+    Drop();
+    _writers.Unlock();
+}
+
+} // namespace CppCommon
@@ -0,0 +1,74 @@
+/*!
+    \file epoch_reclamation.cpp
+    \brief Epoch-based memory reclamation domain implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/epoch_reclamation.h"
+
+namespace CppCommon {
+
+void EpochReclamation::Reclaim()
+{
+    ReclamationDomain::Record& record = Acquire();
+    Stamp(record);
+    Advance();
+    Advance();
+    Collect(record);
+}
+
+void EpochReclamation::Scan(ReclamationDomain::Record& record)
+{
+    Stamp(record);
+    Advance();
+    Collect(record);
+}
+
+void EpochReclamation::Stamp(ReclamationDomain::Record& record)
+{
+    // Read-modify-write operation heads the release sequence of the global epoch,
+    // so readers which observe any later epoch also observe all unlinked pointers
+    uint64_t epoch = _epoch.fetch_add(0, std::memory_order_acq_rel);
+
+    for (auto it = record.retired.rbegin(); (it != record.retired.rend()) && (it->epoch == 0); ++it)
+        it->epoch = epoch;
+}
+
+void EpochReclamation::Advance()
+{
+    uint64_t epoch = _epoch.load(std::memory_order_acquire);
+
+    // Paired with the fence after the epoch announcement
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Check that all readers inside critical sections announced the current epoch
+    for (auto current = first(); current != nullptr; current = current->next)
+    {
+        uint64_t announced = static_cast<Record*>(current)->epoch.load(std::memory_order_acquire);
+        if ((announced != 0) && (announced != epoch))
+            return;
+    }
+
+    _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+void EpochReclamation::Collect(ReclamationDomain::Record& record)
+{
+    uint64_t epoch = _epoch.load(std::memory_order_acquire);
+
+    // Delete all retired pointers which are two epochs old
+    size_t kept = 0;
+    for (size_t i = 0; i < record.retired.size(); ++i)
+    {
+        const auto& retired = record.retired[i];
+        if ((retired.epoch == 0) || ((retired.epoch + 2) > epoch))
+            record.retired[kept++] = retired;
+        else
+            retired.deleter(retired.ptr, retired.context);
+    }
+    record.retired.resize(kept);
+}
+
+} // namespace CppCommon
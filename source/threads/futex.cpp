@@ -0,0 +1,180 @@
+/*!
+    \file futex.cpp
+    \brief Futex synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/futex.h"
+
+#include "threads/thread.h"
+
+#include <algorithm>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex word must be a plain 32-bit integer!");
+
+#if defined(__linux__)
+
+long FutexCall(std::atomic<uint32_t>& word, int operation, uint32_t value, const struct timespec* timeout, bool shared) noexcept
+{
+    return syscall(SYS_futex, (uint32_t*)&word, shared ? operation : (operation | FUTEX_PRIVATE_FLAG), value, timeout, nullptr, 0);
+}
+
+#elif defined(_WIN32) || defined(_WIN64)
+
+typedef BOOL (WINAPI *WaitOnAddressFunction)(volatile VOID* Address, PVOID CompareAddress, SIZE_T AddressSize, DWORD dwMilliseconds);
+typedef VOID (WINAPI *WakeByAddressFunction)(PVOID Address);
+
+struct WaitOnAddressAPI
+{
+    WaitOnAddressFunction WaitOnAddress;
+    WakeByAddressFunction WakeByAddressSingle;
+    WakeByAddressFunction WakeByAddressAll;
+
+    WaitOnAddressAPI() : WaitOnAddress(nullptr), WakeByAddressSingle(nullptr), WakeByAddressAll(nullptr)
+    {
+        HMODULE module = LoadLibraryA("api-ms-win-core-synch-l1-2-0.dll");
+        if (module != nullptr)
+        {
+            WaitOnAddress = (WaitOnAddressFunction)GetProcAddress(module, "WaitOnAddress");
+            WakeByAddressSingle = (WakeByAddressFunction)GetProcAddress(module, "WakeByAddressSingle");
+            WakeByAddressAll = (WakeByAddressFunction)GetProcAddress(module, "WakeByAddressAll");
+        }
+    }
+
+    bool available() const noexcept { return (WaitOnAddress != nullptr) && (WakeByAddressSingle != nullptr) && (WakeByAddressAll != nullptr); }
+};
+
+const WaitOnAddressAPI& GetWaitOnAddressAPI()
+{
+    static WaitOnAddressAPI api;
+    return api;
+}
+
+#endif
+
+// Emulated parking interval for platforms without futex support
+const int64_t FUTEX_EMULATION_INTERVAL = 50000;
+
+} // namespace Internals
+//! @endcond
+
+void Futex::Wait(std::atomic<uint32_t>& word, uint32_t expected, bool shared) noexcept
+{
+#if defined(__linux__)
+    Internals::FutexCall(word, FUTEX_WAIT, expected, nullptr, shared);
+#elif defined(_WIN32) || defined(_WIN64)
+    const auto& api = Internals::GetWaitOnAddressAPI();
+    if (api.available() && !shared)
+    {
+        api.WaitOnAddress(&word, &expected, sizeof(uint32_t), INFINITE);
+        return;
+    }
+    if (word.load(std::memory_order_acquire) == expected)
+        Thread::SleepFor(Timespan(Internals::FUTEX_EMULATION_INTERVAL));
+#else
+    (void)shared;
+    if (word.load(std::memory_order_acquire) == expected)
+        Thread::SleepFor(Timespan(Internals::FUTEX_EMULATION_INTERVAL));
+#endif
+}
+
+bool Futex::WaitFor(std::atomic<uint32_t>& word, uint32_t expected, const Timespan& timespan, bool shared) noexcept
+{
+    if (timespan < 0)
+        return false;
+
+#if defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = timespan.seconds();
+    timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
+    if (Internals::FutexCall(word, FUTEX_WAIT, expected, &timeout, shared) == 0)
+        return true;
+    return (errno != ETIMEDOUT);
+#elif defined(_WIN32) || defined(_WIN64)
+    const auto& api = Internals::GetWaitOnAddressAPI();
+    if (api.available() && !shared)
+    {
+        if (api.WaitOnAddress(&word, &expected, sizeof(uint32_t), (DWORD)std::max<int64_t>(timespan.milliseconds(), 0)))
+            return true;
+        return (GetLastError() != ERROR_TIMEOUT);
+    }
+    if (word.load(std::memory_order_acquire) != expected)
+        return true;
+    Thread::SleepFor(std::min(timespan, Timespan(Internals::FUTEX_EMULATION_INTERVAL)));
+    return (timespan.total() > Internals::FUTEX_EMULATION_INTERVAL);
+#else
+    (void)shared;
+    if (word.load(std::memory_order_acquire) != expected)
+        return true;
+    Thread::SleepFor(std::min(timespan, Timespan(Internals::FUTEX_EMULATION_INTERVAL)));
+    return (timespan.total() > Internals::FUTEX_EMULATION_INTERVAL);
+#endif
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& word, bool shared) noexcept
+{
+#if defined(__linux__)
+    Internals::FutexCall(word, FUTEX_WAKE, 1, nullptr, shared);
+#elif defined(_WIN32) || defined(_WIN64)
+    const auto& api = Internals::GetWaitOnAddressAPI();
+    if (api.available() && !shared)
+        api.WakeByAddressSingle(&word);
+#else
+    (void)word;
+    (void)shared;
+#endif
+}
+
+void Futex::Wake(std::atomic<uint32_t>& word, int count, bool shared) noexcept
+{
+    if (count <= 0)
+        return;
+
+#if defined(__linux__)
+    Internals::FutexCall(word, FUTEX_WAKE, (uint32_t)count, nullptr, shared);
+#elif defined(_WIN32) || defined(_WIN64)
+    const auto& api = Internals::GetWaitOnAddressAPI();
+    if (api.available() && !shared)
+    {
+        // WaitOnAddress() API has no bulk wake-up of the given count of threads
+        for (int i = 0; i < count; ++i)
+            api.WakeByAddressSingle(&word);
+    }
+#else
+    (void)word;
+    (void)shared;
+#endif
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& word, bool shared) noexcept
+{
+#if defined(__linux__)
+    Internals::FutexCall(word, FUTEX_WAKE, INT32_MAX, nullptr, shared);
+#elif defined(_WIN32) || defined(_WIN64)
+    const auto& api = Internals::GetWaitOnAddressAPI();
+    if (api.available() && !shared)
+        api.WakeByAddressAll(&word);
+#else
+    (void)word;
+    (void)shared;
+#endif
+}
+
+} // namespace CppCommon
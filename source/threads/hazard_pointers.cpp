@@ -0,0 +1,54 @@
+/*!
+    \file hazard_pointers.cpp
+    \brief Hazard pointers memory reclamation domain implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/hazard_pointers.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+size_t HazardPointers::Threshold() const noexcept
+{
+    // Keep the count of retired pointers proportional to the count of hazard pointers,
+    // so each scan deletes at least a half of the retire list
+    return std::max(batch(), 2 * HAZARDS * records());
+}
+
+void HazardPointers::Scan(ReclamationDomain::Record& record)
+{
+    // Paired with the fence after the hazard pointer publication
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Collect all hazard pointers
+    std::vector<void*> hazards;
+    hazards.reserve(HAZARDS * records());
+    for (auto current = first(); current != nullptr; current = current->next)
+    {
+        for (const auto& hazard : static_cast<Record*>(current)->hazards)
+        {
+            void* ptr = hazard.load(std::memory_order_acquire);
+            if (ptr != nullptr)
+                hazards.push_back(ptr);
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    // Delete all retired pointers which are not protected
+    size_t kept = 0;
+    for (size_t i = 0; i < record.retired.size(); ++i)
+    {
+        const auto& retired = record.retired[i];
+        if (std::binary_search(hazards.begin(), hazards.end(), retired.ptr))
+            record.retired[kept++] = retired;
+        else
+            retired.deleter(retired.ptr, retired.context);
+    }
+    record.retired.resize(kept);
+}
+
+} // namespace CppCommon
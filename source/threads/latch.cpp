@@ -14,75 +14,93 @@ void Latch::Reset(int threads) noexcept
 {
     assert((threads > 0) && "Latch threads counter must be greater than zero!");
 
-    std::scoped_lock lock(_mutex);
-
     // Reset the latch threads counter with a new value
-    _threads = threads;
+    _threads.store(threads, std::memory_order_release);
 }
 
-bool Latch::CountDown(std::unique_lock<std::mutex>& lock) noexcept
+bool Latch::Release() noexcept
 {
     // Count down the latch threads counter and check its value
-    if (--_threads == 0)
+    if (_threads.fetch_sub(1, std::memory_order_acq_rel) == 1)
     {
-        // Increase the current latch generation
-        ++_generation;
+        // Increase the current latch generation. Paired with the waiters registration
+        // in WaitGeneration(), so either waiters are observed here or the new generation
+        // is observed by waiters.
+        _generation.fetch_add(1, std::memory_order_seq_cst);
 
-        // Notify all waiting threads
-        _cond.notify_all();
+        // Wake up all waiting threads only if someone is blocked
+        if (_waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::WakeAll(_generation);
 
-        // Wait for the next latch generation
         return true;
     }
 
-    // Notify each of remaining threads
     return false;
 }
 
 void Latch::CountDown() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Count down the latch threads counter
-    CountDown(lock);
+    Release();
 }
 
 void Latch::CountDownAndWait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Remember the current latch generation
-    int generation = _generation;
+    uint32_t generation = _generation.load(std::memory_order_acquire);
 
     // Count down the latch threads counter
-    if (CountDown(lock))
+    if (Release())
         return;
 
     // Wait for the next latch generation
-    _cond.wait(lock, [&, this]() { return generation != _generation; });
+    WaitGeneration(generation, nullptr);
 }
 
 void Latch::Wait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
+    // Remember the current latch generation before checking the latch threads counter
+    uint32_t generation = _generation.load(std::memory_order_acquire);
 
     // Check the latch threads counter value
-    if (_threads == 0)
+    if (_threads.load(std::memory_order_acquire) == 0)
         return;
 
-    // Remember the current latch generation
-    int generation = _generation;
-
     // Wait for the next latch generation
-    _cond.wait(lock, [&, this]() { return generation != _generation; });
+    WaitGeneration(generation, nullptr);
 }
 
 bool Latch::TryWait() noexcept
 {
-    std::unique_lock<std::mutex> lock(_mutex);
-
     // Check the latch threads counter value
-    return (_threads == 0);
+    return (_threads.load(std::memory_order_acquire) == 0);
+}
+
+bool Latch::WaitGeneration(uint32_t generation, const Timespan* timespan) noexcept
+{
+    Timestamp timeout = (timespan != nullptr) ? (NanoTimestamp() + *timespan) : Timestamp();
+
+    while (_generation.load(std::memory_order_acquire) == generation)
+    {
+        // Calculate the remaining timespan to wait
+        Timespan remaining;
+        if (timespan != nullptr)
+        {
+            remaining = timeout - NanoTimestamp();
+            if (remaining.total() <= 0)
+                return (_generation.load(std::memory_order_acquire) != generation);
+        }
+
+        // Register as a waiter before blocking on the latch generation futex
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        if (timespan != nullptr)
+            Futex::WaitFor(_generation, generation, remaining);
+        else
+            Futex::Wait(_generation, generation);
+        _waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
 } // namespace CppCommon
@@ -0,0 +1,295 @@
+/*!
+    \file lock_profiler.cpp
+    \brief Lock contention profiler implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/lock_profiler.h"
+
+#include "system/stack_trace.h"
+#include "threads/spin_lock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Lock site statistics
+struct alignas(128) LockProfilerSite
+{
+    std::string name;
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> contentions{0};
+    std::atomic<uint64_t> wait_time{0};
+    std::atomic<uint64_t> max_wait_time{0};
+    std::atomic<uint64_t> holds{0};
+    std::atomic<uint64_t> hold_time{0};
+    std::atomic<uint64_t> max_hold_time{0};
+    std::atomic<uint64_t> wait_histogram[LockProfiler::HISTOGRAM_SIZE] = {};
+    std::atomic<uint64_t> hold_histogram[LockProfiler::HISTOGRAM_SIZE] = {};
+
+    // Minimal sampled wait time when all sampled waits are collected
+    std::atomic<uint64_t> threshold{0};
+    SpinLock lock;
+    std::vector<LockProfiler::Sample> samples;
+
+    explicit LockProfilerSite(const std::string& site) : name(site) {}
+};
+
+// Lock sites table. It is never destroyed to allow recording static locks during the process exit.
+struct LockProfilerSites
+{
+    SpinLock lock;
+    std::map<std::string, std::unique_ptr<LockProfilerSite>> sites;
+};
+
+std::atomic<bool> lock_profiler_enabled(false);
+std::atomic<size_t> lock_profiler_stack_traces(0);
+
+LockProfilerSites& GetLockProfilerSites()
+{
+    static LockProfilerSites* sites = new LockProfilerSites();
+    return *sites;
+}
+
+void UpdateMaximum(std::atomic<uint64_t>& maximum, uint64_t value) noexcept
+{
+    uint64_t current = maximum.load(std::memory_order_relaxed);
+    while ((value > current) && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed));
+}
+
+void SampleWait(LockProfilerSite& site, uint64_t wait, size_t count)
+{
+    try
+    {
+        // Capture the current call stack skipping profiler frames
+        std::string stack_trace = StackTrace(2).string();
+
+        Locker<SpinLock> locker(site.lock);
+
+        // Keep the slowest waits sorted from the slowest one
+        auto it = std::find_if(site.samples.begin(), site.samples.end(), [wait](const LockProfiler::Sample& sample) { return sample.wait_time < wait; });
+        site.samples.insert(it, LockProfiler::Sample{ wait, std::move(stack_trace) });
+        if (site.samples.size() > count)
+            site.samples.resize(count);
+
+        // Sample only slower waits when all sampled waits are collected
+        site.threshold.store((site.samples.size() < count) ? 0 : site.samples.back().wait_time, std::memory_order_relaxed);
+    }
+    catch (...) {}
+}
+
+LockProfiler::Statistics GetSiteStatistics(LockProfilerSite& site)
+{
+    LockProfiler::Statistics statistics = {};
+    statistics.name = site.name;
+    statistics.acquisitions = site.acquisitions.load(std::memory_order_relaxed);
+    statistics.contentions = site.contentions.load(std::memory_order_relaxed);
+    statistics.wait_time = site.wait_time.load(std::memory_order_relaxed);
+    statistics.max_wait_time = site.max_wait_time.load(std::memory_order_relaxed);
+    statistics.holds = site.holds.load(std::memory_order_relaxed);
+    statistics.hold_time = site.hold_time.load(std::memory_order_relaxed);
+    statistics.max_hold_time = site.max_hold_time.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < LockProfiler::HISTOGRAM_SIZE; ++i)
+    {
+        statistics.wait_histogram[i] = site.wait_histogram[i].load(std::memory_order_relaxed);
+        statistics.hold_histogram[i] = site.hold_histogram[i].load(std::memory_order_relaxed);
+    }
+
+    Locker<SpinLock> locker(site.lock);
+    statistics.samples = site.samples;
+    return statistics;
+}
+
+void OutputHistogram(std::ostream& os, const uint64_t (&histogram)[LockProfiler::HISTOGRAM_SIZE])
+{
+    for (size_t i = 0; i < LockProfiler::HISTOGRAM_SIZE; ++i)
+    {
+        if (histogram[i] == 0)
+            continue;
+        uint64_t from = (i == 0) ? 0 : (1ull << (i - 1));
+        uint64_t to = (i == 0) ? 0 : ((i < 64) ? ((1ull << i) - 1) : std::numeric_limits<uint64_t>::max());
+        os << '[' << std::setw(20) << from << " - " << std::setw(20) << to << "]: " << histogram[i] << std::endl;
+    }
+}
+
+} // namespace Internals
+//! @endcond
+
+std::ostream& operator<<(std::ostream& os, const LockProfiler::Statistics& statistics)
+{
+    os << "Lock: " << statistics.name << std::endl;
+    os << "Acquisitions: " << statistics.acquisitions << std::endl;
+    os << "Contentions: " << statistics.contentions << std::endl;
+    os << "Wait time (ns): " << statistics.wait_time << std::endl;
+    os << "Average wait time (ns): " << ((statistics.contentions > 0) ? (statistics.wait_time / statistics.contentions) : 0) << std::endl;
+    os << "Maximal wait time (ns): " << statistics.max_wait_time << std::endl;
+    os << "Hold time (ns): " << statistics.hold_time << std::endl;
+    os << "Average hold time (ns): " << ((statistics.holds > 0) ? (statistics.hold_time / statistics.holds) : 0) << std::endl;
+    os << "Maximal hold time (ns): " << statistics.max_hold_time << std::endl;
+    os << "Wait time histogram (ns):" << std::endl;
+    Internals::OutputHistogram(os, statistics.wait_histogram);
+    os << "Hold time histogram (ns):" << std::endl;
+    Internals::OutputHistogram(os, statistics.hold_histogram);
+    for (const auto& sample : statistics.samples)
+    {
+        os << "Slow wait (ns): " << sample.wait_time << std::endl;
+        os << sample.stack_trace;
+    }
+    return os;
+}
+
+bool LockProfiler::IsEnabled() noexcept
+{
+    return Internals::lock_profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void LockProfiler::Enable() noexcept
+{
+    Internals::lock_profiler_enabled.store(true, std::memory_order_relaxed);
+}
+
+void LockProfiler::Disable() noexcept
+{
+    Internals::lock_profiler_enabled.store(false, std::memory_order_relaxed);
+}
+
+size_t LockProfiler::GetStackTraces() noexcept
+{
+    return Internals::lock_profiler_stack_traces.load(std::memory_order_relaxed);
+}
+
+void LockProfiler::SetStackTraces(size_t count) noexcept
+{
+    Internals::lock_profiler_stack_traces.store(count, std::memory_order_relaxed);
+}
+
+Internals::LockProfilerSite& LockProfiler::Register(const std::string& name)
+{
+    auto& table = Internals::GetLockProfilerSites();
+    Locker<SpinLock> locker(table.lock);
+    auto& site = table.sites[name];
+    if (!site)
+        site = std::make_unique<Internals::LockProfilerSite>(name);
+    return *site;
+}
+
+void LockProfiler::RecordAcquire(Internals::LockProfilerSite& site, uint64_t wait, bool contended)
+{
+    site.acquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (!contended)
+        return;
+
+    // Update contended wait statistics
+    site.contentions.fetch_add(1, std::memory_order_relaxed);
+    site.wait_time.fetch_add(wait, std::memory_order_relaxed);
+    site.wait_histogram[std::bit_width(wait)].fetch_add(1, std::memory_order_relaxed);
+    Internals::UpdateMaximum(site.max_wait_time, wait);
+
+    // Sample the call stack of the slow wait
+    size_t count = Internals::lock_profiler_stack_traces.load(std::memory_order_relaxed);
+    if ((count > 0) && (wait > site.threshold.load(std::memory_order_relaxed)))
+        Internals::SampleWait(site, wait, count);
+}
+
+void LockProfiler::RecordRelease(Internals::LockProfilerSite& site, uint64_t hold) noexcept
+{
+    site.holds.fetch_add(1, std::memory_order_relaxed);
+    site.hold_time.fetch_add(hold, std::memory_order_relaxed);
+    site.hold_histogram[std::bit_width(hold)].fetch_add(1, std::memory_order_relaxed);
+    Internals::UpdateMaximum(site.max_hold_time, hold);
+}
+
+LockProfiler::Statistics LockProfiler::GetStatistics(const std::string& name)
+{
+    auto& table = Internals::GetLockProfilerSites();
+
+    Internals::LockProfilerSite* site = nullptr;
+    {
+        Locker<SpinLock> locker(table.lock);
+        auto it = table.sites.find(name);
+        if (it != table.sites.end())
+            site = it->second.get();
+    }
+
+    if (site == nullptr)
+    {
+        Statistics statistics = {};
+        statistics.name = name;
+        return statistics;
+    }
+
+    return Internals::GetSiteStatistics(*site);
+}
+
+std::vector<LockProfiler::Statistics> LockProfiler::GetStatistics()
+{
+    auto& table = Internals::GetLockProfilerSites();
+
+    // Sites are never removed, so they could be accessed without the table lock
+    std::vector<Internals::LockProfilerSite*> sites;
+    {
+        Locker<SpinLock> locker(table.lock);
+        for (auto& site : table.sites)
+            sites.push_back(site.second.get());
+    }
+
+    std::vector<Statistics> result;
+    result.reserve(sites.size());
+    for (auto site : sites)
+        result.emplace_back(Internals::GetSiteStatistics(*site));
+
+    std::stable_sort(result.begin(), result.end(), [](const Statistics& s1, const Statistics& s2) { return s1.wait_time > s2.wait_time; });
+    return result;
+}
+
+void LockProfiler::Dump(std::ostream& stream)
+{
+    for (const auto& statistics : GetStatistics())
+        stream << statistics << std::endl;
+}
+
+std::string LockProfiler::Dump()
+{
+    std::stringstream ss;
+    Dump(ss);
+    return ss.str();
+}
+
+void LockProfiler::Reset()
+{
+    auto& table = Internals::GetLockProfilerSites();
+    Locker<SpinLock> locker(table.lock);
+    for (auto& it : table.sites)
+    {
+        auto& site = *it.second;
+        site.acquisitions.store(0, std::memory_order_relaxed);
+        site.contentions.store(0, std::memory_order_relaxed);
+        site.wait_time.store(0, std::memory_order_relaxed);
+        site.max_wait_time.store(0, std::memory_order_relaxed);
+        site.holds.store(0, std::memory_order_relaxed);
+        site.hold_time.store(0, std::memory_order_relaxed);
+        site.max_hold_time.store(0, std::memory_order_relaxed);
+        for (auto& bucket : site.wait_histogram)
+            bucket.store(0, std::memory_order_relaxed);
+        for (auto& bucket : site.hold_histogram)
+            bucket.store(0, std::memory_order_relaxed);
+
+        Locker<SpinLock> site_locker(site.lock);
+        site.samples.clear();
+        site.threshold.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace CppCommon
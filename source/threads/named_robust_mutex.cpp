@@ -0,0 +1,231 @@
+/*!
+    \file named_robust_mutex.cpp
+    \brief Named robust mutex synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/named_robust_mutex.h"
+
+#include "errors/fatal.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include "system/shared_type.h"
+#include <cerrno>
+#include <pthread.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class NamedRobustMutex::Impl
+{
+public:
+    Impl(const std::string& name) : _name(name), _recovered(false)
+#if defined(__linux__)
+        , _shared(name)
+#endif
+    {
+#if defined(__linux__)
+        // Only the owner should initializate a named robust mutex
+        if (_shared.owner())
+        {
+            pthread_mutexattr_t mutex_attribute;
+            int result = pthread_mutexattr_init(&mutex_attribute);
+            if (result != 0)
+                throwex SystemException("Failed to initialize a named robust mutex attribute!", result);
+            result = pthread_mutexattr_setpshared(&mutex_attribute, PTHREAD_PROCESS_SHARED);
+            if (result != 0)
+                throwex SystemException("Failed to set a named robust mutex process shared attribute!", result);
+            result = pthread_mutexattr_setrobust(&mutex_attribute, PTHREAD_MUTEX_ROBUST);
+            if (result != 0)
+                throwex SystemException("Failed to set a named robust mutex robust attribute!", result);
+            result = pthread_mutexattr_setprotocol(&mutex_attribute, PTHREAD_PRIO_INHERIT);
+            if (result != 0)
+                throwex SystemException("Failed to set a named robust mutex priority inheritance attribute!", result);
+            result = pthread_mutexattr_settype(&mutex_attribute, PTHREAD_MUTEX_ERRORCHECK);
+            if (result != 0)
+                throwex SystemException("Failed to set a named robust mutex error check attribute!", result);
+            result = pthread_mutex_init(&_shared->mutex, &mutex_attribute);
+            if (result != 0)
+                throwex SystemException("Failed to initialize a named robust mutex!", result);
+            result = pthread_mutexattr_destroy(&mutex_attribute);
+            if (result != 0)
+                throwex SystemException("Failed to destroy a named robust mutex attribute!", result);
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        _mutex = CreateMutexA(nullptr, FALSE, name.c_str());
+        if (_mutex == nullptr)
+            throwex SystemException("Failed to create or open a named robust mutex!");
+#else
+        throwex SystemException("Named robust mutex is not supported!");
+#endif
+    }
+
+    ~Impl()
+    {
+#if defined(__linux__)
+        // Only the owner should destroy a named robust mutex
+        if (_shared.owner())
+        {
+            int result = pthread_mutex_destroy(&_shared->mutex);
+            if (result != 0)
+                fatality(SystemException("Failed to destroy a named robust mutex!", result));
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!CloseHandle(_mutex))
+            fatality(SystemException("Failed to close a named robust mutex!"));
+#endif
+    }
+
+    const std::string& name() const
+    {
+        return _name;
+    }
+
+    bool recovered() const
+    {
+        return _recovered;
+    }
+
+    bool TryLock()
+    {
+#if defined(__linux__)
+        int result = pthread_mutex_trylock(&_shared->mutex);
+        if ((result == EBUSY) || (result == EAGAIN) || (result == EDEADLK))
+            return false;
+        return Acquired(result, "Failed to try lock a named robust mutex!");
+#elif defined(_WIN32) || defined(_WIN64)
+        return Acquired(WaitForSingleObject(_mutex, 0), "Failed to try lock a named robust mutex!");
+#else
+        throwex SystemException("Named robust mutex is not supported!");
+#endif
+    }
+
+    bool TryLockFor(const Timespan& timespan)
+    {
+        if (timespan < 0)
+            return TryLock();
+#if defined(__linux__)
+        // Timed lock timeout is the absolute realtime clock timestamp
+        Timestamp finish = UtcTimestamp() + timespan;
+        struct timespec timeout;
+        timeout.tv_sec = finish.seconds();
+        timeout.tv_nsec = finish.nanoseconds() % 1000000000;
+        int result = pthread_mutex_timedlock(&_shared->mutex, &timeout);
+        if (result == ETIMEDOUT)
+            return false;
+        return Acquired(result, "Failed to try lock a named robust mutex for the given timeout!");
+#elif defined(_WIN32) || defined(_WIN64)
+        return Acquired(WaitForSingleObject(_mutex, std::max((DWORD)1, (DWORD)timespan.milliseconds())), "Failed to try lock a named robust mutex for the given timeout!");
+#else
+        throwex SystemException("Named robust mutex is not supported!");
+#endif
+    }
+
+    void Lock()
+    {
+#if defined(__linux__)
+        Acquired(pthread_mutex_lock(&_shared->mutex), "Failed to lock a named robust mutex!");
+#elif defined(_WIN32) || defined(_WIN64)
+        Acquired(WaitForSingleObject(_mutex, INFINITE), "Failed to lock a named robust mutex!");
+#else
+        throwex SystemException("Named robust mutex is not supported!");
+#endif
+    }
+
+    void Unlock()
+    {
+#if defined(__linux__)
+        int result = pthread_mutex_unlock(&_shared->mutex);
+        if (result != 0)
+            throwex SystemException("Failed to unlock a named robust mutex!", result);
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!ReleaseMutex(_mutex))
+            throwex SystemException("Failed to unlock a named robust mutex!");
+#else
+        throwex SystemException("Named robust mutex is not supported!");
+#endif
+    }
+
+private:
+    std::string _name;
+    bool _recovered;
+#if defined(__linux__)
+    // Shared robust mutex structure
+    struct MutexHeader
+    {
+        pthread_mutex_t mutex;
+    };
+
+    // Shared robust mutex structure wrapper
+    SharedType<MutexHeader> _shared;
+
+    bool Acquired(int result, const char* message)
+    {
+        _recovered = (result == EOWNERDEAD);
+        if (_recovered)
+        {
+            // The previous owner died while holding the mutex, so mark the mutex as consistent again
+            result = pthread_mutex_consistent(&_shared->mutex);
+            if (result != 0)
+                throwex SystemException("Failed to recover a named robust mutex!", result);
+        }
+        else if (result == EDEADLK)
+            throwex SystemException("Named robust mutex is already locked by the current thread!", result);
+        else if (result != 0)
+            throwex SystemException(message, result);
+        return true;
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _mutex;
+
+    bool Acquired(DWORD result, const char* message)
+    {
+        if ((result != WAIT_OBJECT_0) && (result != WAIT_ABANDONED) && (result != WAIT_TIMEOUT))
+            throwex SystemException(message);
+        _recovered = (result == WAIT_ABANDONED);
+        return (result != WAIT_TIMEOUT);
+    }
+#endif
+};
+
+//! @endcond
+
+NamedRobustMutex::NamedRobustMutex(const std::string& name)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "NamedRobustMutex::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "NamedRobustMutex::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(name);
+}
+
+NamedRobustMutex::~NamedRobustMutex()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+const std::string& NamedRobustMutex::name() const { return impl().name(); }
+
+bool NamedRobustMutex::recovered() const { return impl().recovered(); }
+
+bool NamedRobustMutex::TryLock() { return impl().TryLock(); }
+bool NamedRobustMutex::TryLockFor(const Timespan& timespan) { return impl().TryLockFor(timespan); }
+
+void NamedRobustMutex::Lock() { impl().Lock(); }
+void NamedRobustMutex::Unlock() { impl().Unlock(); }
+
+} // namespace CppCommon
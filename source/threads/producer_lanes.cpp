@@ -0,0 +1,189 @@
+/*!
+    \file producer_lanes.cpp
+    \brief Producer lanes registry implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/producer_lanes.h"
+
+#include "threads/critical_section.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <unordered_map>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Unique identifiers of producer lanes registries (never reused, so cached lanes are never confused)
+std::atomic<uint64_t> producer_lanes_id(1);
+
+// Registry of alive producer lanes registries
+CriticalSection& ProducerLanesLock()
+{
+    static CriticalSection lock;
+    return lock;
+}
+
+std::unordered_map<uint64_t, ProducerLanes*>& ProducerLanesRegistry()
+{
+    static std::unordered_map<uint64_t, ProducerLanes*> registry;
+    return registry;
+}
+
+// Registered lanes of the current thread (keyed by the full registry identifier, so a thread never changes its lane)
+struct ProducerLanesThread
+{
+    struct Entry
+    {
+        uint64_t id;
+        size_t lane;
+    };
+
+    std::vector<Entry> entries;
+
+    ~ProducerLanesThread()
+    {
+        if (entries.empty())
+            return;
+
+        Locker<CriticalSection> locker(ProducerLanesLock());
+
+        // Return lanes to alive registries, so they could be taken by new producers
+        auto& registry = ProducerLanesRegistry();
+        for (const auto& entry : entries)
+        {
+            auto it = registry.find(entry.id);
+            if (it != registry.end())
+                it->second->Unregister(entry.lane);
+        }
+    }
+};
+
+thread_local ProducerLanesThread producer_lanes_thread;
+
+// Thread local cache of registered lanes (direct mapped by registry identifier)
+const size_t PRODUCER_LANES_CACHE_SIZE = 16;
+
+struct ProducerLanesCacheEntry
+{
+    uint64_t id;
+    size_t lane;
+};
+
+thread_local ProducerLanesCacheEntry producer_lanes_cache[PRODUCER_LANES_CACHE_SIZE] = {};
+
+} // namespace Internals
+//! @endcond
+
+ProducerLanes::ProducerLanes(size_t lanes)
+    : _id(Internals::producer_lanes_id.fetch_add(1, std::memory_order_relaxed)),
+      _lanes(lanes),
+      _words((lanes + 63) / 64),
+      _bitmap(new std::atomic<uint64_t>[(lanes + 63) / 64]),
+      _assigned(lanes, 0),
+      _cursor(0),
+      _registered(0)
+{
+    assert((lanes > 0) && "Count of lanes must be greater than zero!");
+
+    for (size_t i = 0; i < _words; ++i)
+        _bitmap[i].store(0, std::memory_order_relaxed);
+
+    Locker<CriticalSection> locker(Internals::ProducerLanesLock());
+    Internals::ProducerLanesRegistry().emplace(_id, this);
+}
+
+ProducerLanes::~ProducerLanes()
+{
+    Locker<CriticalSection> locker(Internals::ProducerLanesLock());
+    Internals::ProducerLanesRegistry().erase(_id);
+}
+
+size_t ProducerLanes::Lane()
+{
+    auto& entry = Internals::producer_lanes_cache[_id % Internals::PRODUCER_LANES_CACHE_SIZE];
+    if (entry.id != _id)
+    {
+        // Cache miss could be an eviction by another registry, so look for the registered lane first
+        size_t lane = _lanes;
+        for (const auto& registered : Internals::producer_lanes_thread.entries)
+        {
+            if (registered.id == _id)
+            {
+                lane = registered.lane;
+                break;
+            }
+        }
+
+        // Register the current thread as a new producer
+        if (lane == _lanes)
+            lane = Register();
+
+        entry.lane = lane;
+        entry.id = _id;
+    }
+    return entry.lane;
+}
+
+size_t ProducerLanes::Register()
+{
+    auto& thread = Internals::producer_lanes_thread;
+
+    Locker<CriticalSection> locker(Internals::ProducerLanesLock());
+
+    // Forget lanes of destroyed registries
+    auto& registry = Internals::ProducerLanesRegistry();
+    thread.entries.erase(std::remove_if(thread.entries.begin(), thread.entries.end(), [&registry](const Internals::ProducerLanesThread::Entry& entry) { return registry.find(entry.id) == registry.end(); }), thread.entries.end());
+
+    // Take the least loaded lane, so live producers share lanes only when there are more of them than lanes.
+    // Equally loaded lanes are taken in round-robin order to spread items of exited producers among lanes.
+    size_t lane = _cursor;
+    for (size_t i = 1; i < _lanes; ++i)
+    {
+        size_t current = (_cursor + i) % _lanes;
+        if (_assigned[current] < _assigned[lane])
+            lane = current;
+    }
+    _cursor = (lane + 1) % _lanes;
+    ++_assigned[lane];
+    _registered.fetch_add(1, std::memory_order_relaxed);
+
+    thread.entries.push_back({ _id, lane });
+    return lane;
+}
+
+void ProducerLanes::Unregister(size_t lane) noexcept
+{
+    --_assigned[lane];
+    _registered.fetch_sub(1, std::memory_order_relaxed);
+}
+
+size_t ProducerLanes::Next(size_t start) const noexcept
+{
+    size_t index = start >> 6;
+    uint64_t word = _bitmap[index].load(std::memory_order_acquire) & (~(uint64_t)0 << (start & 63));
+
+    // Scan all words once and the start word twice to cover lanes before the start one
+    for (size_t i = 0; i <= _words; ++i)
+    {
+        if (word != 0)
+        {
+            size_t lane = (index << 6) + (size_t)std::countr_zero(word);
+            if (lane < _lanes)
+                return lane;
+        }
+
+        index = (index + 1) % _words;
+        word = _bitmap[index].load(std::memory_order_acquire);
+    }
+
+    return _lanes;
+}
+
+} // namespace CppCommon
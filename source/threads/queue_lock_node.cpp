@@ -0,0 +1,111 @@
+/*!
+    \file queue_lock_node.cpp
+    \brief Queue lock node implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/queue_lock_node.h"
+
+#include "threads/spin_lock.h"
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+namespace {
+
+// Global pool of nodes released by exited threads
+class QueueLockNodePool
+{
+public:
+    QueueLockNodePool() : _free(nullptr) {}
+
+    QueueLockNode* Pop()
+    {
+        Locker<SpinLock> locker(_lock);
+        QueueLockNode* node = _free;
+        if (node != nullptr)
+            _free = node->free;
+        return node;
+    }
+
+    void Push(QueueLockNode* first, QueueLockNode* last)
+    {
+        Locker<SpinLock> locker(_lock);
+        last->free = _free;
+        _free = first;
+    }
+
+private:
+    SpinLock _lock;
+    QueueLockNode* _free;
+};
+
+QueueLockNodePool& GlobalPool()
+{
+    // Nodes are never freed, so the pool is never destroyed
+    static QueueLockNodePool* pool = new QueueLockNodePool();
+    return *pool;
+}
+
+// Free nodes of the current thread
+class QueueLockNodeCache
+{
+public:
+    QueueLockNodeCache() : _free(nullptr) {}
+    ~QueueLockNodeCache()
+    {
+        // Return all cached nodes to the global pool
+        if (_free != nullptr)
+        {
+            QueueLockNode* last = _free;
+            while (last->free != nullptr)
+                last = last->free;
+            GlobalPool().Push(_free, last);
+        }
+    }
+
+    QueueLockNode* Pop()
+    {
+        QueueLockNode* node = _free;
+        if (node != nullptr)
+        {
+            _free = node->free;
+            return node;
+        }
+
+        node = GlobalPool().Pop();
+        return (node != nullptr) ? node : new QueueLockNode();
+    }
+
+    void Push(QueueLockNode* node) noexcept
+    {
+        node->free = _free;
+        _free = node;
+    }
+
+private:
+    QueueLockNode* _free;
+};
+
+thread_local QueueLockNodeCache cache;
+
+} // namespace
+
+QueueLockNode* QueueLockNode::Acquire()
+{
+    return cache.Pop();
+}
+
+void QueueLockNode::Release(QueueLockNode* node) noexcept
+{
+    cache.Push(node);
+}
+
+} // namespace Internals
+//! @endcond
+
+} // namespace CppCommon
@@ -0,0 +1,94 @@
+/*!
+    \file quiescent_reclamation.cpp
+    \brief Quiescent state based memory reclamation domain implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/quiescent_reclamation.h"
+
+#include <limits>
+
+namespace CppCommon {
+
+void QuiescentReclamation::Online()
+{
+    Announce(static_cast<Record&>(Acquire()));
+}
+
+void QuiescentReclamation::Offline()
+{
+    static_cast<Record&>(Acquire()).epoch.store(0, std::memory_order_release);
+}
+
+void QuiescentReclamation::Quiescent()
+{
+    Announce(static_cast<Record&>(Acquire()));
+}
+
+void QuiescentReclamation::Reclaim()
+{
+    Record& record = static_cast<Record&>(Acquire());
+    bool online = (record.epoch.load(std::memory_order_relaxed) != 0);
+    Stamp(record);
+    if (online)
+        Announce(record);
+    Collect(record);
+}
+
+void QuiescentReclamation::Scan(ReclamationDomain::Record& record)
+{
+    Stamp(record);
+    Collect(record);
+}
+
+void QuiescentReclamation::Announce(Record& record)
+{
+    bool offline = (record.epoch.load(std::memory_order_relaxed) == 0);
+
+    record.epoch.store(_epoch.load(std::memory_order_acquire), std::memory_order_release);
+
+    // Going online is paired with the fence before the records scan
+    if (offline)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void QuiescentReclamation::Stamp(ReclamationDomain::Record& record)
+{
+    // Read-modify-write operation heads the release sequence of the global epoch,
+    // so threads which announce any later epoch also observe all unlinked pointers
+    uint64_t epoch = _epoch.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    for (auto it = record.retired.rbegin(); (it != record.retired.rend()) && (it->epoch == 0); ++it)
+        it->epoch = epoch;
+}
+
+void QuiescentReclamation::Collect(ReclamationDomain::Record& record)
+{
+    // Paired with the fence after going online
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Find the minimal epoch announced by online threads
+    uint64_t minimal = std::numeric_limits<uint64_t>::max();
+    for (auto current = first(); current != nullptr; current = current->next)
+    {
+        uint64_t announced = static_cast<Record*>(current)->epoch.load(std::memory_order_acquire);
+        if ((announced != 0) && (announced < minimal))
+            minimal = announced;
+    }
+
+    // Delete all retired pointers which are passed by all online threads
+    size_t kept = 0;
+    for (size_t i = 0; i < record.retired.size(); ++i)
+    {
+        const auto& retired = record.retired[i];
+        if ((retired.epoch == 0) || (retired.epoch > minimal))
+            record.retired[kept++] = retired;
+        else
+            retired.deleter(retired.ptr, retired.context);
+    }
+    record.retired.resize(kept);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,153 @@
+/*!
+    \file reclamation_domain.cpp
+    \brief Memory reclamation domain implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/reclamation_domain.h"
+
+#include "threads/critical_section.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Unique identifiers of reclamation domains (never reused, so records of destroyed domains are never confused)
+std::atomic<uint64_t> reclamation_domain_id(1);
+
+// Registry of alive reclamation domains
+CriticalSection& ReclamationDomainLock()
+{
+    static CriticalSection lock;
+    return lock;
+}
+
+std::unordered_set<uint64_t>& ReclamationDomainRegistry()
+{
+    static std::unordered_set<uint64_t> registry;
+    return registry;
+}
+
+// Reclamation records of the current thread
+struct ReclamationDomainThread
+{
+    struct Entry
+    {
+        uint64_t id;
+        ReclamationDomain::Record* record;
+    };
+
+    std::vector<Entry> entries;
+
+    ~ReclamationDomainThread()
+    {
+        if (entries.empty())
+            return;
+
+        Locker<CriticalSection> locker(ReclamationDomainLock());
+
+        // Release records of alive domains, so they could be reused by other threads
+        auto& registry = ReclamationDomainRegistry();
+        for (auto& entry : entries)
+        {
+            if (registry.find(entry.id) == registry.end())
+                continue;
+
+            entry.record->Release();
+            entry.record->active.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ReclamationDomainThread reclamation_domain_thread;
+
+} // namespace Internals
+//! @endcond
+
+ReclamationDomain::ReclamationDomain(size_t batch)
+    : _id(Internals::reclamation_domain_id.fetch_add(1, std::memory_order_relaxed)),
+      _batch(batch),
+      _records(nullptr),
+      _records_count(0)
+{
+    Locker<CriticalSection> locker(Internals::ReclamationDomainLock());
+    Internals::ReclamationDomainRegistry().insert(_id);
+}
+
+ReclamationDomain::~ReclamationDomain()
+{
+    {
+        Locker<CriticalSection> locker(Internals::ReclamationDomainLock());
+        Internals::ReclamationDomainRegistry().erase(_id);
+    }
+
+    // Delete all retired pointers and records
+    Record* record = _records.load(std::memory_order_acquire);
+    while (record != nullptr)
+    {
+        for (auto& retired : record->retired)
+            retired.deleter(retired.ptr, retired.context);
+
+        Record* next = record->next;
+        delete record;
+        record = next;
+    }
+}
+
+ReclamationDomain::Record& ReclamationDomain::Acquire()
+{
+    auto& thread = Internals::reclamation_domain_thread;
+
+    // Fast path: the current thread already has the record
+    for (const auto& entry : thread.entries)
+        if (entry.id == _id)
+            return *entry.record;
+
+    // Forget records of destroyed domains
+    {
+        Locker<CriticalSection> locker(Internals::ReclamationDomainLock());
+        auto& registry = Internals::ReclamationDomainRegistry();
+        thread.entries.erase(std::remove_if(thread.entries.begin(), thread.entries.end(), [&registry](const Internals::ReclamationDomainThread::Entry& entry) { return registry.find(entry.id) == registry.end(); }), thread.entries.end());
+    }
+
+    // Try to reuse the record released by the finished thread
+    Record* record = nullptr;
+    for (Record* current = first(); current != nullptr; current = current->next)
+    {
+        bool expected = false;
+        if (!current->active.load(std::memory_order_relaxed) && current->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            record = current;
+            break;
+        }
+    }
+
+    // Create a new record
+    if (record == nullptr)
+    {
+        record = Create();
+        record->next = _records.load(std::memory_order_relaxed);
+        while (!_records.compare_exchange_weak(record->next, record, std::memory_order_acq_rel, std::memory_order_relaxed)) {}
+        _records_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    thread.entries.push_back({ _id, record });
+    return *record;
+}
+
+void ReclamationDomain::Retire(Record& record, void* ptr, Deleter deleter, void* context)
+{
+    record.retired.push_back({ ptr, deleter, context, 0 });
+
+    // Scan only when enough pointers are retired to amortize the cost of the scan
+    if (record.retired.size() >= Threshold())
+        Scan(record);
+}
+
+} // namespace CppCommon
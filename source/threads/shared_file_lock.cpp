@@ -0,0 +1,481 @@
+/*!
+    \file shared_file_lock.cpp
+    \brief Shared memory file-lock synchronization primitive implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_file_lock.h"
+
+#include "errors/fatal.h"
+#include "threads/thread.h"
+#include "utility/validate_aligned_storage.h"
+
+#if defined(__linux__)
+#include "threads/futex.h"
+#include "utility/cache_line.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include "threads/file_lock.h"
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+#if defined(__linux__)
+
+// In case we are on a system with glibc version earlier than 2.20
+#ifndef F_OFD_GETLK
+#define F_OFD_GETLK  36
+#define F_OFD_SETLK  37
+#define F_OFD_SETLKW 38
+#endif
+
+namespace Internals {
+
+// Shared memory file-lock header
+struct SharedFileLockHeader
+{
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> writer;  // Writer slot index + 1 or zero
+    std::atomic<uint32_t> waiters;                          // Count of threads parked on the writer word
+    std::atomic<uint32_t> slots;                            // Count of ever used slots
+};
+
+// Shared memory file-lock slot of the file-lock instance
+struct SharedFileLockSlot
+{
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> readers; // Count of read locks of the file-lock instance
+};
+
+// Shared memory file-lock state (zero-filled shared memory file is the valid unlocked state)
+struct SharedFileLockState
+{
+    SharedFileLockHeader header;
+    SharedFileLockSlot slots[SharedFileLock::MAX_SLOTS];
+};
+
+} // namespace Internals
+
+class SharedFileLock::Impl
+{
+public:
+    Impl() : _file(-1), _shared(-1), _state(nullptr), _slot(-1) {}
+
+    ~Impl()
+    {
+        try
+        {
+            Reset();
+        }
+        catch (const SystemException& ex)
+        {
+            fatality(SystemException(ex.string()));
+        }
+    }
+
+    const Path& path() const noexcept { return _path; }
+
+    void Assign(const Path& path)
+    {
+        // Reset the previous file-lock
+        Reset();
+
+        _path = path;
+
+        // Open the lock file and claim a free slot guarded by the byte-range lock
+        const int attempts = 1000;
+        for (int attempt = 0; ; ++attempt)
+        {
+            _file = open(_path.string().c_str(), O_CREAT | O_RDWR, 0644);
+            if (_file < 0)
+                throwex FileSystemException("Cannot create or open file-lock file!").Attach(_path);
+
+            for (int slot = 0; slot < MAX_SLOTS; ++slot)
+            {
+                if (SetLock(F_WRLCK, slot, 1))
+                {
+                    _slot = slot;
+                    break;
+                }
+            }
+
+            // Check the lock file was not removed by the last file-lock instance meanwhile
+            if ((_slot >= 0) && IsLinked())
+                break;
+
+            close(_file);
+            _file = -1;
+            _slot = -1;
+
+            if (attempt >= attempts)
+                throwex FileSystemException("Cannot claim a free slot of the shared memory file-lock!").Attach(_path);
+
+            Thread::Yield();
+        }
+
+        // Open and map the shared memory file
+        Path shared = _path + ".shm";
+        _shared = open(shared.string().c_str(), O_CREAT | O_RDWR, 0644);
+        if (_shared < 0)
+            throwex FileSystemException("Cannot create or open file-lock shared memory file!").Attach(shared);
+        struct stat status;
+        if (fstat(_shared, &status) != 0)
+            throwex FileSystemException("Cannot get the status of the file-lock shared memory file!").Attach(shared);
+        if ((status.st_size < (off_t)sizeof(Internals::SharedFileLockState)) && (ftruncate(_shared, sizeof(Internals::SharedFileLockState)) != 0))
+            throwex FileSystemException("Cannot resize the file-lock shared memory file!").Attach(shared);
+        void* address = mmap(nullptr, sizeof(Internals::SharedFileLockState), PROT_READ | PROT_WRITE, MAP_SHARED, _shared, 0);
+        if (address == MAP_FAILED)
+            throwex FileSystemException("Cannot map the file-lock shared memory file!").Attach(shared);
+        _state = (Internals::SharedFileLockState*)address;
+
+        // Recover locks of the dead file-lock instance which owned the claimed slot
+        RecoverSlot(_slot);
+
+        // Publish the claimed slot for writers
+        uint32_t slots = _state->header.slots.load(std::memory_order_relaxed);
+        while ((slots < (uint32_t)(_slot + 1)) && !_state->header.slots.compare_exchange_weak(slots, _slot + 1, std::memory_order_seq_cst, std::memory_order_relaxed));
+    }
+
+    void Reset()
+    {
+        if (_file < 0)
+            return;
+
+        if (_state != nullptr)
+        {
+            if (munmap(_state, sizeof(Internals::SharedFileLockState)) != 0)
+                fatality(FileSystemException("Cannot unmap the file-lock shared memory file!").Attach(_path));
+            _state = nullptr;
+        }
+        if (_shared >= 0)
+        {
+            if (close(_shared) != 0)
+                fatality(FileSystemException("Cannot close the file-lock shared memory descriptor!").Attach(_path));
+            _shared = -1;
+        }
+
+        // Release the slot and remove lock files if there are no other file-lock instances
+        SetLock(F_UNLCK, _slot, 1);
+        if (SetLock(F_WRLCK, 0, MAX_SLOTS))
+        {
+            unlink((_path + ".shm").string().c_str());
+            unlink(_path.string().c_str());
+        }
+        _slot = -1;
+
+        if (close(_file) != 0)
+            fatality(FileSystemException("Cannot close the file-lock descriptor!").Attach(_path));
+        _file = -1;
+    }
+
+    bool TryLockRead()
+    {
+        auto& readers = _state->slots[_slot].readers;
+
+        // Register the reader before checking for the writer. Paired with the writer
+        // word exchange in TryAcquireWriter(), so either the reader observes the writer
+        // or the writer observes the reader.
+        readers.fetch_add(1, std::memory_order_seq_cst);
+        if (_state->header.writer.load(std::memory_order_seq_cst) == 0)
+            return true;
+
+        UnlockRead();
+        return false;
+    }
+
+    bool TryLockWrite()
+    {
+        if (!TryAcquireWriter())
+            return false;
+
+        // Check for active readers
+        uint32_t slots = _state->header.slots.load(std::memory_order_seq_cst);
+        for (uint32_t slot = 0; slot < slots; ++slot)
+        {
+            if (_state->slots[slot].readers.load(std::memory_order_seq_cst) != 0)
+            {
+                UnlockWrite();
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool LockRead(const Timestamp* finish)
+    {
+        for (;;)
+        {
+            if (TryLockRead())
+                return true;
+
+            // Park while the writer holds the lock
+            uint32_t writer = _state->header.writer.load(std::memory_order_acquire);
+            if ((writer != 0) && !ParkWriter(writer, finish))
+                return false;
+        }
+    }
+
+    bool LockWrite(const Timestamp* finish)
+    {
+        // Park while another writer holds the lock
+        while (!TryAcquireWriter())
+        {
+            uint32_t writer = _state->header.writer.load(std::memory_order_acquire);
+            if ((writer != 0) && !ParkWriter(writer, finish))
+                return false;
+        }
+
+        // Wait for active readers to release the lock
+        uint32_t slots = _state->header.slots.load(std::memory_order_seq_cst);
+        for (uint32_t slot = 0; slot < slots; ++slot)
+        {
+            auto& readers = _state->slots[slot].readers;
+
+            uint32_t count;
+            while ((count = readers.load(std::memory_order_seq_cst)) != 0)
+            {
+                Timespan timeout;
+                if (!Timeout(finish, timeout))
+                {
+                    UnlockWrite();
+                    return false;
+                }
+                if (!Futex::WaitFor(readers, count, timeout, true))
+                    Recover();
+            }
+        }
+
+        return true;
+    }
+
+    void UnlockRead()
+    {
+        // Wake the pending writer only by the last reader of the slot
+        auto& readers = _state->slots[_slot].readers;
+        if ((readers.fetch_sub(1, std::memory_order_seq_cst) == 1) && (_state->header.writer.load(std::memory_order_seq_cst) != 0))
+            Futex::WakeAll(readers, true);
+    }
+
+    void UnlockWrite()
+    {
+        // Wake parked threads only if there are any
+        _state->header.writer.store(0, std::memory_order_seq_cst);
+        if (_state->header.waiters.load(std::memory_order_seq_cst) > 0)
+            Futex::WakeAll(_state->header.writer, true);
+    }
+
+private:
+    Path _path;
+    int _file;
+    int _shared;
+    Internals::SharedFileLockState* _state;
+    int _slot;
+
+    bool SetLock(short type, off_t start, off_t length)
+    {
+        struct flock lock;
+        lock.l_type = type;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = start;
+        lock.l_len = length;
+        lock.l_pid = 0;
+        if (fcntl(_file, F_OFD_SETLK, &lock) == 0)
+            return true;
+        if ((errno == EAGAIN) || (errno == EACCES))
+            return false;
+        throwex FileSystemException("Failed to set the file-lock slot byte-range lock!").Attach(_path);
+    }
+
+    bool IsLinked()
+    {
+        struct stat opened;
+        struct stat linked;
+        if ((fstat(_file, &opened) != 0) || (stat(_path.string().c_str(), &linked) != 0))
+            return false;
+        return (opened.st_dev == linked.st_dev) && (opened.st_ino == linked.st_ino);
+    }
+
+    bool TryAcquireWriter()
+    {
+        uint32_t writer = 0;
+        return _state->header.writer.compare_exchange_strong(writer, _slot + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    bool Timeout(const Timestamp* finish, Timespan& timeout)
+    {
+        // Wake up at least once per recovery interval to check for dead lock holders
+        timeout = Timespan::milliseconds(RECOVERY_INTERVAL);
+        if (finish == nullptr)
+            return true;
+
+        Timestamp now = NanoTimestamp();
+        if (now >= *finish)
+            return false;
+
+        timeout = std::min(timeout, *finish - now);
+        return true;
+    }
+
+    bool ParkWriter(uint32_t writer, const Timestamp* finish)
+    {
+        Timespan timeout;
+        if (!Timeout(finish, timeout))
+            return false;
+
+        // Register as a waiter before parking. Paired with UnlockWrite(), so either
+        // the writer observes the waiter or the waiter observes the released lock.
+        _state->header.waiters.fetch_add(1, std::memory_order_seq_cst);
+        bool woken = Futex::WaitFor(_state->header.writer, writer, timeout, true);
+        _state->header.waiters.fetch_sub(1, std::memory_order_relaxed);
+
+        if (!woken)
+            Recover();
+        return true;
+    }
+
+    void RecoverSlot(int slot)
+    {
+        // Release read and write locks of the slot
+        bool recovered = (_state->slots[slot].readers.exchange(0, std::memory_order_seq_cst) != 0);
+        uint32_t writer = slot + 1;
+        recovered |= _state->header.writer.compare_exchange_strong(writer, 0, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+        // Wake all threads parked on the recovered slot
+        if (recovered)
+        {
+            Futex::WakeAll(_state->slots[slot].readers, true);
+            Futex::WakeAll(_state->header.writer, true);
+        }
+    }
+
+    void Recover()
+    {
+        uint32_t slots = _state->header.slots.load(std::memory_order_acquire);
+        for (uint32_t slot = 0; slot < slots; ++slot)
+        {
+            if (slot == (uint32_t)_slot)
+                continue;
+
+            // Check only slots holding locks
+            if ((_state->slots[slot].readers.load(std::memory_order_acquire) == 0) && (_state->header.writer.load(std::memory_order_acquire) != (slot + 1)))
+                continue;
+
+            // Byte-range lock of the slot is free only if its file-lock instance is dead
+            if (SetLock(F_WRLCK, slot, 1))
+            {
+                RecoverSlot(slot);
+                SetLock(F_UNLCK, slot, 1);
+            }
+        }
+    }
+};
+
+#else
+
+class SharedFileLock::Impl
+{
+public:
+    const Path& path() const noexcept { return _lock.path(); }
+
+    void Assign(const Path& path) { _lock.Assign(path); }
+    void Reset() { _lock.Reset(); }
+
+    bool TryLockRead() { return _lock.TryLockRead(); }
+    bool TryLockWrite() { return _lock.TryLockWrite(); }
+
+    bool LockRead(const Timestamp* finish)
+    {
+        if (finish == nullptr)
+        {
+            _lock.LockRead();
+            return true;
+        }
+        return _lock.TryLockReadFor(*finish - NanoTimestamp());
+    }
+
+    bool LockWrite(const Timestamp* finish)
+    {
+        if (finish == nullptr)
+        {
+            _lock.LockWrite();
+            return true;
+        }
+        return _lock.TryLockWriteFor(*finish - NanoTimestamp());
+    }
+
+    void UnlockRead() { _lock.UnlockRead(); }
+    void UnlockWrite() { _lock.UnlockWrite(); }
+
+private:
+    FileLock _lock;
+};
+
+#endif
+
+//! @endcond
+
+SharedFileLock::SharedFileLock()
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "SharedFileLock::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "SharedFileLock::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl();
+}
+
+SharedFileLock::SharedFileLock(const Path& path) : SharedFileLock()
+{
+    Assign(path);
+}
+
+SharedFileLock::~SharedFileLock()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+SharedFileLock& SharedFileLock::operator=(const Path& path)
+{
+    Assign(path);
+    return *this;
+}
+
+const Path& SharedFileLock::path() const noexcept { return impl().path(); }
+
+void SharedFileLock::Assign(const Path& path) { impl().Assign(path); }
+void SharedFileLock::Reset() { impl().Reset(); }
+
+bool SharedFileLock::TryLockRead() { return impl().TryLockRead(); }
+bool SharedFileLock::TryLockWrite() { return impl().TryLockWrite(); }
+
+bool SharedFileLock::TryLockReadFor(const Timespan& timespan)
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+    return impl().LockRead(&finish);
+}
+
+bool SharedFileLock::TryLockWriteFor(const Timespan& timespan)
+{
+    // Calculate a finish timestamp
+    Timestamp finish = NanoTimestamp() + timespan;
+    return impl().LockWrite(&finish);
+}
+
+void SharedFileLock::LockRead() { impl().LockRead(nullptr); }
+void SharedFileLock::LockWrite() { impl().LockWrite(nullptr); }
+void SharedFileLock::UnlockRead() { impl().UnlockRead(); }
+void SharedFileLock::UnlockWrite() { impl().UnlockWrite(); }
+
+} // namespace CppCommon
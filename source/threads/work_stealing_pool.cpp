@@ -0,0 +1,281 @@
+/*!
+    \file work_stealing_pool.cpp
+    \brief Work-stealing thread pool implementation
+    \author Ivan Shynkarenka
+    \date 19.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/work_stealing_pool.h"
+
+#include "system/cpu.h"
+#include "threads/thread.h"
+
+#include <cassert>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Count of unsuccessful jobs searches before parking the idle worker
+const size_t WORK_STEALING_SPIN = 64;
+
+// Work-stealing pool and worker of the current thread
+thread_local const void* work_stealing_pool = nullptr;
+thread_local void* work_stealing_worker = nullptr;
+
+} // namespace Internals
+//! @endcond
+
+WorkStealingPool::WorkStealingPool(size_t workers, bool affinity, size_t tasks)
+    : _tasks(new TaskJob[tasks]),
+      _free(tasks),
+      _inject(tasks),
+      _stop(false),
+      _pending(0),
+      _waiting(0)
+{
+    assert((tasks > 1) && "Work-stealing pool tasks count must be greater than one!");
+
+    // Prepare the tasks table
+    for (size_t i = 0; i < tasks; ++i)
+    {
+        TaskJob& job = _tasks[i];
+        job.execute = [](Job* base)
+        {
+            TaskJob* self = static_cast<TaskJob*>(base);
+            WorkStealingPool* pool = self->pool;
+
+            // Tasks are executed only by workers, count them for nested waits
+            Worker* worker = pool->Current();
+            ++worker->tasks;
+            self->task();
+            --worker->tasks;
+            self->task = nullptr;
+
+            // Return the task into the tasks table
+            pool->_free.Enqueue(self->index);
+            if (pool->_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                pool->_completion.NotifyAll();
+        };
+        job.pool = this;
+        job.index = (uint32_t)i;
+        _free.Enqueue((uint32_t)i);
+    }
+
+    if (workers == 0)
+        workers = (size_t)std::max(CPU::PhysicalCores(), 1);
+
+    // Collect logical CPUs allowed for the current thread
+    std::vector<int> cpus;
+    if (affinity)
+    {
+        std::bitset<64> allowed = Thread::GetAffinity();
+        for (int i = 0; i < 64; ++i)
+            if (allowed.test(i))
+                cpus.push_back(i);
+    }
+
+    // Create workers before starting them, so thieves see all victims
+    for (size_t i = 0; i < workers; ++i)
+        _workers.emplace_back(new Worker(i));
+
+    for (auto& worker : _workers)
+    {
+        int cpu = cpus.empty() ? -1 : cpus[worker->index % cpus.size()];
+        worker->thread = Thread::Start([this, &worker = *worker, cpu]() { Loop(worker, cpu); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    Wait();
+
+    // Stop all workers
+    _stop.store(true, std::memory_order_seq_cst);
+    _idle.NotifyAll();
+
+    for (auto& worker : _workers)
+        worker->thread.join();
+}
+
+int WorkStealingPool::worker() const noexcept
+{
+    Worker* worker = Current();
+    return (worker != nullptr) ? (int)worker->index : -1;
+}
+
+void WorkStealingPool::Submit(Task task)
+{
+    Worker* worker = Current();
+
+    // Take a free slot in the tasks table
+    uint32_t index;
+    while (!_free.Dequeue(index))
+    {
+        // Worker runs the task directly, because all tasks could wait for free slots in nested submits
+        if (worker != nullptr)
+        {
+            task();
+            return;
+        }
+
+        Thread::Yield();
+    }
+
+    TaskJob& job = _tasks[index];
+    job.task = std::move(task);
+    _pending.fetch_add(1, std::memory_order_acq_rel);
+
+    Push(&job);
+}
+
+void WorkStealingPool::Wait()
+{
+    Worker* worker = Current();
+    if (worker != nullptr)
+    {
+        // Tasks on the worker stack could not complete until the wait is done, so exclude them from pending ones
+        size_t tasks = worker->tasks - worker->waiting;
+        worker->waiting += tasks;
+        _waiting.fetch_add(tasks, std::memory_order_acq_rel);
+
+        while (_pending.load(std::memory_order_acquire) > _waiting.load(std::memory_order_acquire))
+            if (!Help(*worker))
+                Thread::Yield();
+
+        _waiting.fetch_sub(tasks, std::memory_order_acq_rel);
+        worker->waiting -= tasks;
+        return;
+    }
+
+    _completion.Wait([this]() { return (_pending.load(std::memory_order_acquire) == 0); });
+}
+
+WorkStealingPool::Worker* WorkStealingPool::Current() const noexcept
+{
+    return (Internals::work_stealing_pool == this) ? (Worker*)Internals::work_stealing_worker : nullptr;
+}
+
+void WorkStealingPool::Push(Job* job)
+{
+    Worker* worker = Current();
+    if (worker != nullptr)
+        worker->deque.Push(job);
+    else
+    {
+        while (!_inject.Enqueue(job))
+            Thread::Yield();
+    }
+
+    _idle.NotifyOne();
+}
+
+WorkStealingPool::Job* WorkStealingPool::Find(Worker& worker)
+{
+    Job* job;
+
+    // Pop the most recent job of the current worker
+    if (worker.deque.Pop(job))
+        return job;
+
+    // Take the injected job
+    if (_inject.Dequeue(job))
+        return job;
+
+    // Steal the oldest job of other workers starting from the random victim
+    size_t count = _workers.size();
+    if (count > 1)
+    {
+        worker.seed ^= worker.seed << 13;
+        worker.seed ^= worker.seed >> 7;
+        worker.seed ^= worker.seed << 17;
+        size_t start = (size_t)(worker.seed % count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Worker& victim = *_workers[(start + i) % count];
+            if ((&victim != &worker) && victim.deque.Steal(job))
+                return job;
+        }
+    }
+
+    return nullptr;
+}
+
+bool WorkStealingPool::Help(Worker& worker)
+{
+    Job* job = Find(worker);
+    if (job == nullptr)
+        return false;
+
+    job->execute(job);
+    return true;
+}
+
+void WorkStealingPool::Join(const std::atomic<bool>& done)
+{
+    Worker* worker = Current();
+    if (worker != nullptr)
+    {
+        // Help to run other jobs while waiting
+        while (!done.load(std::memory_order_acquire))
+            if (!Help(*worker))
+                Thread::Yield();
+        return;
+    }
+
+    _completion.Wait([&done]() { return done.load(std::memory_order_acquire); });
+}
+
+void WorkStealingPool::Loop(Worker& worker, int cpu)
+{
+    Internals::work_stealing_pool = this;
+    Internals::work_stealing_worker = &worker;
+
+    if (cpu >= 0)
+    {
+        std::bitset<64> affinity;
+        affinity.set(cpu);
+        Thread::SetAffinity(affinity);
+    }
+
+    size_t misses = 0;
+    for (;;)
+    {
+        if (Help(worker))
+        {
+            misses = 0;
+            continue;
+        }
+
+        // Spin for a while before parking
+        if (++misses < Internals::WORK_STEALING_SPIN)
+        {
+            Thread::Yield();
+            continue;
+        }
+        misses = 0;
+
+        // Park until a new job is pushed or the pool is stopped
+        Job* job = nullptr;
+        bool stop = false;
+        _idle.Wait([this, &worker, &job, &stop]()
+        {
+            stop = _stop.load(std::memory_order_acquire);
+            if (!stop)
+                job = Find(worker);
+            return (stop || (job != nullptr));
+        });
+
+        if (stop)
+            break;
+
+        job->execute(job);
+    }
+
+    Internals::work_stealing_pool = nullptr;
+    Internals::work_stealing_worker = nullptr;
+}
+
+} // namespace CppCommon
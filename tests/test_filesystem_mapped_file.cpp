@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+TEST_CASE("Memory-mapped file", "[CppCommon][FileSystem]")
+{
+    std::string text("The quick brown fox jumps over the lazy dog");
+
+    File::WriteAllText("test.tmp", text);
+
+    // Map the whole file for reading
+    MappedFile test("test.tmp");
+    REQUIRE(!test.IsMapped());
+    test.Map();
+    REQUIRE(test.IsMapped());
+    REQUIRE(!test.IsWritable());
+    REQUIRE(test.offset() == 0);
+    REQUIRE(test.size() == text.size());
+    REQUIRE(test.file_size() == text.size());
+    REQUIRE(std::memcmp(test.data(), text.data(), text.size()) == 0);
+    test.Advise(MappedFileAdvice::SEQUENTIAL);
+    test.Prefetch();
+    REQUIRE(test.ReadAllText() == text);
+    REQUIRE(test.position() == text.size());
+
+    // Remap the unaligned window
+    test.Remap(4, 5);
+    REQUIRE(test.offset() == 4);
+    REQUIRE(test.size() == 5);
+    REQUIRE(test.position() == 0);
+    REQUIRE(std::string((const char*)test.data(), test.size()) == "quick");
+    REQUIRE_THROWS_AS(test.Remap(40, 10), FileSystemException);
+    test.Unmap();
+    REQUIRE(!test.IsMapped());
+
+    // Map the file for writing
+    test.Map(true, 0, 0, true);
+    REQUIRE(test.IsWritable());
+    std::memcpy(test.data() + 4, "QUICK", 5);
+    test.Seek(text.size() - 3);
+    REQUIRE(test.Write("DOG!", 4) == 3);
+    test.Flush();
+
+    // Grow the file and write into the new area
+    test.Resize(text.size() + 4096);
+    REQUIRE(test.size() == text.size() + 4096);
+    REQUIRE(test.file_size() == text.size() + 4096);
+    REQUIRE(test.position() == text.size());
+    REQUIRE(test.Write(std::string("!")) == 1);
+    REQUIRE(test.position() == text.size() + 1);
+    test.Flush(text.size(), 1, true);
+
+    // Shrink the file
+    test.Resize(text.size() + 1);
+    REQUIRE(test.size() == text.size() + 1);
+    REQUIRE(test.position() == text.size() + 1);
+    test.Unmap();
+
+    REQUIRE(File::ReadAllText("test.tmp") == "The QUICK brown fox jumps over the lazy DOG!");
+
+    // Map an empty window
+    MappedFile empty(std::move(test));
+    empty.Map(false, text.size() + 1);
+    REQUIRE(empty.IsMapped());
+    REQUIRE(empty.size() == 0);
+    REQUIRE(empty.data() == nullptr);
+    empty.Unmap();
+
+    File::Remove("test.tmp");
+}
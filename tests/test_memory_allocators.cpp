@@ -4,12 +4,16 @@
 
 #include "test.h"
 
+#include "containers/hashmap.h"
+#include "filesystem/file.h"
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
 #include "memory/allocator_heap.h"
 #include "memory/allocator_null.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_shared.h"
 #include "memory/allocator_stack.h"
+#include "memory/allocator_trace.h"
 
 #include <list>
 #include <map>
@@ -442,3 +446,188 @@ TEST_CASE("Pool allocator with stl associative containers", "[CppCommon][Memory]
     u[2] = 20;
     u.clear();
 }
+
+TEST_CASE("Offset pointer", "[CppCommon][Memory]")
+{
+    int buffer[4] = { 0, 1, 2, 3 };
+
+    OffsetPtr<int> ptr;
+    REQUIRE(!ptr);
+    REQUIRE(ptr == nullptr);
+    ptr = buffer;
+    REQUIRE(ptr);
+    REQUIRE(*ptr == 0);
+    REQUIRE(ptr[3] == 3);
+    REQUIRE(*(ptr + 2) == 2);
+    REQUIRE(*++ptr == 1);
+    REQUIRE(((buffer + 4) - ptr.get()) == 3);
+
+    // Copy must keep the pointed address
+    OffsetPtr<const int> copy(ptr);
+    REQUIRE(copy.get() == &buffer[1]);
+    REQUIRE(copy == ptr);
+
+    // Raw copy of the offset pointer bytes keeps the relative position
+    uint8_t region1[sizeof(OffsetPtr<int>) + sizeof(int)];
+    uint8_t region2[sizeof(OffsetPtr<int>) + sizeof(int)];
+    OffsetPtr<int>* relative = new (region1) OffsetPtr<int>((int*)(region1 + sizeof(OffsetPtr<int>)));
+    **relative = 123;
+    std::memcpy(region2, region1, sizeof(region1));
+    REQUIRE(((OffsetPtr<int>*)region2)->get() == (int*)(region2 + sizeof(OffsetPtr<int>)));
+    REQUIRE(**(OffsetPtr<int>*)region2 == 123);
+}
+
+TEST_CASE("Shared memory manager with a fixed buffer", "[CppCommon][Memory]")
+{
+    alignas(std::max_align_t) uint8_t buffer[1024];
+    SharedMemoryManager& manger = SharedMemoryManager::Create(buffer, sizeof(buffer));
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.capacity() == 1024);
+    REQUIRE(manger.root() == nullptr);
+    REQUIRE(&SharedMemoryManager::Open(buffer) == &manger);
+
+    void* ptr1 = manger.malloc(10, 1);
+    REQUIRE(ptr1 != nullptr);
+    void* ptr2 = manger.malloc(100, 64);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr2, 64));
+    void* ptr3 = manger.malloc(10, 1);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(manger.allocated() == 120);
+    REQUIRE(manger.allocations() == 3);
+    REQUIRE(manger.malloc(1024, 1) == nullptr);
+
+    // Free blocks in the mixed order to check coalescing
+    manger.free(ptr1, 10);
+    manger.free(ptr3, 10);
+    manger.free(ptr2, 100);
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+
+    // Whole free space must be available again
+    void* ptr = manger.malloc(800, 1);
+    REQUIRE(ptr != nullptr);
+    manger.SetRoot(ptr);
+    REQUIRE(manger.root() == ptr);
+    manger.free(ptr, 800);
+
+    manger.reset();
+    REQUIRE(manger.allocated() == 0);
+    REQUIRE(manger.allocations() == 0);
+    REQUIRE(manger.root() == nullptr);
+}
+
+TEST_CASE("Shared allocator with containers in a shared memory", "[CppCommon][Memory]")
+{
+    typedef SharedAllocator<std::pair<int, int>> Alloc;
+    typedef HashMap<int, int, std::hash<int>, std::equal_to<int>, Alloc> Map;
+
+    // Map the same shared memory block twice at different addresses
+    SharedMemory shared1("shared_allocator_test", 65536);
+    SharedMemory shared2("shared_allocator_test", 65536);
+    REQUIRE(shared1.owner());
+    REQUIRE(!shared2.owner());
+    REQUIRE(shared1.ptr() != shared2.ptr());
+
+    // Build the lookup table in the first mapping
+    SharedMemoryManager& manger1 = SharedMemoryManager::Attach(shared1);
+    Alloc alloc1(manger1);
+    SharedAllocator<Map> map_alloc(manger1);
+    Map* map1 = map_alloc.Create(16, -1, std::hash<int>(), std::equal_to<int>(), alloc1);
+    for (int i = 0; i < 100; ++i)
+        map1->insert(std::make_pair(i, i * 10));
+    manger1.SetRoot(map1);
+
+    std::vector<int, SharedAllocator<int>> vector1(alloc1);
+    vector1.push_back(1);
+    vector1.push_back(2);
+    vector1.push_back(3);
+
+    // Access the lookup table from the second mapping
+    SharedMemoryManager& manger2 = SharedMemoryManager::Attach(shared2);
+    REQUIRE(&manger2 != &manger1);
+    REQUIRE(manger2.allocations() == manger1.allocations());
+    Map* map2 = (Map*)manger2.root();
+    REQUIRE(map2 != nullptr);
+    REQUIRE(map2 != map1);
+    REQUIRE(map2->size() == 100);
+    for (int i = 0; i < 100; ++i)
+        REQUIRE(map2->at(i) == i * 10);
+    REQUIRE(map2->find(100) == map2->end());
+
+    // Modify the lookup table from the second mapping
+    (*map2)[100] = 1000;
+    REQUIRE(map1->at(100) == 1000);
+
+    vector1.clear();
+    vector1.shrink_to_fit();
+    map_alloc.Release(map1);
+    REQUIRE(manger1.allocated() == 0);
+    REQUIRE(manger1.allocations() == 0);
+}
+
+TEST_CASE("Trace memory manager", "[CppCommon][Memory]")
+{
+    MemoryTrace trace;
+    DefaultMemoryManager auxiliary;
+    TraceMemoryManager<DefaultMemoryManager> manager(auxiliary, trace);
+
+    // Record the memory allocation trace
+    {
+        TraceAllocator<int> alloc(manager);
+
+        std::list<int, TraceAllocator<int>> list(alloc);
+        for (int i = 0; i < 100; ++i)
+            list.push_back(i);
+        for (int i = 0; i < 50; ++i)
+            list.pop_front();
+
+        std::vector<int, TraceAllocator<int>> vector(alloc);
+        vector.reserve(10);
+        REQUIRE(manager.allocations() == 51);
+    }
+    REQUIRE(manager.allocated() == 0);
+    REQUIRE(manager.allocations() == 0);
+
+    REQUIRE(trace.allocations() == 101);
+    REQUIRE(trace.size() == 202);
+    REQUIRE(trace.peak_allocations() == 100);
+    REQUIRE(trace.peak() >= 100 * sizeof(int));
+
+    // Save and load the memory allocation trace
+    File file("test.tmp");
+    file.Create(false, true);
+    trace.Save(file);
+    file.Close();
+
+    MemoryTrace loaded;
+    file.Open(true, false);
+    loaded.Load(file);
+    file.Close();
+    File::Remove(file);
+
+    REQUIRE(loaded.size() == trace.size());
+    REQUIRE(loaded.allocations() == trace.allocations());
+    REQUIRE(loaded.peak() == trace.peak());
+    REQUIRE(loaded.peak_allocations() == trace.peak_allocations());
+    for (size_t i = 0; i < trace.size(); ++i)
+    {
+        REQUIRE(loaded.events()[i].allocation == trace.events()[i].allocation);
+        REQUIRE(loaded.events()[i].id == trace.events()[i].id);
+        REQUIRE(loaded.events()[i].size == trace.events()[i].size);
+        REQUIRE(loaded.events()[i].alignment == trace.events()[i].alignment);
+    }
+
+    // Replay the memory allocation trace
+    HeapMemoryManager heap;
+    size_t checkpoints = 0;
+    REQUIRE(loaded.Replay(heap, [&checkpoints]() { ++checkpoints; }, 50) == 0);
+    REQUIRE(checkpoints == 5);
+    REQUIRE(heap.allocated() == 0);
+    REQUIRE(heap.allocations() == 0);
+
+    // Replay the memory allocation trace with failed allocations
+    NullMemoryManager null;
+    REQUIRE(loaded.Replay(null) == loaded.allocations());
+}
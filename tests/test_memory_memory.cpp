@@ -6,12 +6,15 @@
 
 #include "memory/memory.h"
 
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Memory management", "[CppCommon][Memory]")
 {
     REQUIRE(Memory::RamTotal() > 0);
     REQUIRE(Memory::RamFree() > 0);
+    REQUIRE(Memory::RamProcess() > 0);
 }
 
 TEST_CASE("Memory align", "[CppCommon][Memory]")
@@ -46,3 +49,105 @@ TEST_CASE("Memory align", "[CppCommon][Memory]")
     REQUIRE(Memory::Align((void*)0x7fff5ebcf47e, 32, false) == (void*)0x7fff5ebcf460);
     REQUIRE(Memory::Align((void*)0x7fff5ebcf4af, 64, false) == (void*)0x7fff5ebcf480);
 }
+
+TEST_CASE("Memory is zero", "[CppCommon][Memory]")
+{
+    const MemoryKernel kernels[] = { MemoryKernel::SCALAR, MemoryKernel::SSE2, MemoryKernel::AVX2, MemoryKernel::AVX512 };
+
+    REQUIRE(Memory::IsKernelSupported(MemoryKernel::SCALAR));
+    REQUIRE(Memory::IsKernelSupported(Memory::Kernel()));
+
+    uint8_t buffer[1024 + 64];
+    std::memset(buffer, 0, sizeof(buffer));
+
+    for (auto kernel : kernels)
+    {
+        for (size_t offset = 0; offset < 64; offset += 7)
+        {
+            for (size_t size = 0; size <= 1024; size += ((size < 300) ? 1 : 61))
+            {
+                REQUIRE(Memory::IsZero(buffer + offset, size, kernel));
+
+                // Every single non-zero byte must be found
+                for (size_t i = 0; i < size; i += ((size < 300) ? 1 : 13))
+                {
+                    buffer[offset + i] = 0x80;
+                    REQUIRE(!Memory::IsZero(buffer + offset, size, kernel));
+                    buffer[offset + i] = 0;
+                }
+
+                // Bytes outside of the buffer must be ignored
+                buffer[offset + size] = 1;
+                REQUIRE(Memory::IsZero(buffer + offset, size, kernel));
+                buffer[offset + size] = 0;
+            }
+        }
+    }
+}
+
+TEST_CASE("Memory zero fill", "[CppCommon][Memory]")
+{
+    const MemoryKernel kernels[] = { MemoryKernel::SCALAR, MemoryKernel::SSE2, MemoryKernel::AVX2, MemoryKernel::AVX512 };
+
+    uint8_t buffer[1024 + 128];
+
+    for (auto kernel : kernels)
+    {
+        for (size_t offset = 0; offset < 64; offset += 5)
+        {
+            for (size_t size = 0; size <= 1024; size += ((size < 300) ? 1 : 67))
+            {
+                std::memset(buffer, 0xFF, sizeof(buffer));
+                Memory::ZeroFill(buffer + offset, size, kernel);
+                REQUIRE(Memory::IsZero(buffer + offset, size));
+                for (size_t i = 0; i < offset; ++i)
+                    REQUIRE(buffer[i] == 0xFF);
+                for (size_t i = offset + size; i < sizeof(buffer); ++i)
+                    REQUIRE(buffer[i] == 0xFF);
+            }
+        }
+    }
+
+    // Huge buffer zero fill uses non-temporal stores
+    std::vector<uint8_t> huge(8 * 1024 * 1024 + 3, 0xFF);
+    Memory::ZeroFill(huge.data() + 1, huge.size() - 2);
+    REQUIRE(huge.front() == 0xFF);
+    REQUIRE(huge.back() == 0xFF);
+    REQUIRE(Memory::IsZero(huge.data() + 1, huge.size() - 2));
+}
+
+TEST_CASE("Memory random fill", "[CppCommon][Memory]")
+{
+    const MemoryKernel kernels[] = { MemoryKernel::SCALAR, MemoryKernel::SSE2, MemoryKernel::AVX2, MemoryKernel::AVX512 };
+
+    uint8_t buffer[1024 + 128];
+
+    for (auto kernel : kernels)
+    {
+        for (size_t size = 0; size <= 1024; size += ((size < 200) ? 1 : 97))
+        {
+            std::memset(buffer, 0, sizeof(buffer));
+            Memory::RandomFill(buffer + 1, size, kernel);
+            REQUIRE(buffer[0] == 0);
+            REQUIRE(Memory::IsZero(buffer + 1 + size, sizeof(buffer) - size - 1));
+            if (size >= 32)
+                REQUIRE(!Memory::IsZero(buffer + 1, size));
+        }
+
+        // Random bytes should be distributed over all byte values
+        std::vector<uint8_t> random(65536);
+        Memory::RandomFill(random.data(), random.size(), kernel);
+        size_t histogram[256] = { 0 };
+        for (auto value : random)
+            ++histogram[value];
+        for (auto count : histogram)
+            REQUIRE(((count > 128) && (count < 384)));
+    }
+
+    // Two sequential random fills should produce different bytes
+    uint8_t random1[64];
+    uint8_t random2[64];
+    Memory::RandomFill(random1, sizeof(random1));
+    Memory::RandomFill(random2, sizeof(random2));
+    REQUIRE(std::memcmp(random1, random2, sizeof(random1)) != 0);
+}
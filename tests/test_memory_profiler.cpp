@@ -0,0 +1,122 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "memory/allocator_arena.h"
+#include "memory/allocator_profiler.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Memory profiler", "[CppCommon][Memory]")
+{
+    MemoryProfiler::Reset();
+    REQUIRE(!MemoryProfiler::IsEnabled());
+
+    // Disabled profiler should not record anything
+    MemoryProfiler::RecordAllocation(100);
+    MemoryProfiler::RecordDeallocation(100);
+    REQUIRE(MemoryProfiler::GetStatistics().allocations == 0);
+    REQUIRE(MemoryProfiler::GetStatistics().deallocations == 0);
+
+    size_t interval = MemoryProfiler::GetSamplingInterval();
+    MemoryProfiler::SetSamplingInterval(1);
+    MemoryProfiler::Enable();
+    REQUIRE(MemoryProfiler::IsEnabled());
+
+    DefaultMemoryManager auxiliary;
+    ProfilerMemoryManager<DefaultMemoryManager> manager(auxiliary);
+
+    void* ptr1 = manager.malloc(1);
+    void* ptr2 = manager.malloc(100);
+    void* ptr3 = manager.malloc(1000);
+    REQUIRE(manager.allocated() == 1101);
+    REQUIRE(manager.allocations() == 3);
+    REQUIRE(auxiliary.allocated() == 1101);
+    REQUIRE(auxiliary.allocations() == 3);
+    manager.free(ptr1, 1);
+    manager.free(ptr2, 100);
+    REQUIRE(manager.allocated() == 1000);
+    REQUIRE(manager.allocations() == 1);
+
+    MemoryProfiler::Disable();
+
+    auto statistics = MemoryProfiler::GetStatistics();
+    REQUIRE(statistics.allocations == 3);
+    REQUIRE(statistics.deallocations == 2);
+    REQUIRE(statistics.allocated == 1101);
+    REQUIRE(statistics.deallocated == 101);
+    REQUIRE(statistics.live_allocations() == 1);
+    REQUIRE(statistics.live_allocated() == 1000);
+    // Large allocations are always sampled with the tiny sampling interval, the smallest one is sampled with the probability 1 - 1/e
+    REQUIRE(statistics.samples >= 2);
+    REQUIRE(statistics.samples <= 3);
+    REQUIRE(statistics.histogram[1] == 1);
+    REQUIRE(statistics.histogram[7] == 1);
+    REQUIRE(statistics.histogram[10] == 1);
+
+    // Sampled call stacks should be available in the folded stacks format
+    std::string folded = MemoryProfiler::DumpFlameGraph();
+    REQUIRE(!folded.empty());
+    REQUIRE(folded.back() == '\n');
+
+    manager.free(ptr3, 1000);
+
+    MemoryProfiler::Reset();
+    MemoryProfiler::SetSamplingInterval(interval);
+    REQUIRE(MemoryProfiler::GetStatistics().allocations == 0);
+    REQUIRE(MemoryProfiler::DumpFlameGraph().empty());
+}
+
+TEST_CASE("Memory profiler first allocation of the thread", "[CppCommon][Memory]")
+{
+    MemoryProfiler::Reset();
+    MemoryProfiler::SetSamplingInterval(1024 * 1024 * 1024);
+    MemoryProfiler::Enable();
+
+    // Small first allocations of new threads should not be sampled with the huge sampling interval
+    for (int i = 0; i < 10; ++i)
+        std::thread([]() { MemoryProfiler::RecordAllocation(1); }).join();
+
+    MemoryProfiler::Disable();
+
+    auto statistics = MemoryProfiler::GetStatistics();
+    REQUIRE(statistics.allocations == 10);
+    REQUIRE(statistics.samples == 0);
+
+    MemoryProfiler::Reset();
+    MemoryProfiler::SetSamplingInterval(512 * 1024);
+}
+
+TEST_CASE("Profiler memory allocator", "[CppCommon][Memory]")
+{
+    MemoryProfiler::Reset();
+    MemoryProfiler::SetSamplingInterval(0);
+    MemoryProfiler::Enable();
+
+    DefaultMemoryManager auxiliary;
+    ArenaMemoryManager<DefaultMemoryManager> arena(auxiliary);
+    ProfilerMemoryManager<ArenaMemoryManager<DefaultMemoryManager>> manager(arena);
+    ProfilerAllocator<int, ArenaMemoryManager<DefaultMemoryManager>> alloc(manager);
+    {
+        std::vector<int, decltype(alloc)> vector(alloc);
+        for (int i = 0; i < 1000; ++i)
+            vector.push_back(i);
+    }
+
+    MemoryProfiler::Disable();
+
+    auto statistics = MemoryProfiler::GetStatistics();
+    REQUIRE(statistics.allocations > 0);
+    REQUIRE(statistics.allocations == statistics.deallocations);
+    REQUIRE(statistics.live_allocated() == 0);
+    REQUIRE(statistics.samples == 0);
+    REQUIRE(MemoryProfiler::DumpFlameGraph().empty());
+
+    MemoryProfiler::Reset();
+    MemoryProfiler::SetSamplingInterval(512 * 1024);
+}
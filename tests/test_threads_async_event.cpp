@@ -0,0 +1,78 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_event_auto_reset.h"
+#include "threads/async_event_manual_reset.h"
+#include "threads/scheduler.h"
+
+using namespace CppCommon;
+
+namespace {
+
+template <class TEvent>
+Task<> Wait(TEvent& event, int& counter)
+{
+    co_await event.Wait();
+    ++counter;
+}
+
+} // namespace
+
+TEST_CASE("Awaitable manual-reset event", "[CppCommon][Threads]")
+{
+    InlineScheduler scheduler;
+    AsyncEventManualReset event;
+    int counter = 0;
+
+    // Spawn waiters on the current thread
+    for (int i = 0; i < 10; ++i)
+        scheduler.Spawn(Wait(event, counter));
+    REQUIRE(counter == 0);
+    REQUIRE(!event.TryWait());
+
+    // Signal resumes all waiters
+    event.Signal();
+    REQUIRE(counter == 10);
+    REQUIRE(event.TryWait());
+
+    // Signaled event does not suspend
+    scheduler.Spawn(Wait(event, counter));
+    REQUIRE(counter == 11);
+
+    // Reset event suspends again
+    event.Reset();
+    REQUIRE(!event.TryWait());
+    scheduler.Spawn(Wait(event, counter));
+    REQUIRE(counter == 11);
+    event.Signal();
+    REQUIRE(counter == 12);
+}
+
+TEST_CASE("Awaitable auto-reset event", "[CppCommon][Threads]")
+{
+    InlineScheduler scheduler;
+    AsyncEventAutoReset event;
+    int counter = 0;
+
+    // Spawn waiters on the current thread
+    for (int i = 0; i < 10; ++i)
+        scheduler.Spawn(Wait(event, counter));
+    REQUIRE(counter == 0);
+
+    // Signal resumes one waiter
+    event.Signal();
+    REQUIRE(counter == 1);
+    REQUIRE(!event.TryWait());
+    for (int i = 0; i < 9; ++i)
+        event.Signal();
+    REQUIRE(counter == 10);
+
+    // Signal without waiters keeps the event signaled for the next waiter
+    event.Signal();
+    scheduler.Spawn(Wait(event, counter));
+    REQUIRE(counter == 11);
+    REQUIRE(!event.TryWait());
+}
@@ -0,0 +1,51 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_latch.h"
+#include "threads/scheduler.h"
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Wait(AsyncLatch& latch, int& counter)
+{
+    co_await latch.Wait();
+    ++counter;
+}
+
+} // namespace
+
+TEST_CASE("Awaitable latch", "[CppCommon][Threads]")
+{
+    InlineScheduler scheduler;
+    AsyncLatch latch(3);
+    int counter = 0;
+
+    // Spawn waiters on the current thread
+    for (int i = 0; i < 10; ++i)
+        scheduler.Spawn(Wait(latch, counter));
+
+    // Test CountDown()/TryWait() methods
+    REQUIRE(!latch.TryWait());
+    latch.CountDown();
+    REQUIRE(latch.counter() == 2);
+    latch.CountDown(2);
+    REQUIRE(latch.TryWait());
+    REQUIRE(counter == 10);
+
+    // Completed latch does not suspend
+    scheduler.Spawn(Wait(latch, counter));
+    REQUIRE(counter == 11);
+
+    // Test Reset() method
+    latch.Reset(1);
+    REQUIRE(!latch.TryWait());
+    scheduler.Spawn(Wait(latch, counter));
+    REQUIRE(counter == 11);
+    latch.CountDown();
+    REQUIRE(counter == 12);
+}
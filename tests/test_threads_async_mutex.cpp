@@ -0,0 +1,57 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_latch.h"
+#include "threads/async_mutex.h"
+#include "threads/scheduler.h"
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Increment(Scheduler& scheduler, AsyncMutex& mutex, AsyncLatch& latch, int& counter, int items)
+{
+    co_await scheduler.Schedule();
+    for (int i = 0; i < items; ++i)
+    {
+        co_await mutex.Lock();
+        ++counter;
+        mutex.Unlock();
+    }
+    latch.CountDown();
+}
+
+Task<> Run(Scheduler& scheduler, AsyncMutex& mutex, int& counter, int coroutines, int items)
+{
+    AsyncLatch latch(coroutines);
+    for (int i = 0; i < coroutines; ++i)
+        scheduler.Spawn(Increment(scheduler, mutex, latch, counter, items));
+    co_await latch.Wait();
+}
+
+} // namespace
+
+TEST_CASE("Awaitable mutex", "[CppCommon][Threads]")
+{
+    AsyncMutex mutex;
+
+    REQUIRE(mutex.TryLock());
+    REQUIRE(!mutex.TryLock());
+    mutex.Unlock();
+    REQUIRE(mutex.TryLock());
+    mutex.Unlock();
+}
+
+TEST_CASE("Awaitable mutex coroutines", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false);
+    PoolScheduler scheduler(pool);
+    AsyncMutex mutex;
+
+    int counter = 0;
+    Run(scheduler, mutex, counter, 100, 100).Get();
+    REQUIRE(counter == 10000);
+}
@@ -0,0 +1,63 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_latch.h"
+#include "threads/async_semaphore.h"
+#include "threads/scheduler.h"
+
+#include <atomic>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Acquire(Scheduler& scheduler, AsyncSemaphore& semaphore, AsyncLatch& latch, std::atomic<int>& active, std::atomic<int>& overflows)
+{
+    co_await scheduler.Schedule();
+    co_await semaphore.Lock();
+    if (++active > 4)
+        ++overflows;
+    --active;
+    semaphore.Unlock();
+    latch.CountDown();
+}
+
+Task<> Run(Scheduler& scheduler, AsyncSemaphore& semaphore, std::atomic<int>& active, std::atomic<int>& overflows, int coroutines)
+{
+    AsyncLatch latch(coroutines);
+    for (int i = 0; i < coroutines; ++i)
+        scheduler.Spawn(Acquire(scheduler, semaphore, latch, active, overflows));
+    co_await latch.Wait();
+}
+
+} // namespace
+
+TEST_CASE("Awaitable semaphore", "[CppCommon][Threads]")
+{
+    AsyncSemaphore semaphore(2);
+
+    REQUIRE(semaphore.resources() == 2);
+    REQUIRE(semaphore.TryLock());
+    REQUIRE(semaphore.TryLock());
+    REQUIRE(!semaphore.TryLock());
+    REQUIRE(semaphore.resources() == 0);
+    semaphore.Unlock();
+    semaphore.Unlock();
+    REQUIRE(semaphore.resources() == 2);
+}
+
+TEST_CASE("Awaitable semaphore coroutines", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false);
+    PoolScheduler scheduler(pool);
+    AsyncSemaphore semaphore(4);
+
+    std::atomic<int> active(0);
+    std::atomic<int> overflows(0);
+    Run(scheduler, semaphore, active, overflows, 1000).Get();
+    REQUIRE(overflows == 0);
+    REQUIRE(semaphore.resources() == 4);
+}
@@ -0,0 +1,106 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_latch.h"
+#include "threads/async_wait_queue.h"
+#include "threads/scheduler.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<> Produce(Scheduler& scheduler, AsyncWaitQueue<int>& queue, AsyncLatch& latch, int first, int count)
+{
+    co_await scheduler.Schedule();
+    for (int i = 0; i < count; ++i)
+        co_await queue.Enqueue(first + i);
+    latch.CountDown();
+}
+
+Task<> Consume(Scheduler& scheduler, AsyncWaitQueue<int>& queue, AsyncLatch& latch, std::atomic<int64_t>& crc)
+{
+    co_await scheduler.Schedule();
+    int item;
+    while (co_await queue.Dequeue(item))
+        crc += item;
+    latch.CountDown();
+}
+
+Task<> Run(Scheduler& scheduler, AsyncWaitQueue<int>& queue, std::atomic<int64_t>& crc, int producers, int consumers, int items)
+{
+    AsyncLatch produced(producers);
+    AsyncLatch consumed(consumers);
+    for (int i = 0; i < consumers; ++i)
+        scheduler.Spawn(Consume(scheduler, queue, consumed, crc));
+    for (int i = 0; i < producers; ++i)
+        scheduler.Spawn(Produce(scheduler, queue, produced, i * (items / producers), items / producers));
+    co_await produced.Wait();
+    queue.Close();
+    co_await consumed.Wait();
+}
+
+Task<> Dequeue(AsyncWaitQueue<int>& queue, std::vector<int>& items, bool& closed)
+{
+    int item;
+    while (co_await queue.Dequeue(item))
+        items.push_back(item);
+    closed = true;
+}
+
+Task<> Enqueue(AsyncWaitQueue<int>& queue, int item, bool& result)
+{
+    result = co_await queue.Enqueue(item);
+}
+
+} // namespace
+
+TEST_CASE("Awaitable wait queue", "[CppCommon][Threads]")
+{
+    InlineScheduler scheduler;
+    AsyncWaitQueue<int> queue(2);
+
+    // Items are enqueued until the queue is full
+    bool result1 = false, result2 = false, result3 = false;
+    scheduler.Spawn(Enqueue(queue, 1, result1));
+    scheduler.Spawn(Enqueue(queue, 2, result2));
+    scheduler.Spawn(Enqueue(queue, 3, result3));
+    REQUIRE((result1 && result2 && !result3));
+    REQUIRE(queue.size() == 2);
+
+    // Consumer frees the space for the suspended producer and is suspended on the empty queue
+    std::vector<int> items;
+    bool closed = false;
+    scheduler.Spawn(Dequeue(queue, items, closed));
+    REQUIRE(result3);
+    REQUIRE(items == std::vector<int>({ 1, 2, 3 }));
+    REQUIRE(queue.empty());
+
+    // Items are handed over to the suspended consumer directly
+    scheduler.Spawn(Enqueue(queue, 4, result1));
+    REQUIRE(items == std::vector<int>({ 1, 2, 3, 4 }));
+
+    // Close resumes the suspended consumer
+    REQUIRE(!closed);
+    queue.Close();
+    REQUIRE(closed);
+    REQUIRE(queue.closed());
+    scheduler.Spawn(Enqueue(queue, 5, result1));
+    REQUIRE(!result1);
+}
+
+TEST_CASE("Awaitable wait queue coroutines", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false);
+    PoolScheduler scheduler(pool);
+    AsyncWaitQueue<int> queue(16);
+
+    std::atomic<int64_t> crc(0);
+    Run(scheduler, queue, crc, 8, 8, 10000).Get();
+    REQUIRE(crc == 49995000);
+}
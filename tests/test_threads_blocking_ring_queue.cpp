@@ -0,0 +1,165 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/blocking_ring_queue.h"
+#include "threads/spsc_ring_queue.h"
+#include "threads/thread.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Blocking ring queue", "[CppCommon][Threads]")
+{
+    BlockingRingQueue<int> queue(4);
+
+    REQUIRE(!queue.closed());
+    REQUIRE(queue.capacity() == 4);
+    REQUIRE(queue.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!queue.TryDequeue(v));
+
+    REQUIRE((queue.Enqueue(0) && (queue.size() == 1)));
+    REQUIRE((queue.Enqueue(1) && (queue.size() == 2)));
+    REQUIRE((queue.TryEnqueue(2) && (queue.size() == 3)));
+    REQUIRE((queue.TryEnqueue(3) && (queue.size() == 4)));
+    REQUIRE(!queue.TryEnqueue(4));
+
+    REQUIRE(((queue.Dequeue(v) && (v == 0)) && (queue.size() == 3)));
+    REQUIRE(((queue.TryDequeue(v) && (v == 1)) && (queue.size() == 2)));
+
+    REQUIRE((queue.Enqueue(4) && (queue.size() == 3)));
+
+    queue.Close();
+
+    REQUIRE(queue.closed());
+    REQUIRE(!queue.Enqueue(5));
+    REQUIRE(!queue.TryEnqueue(5));
+
+    // Items left in the closed queue are still available
+    REQUIRE(((queue.Dequeue(v) && (v == 2)) && (queue.size() == 2)));
+    REQUIRE(((queue.Dequeue(v) && (v == 3)) && (queue.size() == 1)));
+    REQUIRE(((queue.Dequeue(v) && (v == 4)) && (queue.size() == 0)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Blocking ring queue wakes parked threads on close", "[CppCommon][Threads]")
+{
+    BlockingRingQueue<int> queue(2, 0);
+
+    // Park the consumer on the empty queue
+    bool result = true;
+    auto consumer = std::thread([&queue, &result]()
+    {
+        int item;
+        result = queue.Dequeue(item);
+    });
+
+    Thread::SleepFor(Timespan::milliseconds(10));
+    queue.Close();
+    consumer.join();
+
+    REQUIRE(!result);
+}
+
+TEST_CASE("Blocking ring queue threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int consumers_count = 2;
+    std::atomic<int> crc(0);
+
+    // Small capacity and no spinning to exercise parking of both producers and consumers
+    BlockingRingQueue<int> queue(16, 0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &crc]()
+        {
+            int item;
+            while (queue.Dequeue(item))
+                crc += item;
+        });
+    }
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                if (!queue.Enqueue((producer * items) + i))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the blocking ring queue
+    queue.Close();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
+
+TEST_CASE("Blocking single producer / single consumer ring queue threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int crc = 0;
+
+    BlockingRingQueue<int, SPSCRingQueue<int>> queue(16, 0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumer thread
+    auto consumer = std::thread([&queue, &crc]()
+    {
+        int item;
+        while (queue.Dequeue(item))
+            crc += item;
+    });
+
+    // Start producer thread
+    auto producer = std::thread([&queue, items_to_produce]()
+    {
+        for (int i = 0; i < items_to_produce; ++i)
+            if (!queue.Enqueue(i))
+                break;
+    });
+
+    // Wait for the producer thread
+    producer.join();
+
+    // Close the blocking ring queue
+    queue.Close();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
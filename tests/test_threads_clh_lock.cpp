@@ -0,0 +1,72 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/clh_lock.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("CLH lock", "[CppCommon][Threads]")
+{
+    CLHLock lock;
+
+    // Test IsLocked() method
+    REQUIRE(!lock.IsLocked());
+
+    // Test TryLock() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.IsLocked());
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+    REQUIRE(!lock.IsLocked());
+
+    // Test Lock()/Unlock() methods
+    lock.Lock();
+    REQUIRE(lock.IsLocked());
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+    REQUIRE(!lock.IsLocked());
+}
+
+TEST_CASE("CLH lock locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int producers_count = 4;
+    int64_t crc = 0;
+
+    CLHLock lock;
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, &crc, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+            {
+                Locker<CLHLock> locker(lock);
+                crc += (producer * items) + i;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+
+    REQUIRE(!lock.IsLocked());
+}
@@ -0,0 +1,158 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/disruptor.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Event
+{
+    int value;
+    int doubled;
+    int squared;
+};
+
+template <class TWaitStrategy>
+void diamond(int producers_count, bool multiple_producers)
+{
+    int items_to_produce = 10000;
+    int64_t crc1 = 0;
+    int64_t crc2 = 0;
+    int64_t crc3 = 0;
+
+    Disruptor<Event, TWaitStrategy> disruptor(64, multiple_producers);
+
+    // Build the diamond consumer graph: two independent stages followed by the joining stage
+    auto& doubler = disruptor.AddConsumer();
+    auto& squarer = disruptor.AddConsumer();
+    auto& joiner = disruptor.AddConsumer({ &doubler, &squarer });
+
+    // Calculate result values
+    int64_t result1 = 0;
+    int64_t result2 = 0;
+    int64_t result3 = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        result1 += 2 * i;
+        result2 += (i % 100) * (i % 100);
+        result3 += i + 2 * i + (i % 100) * (i % 100);
+    }
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    consumers.emplace_back([&doubler, &crc1]()
+    {
+        while (doubler.Consume([&crc1](Event& event, int64_t, bool) { event.doubled = 2 * event.value; crc1 += event.doubled; }) > 0);
+    });
+    consumers.emplace_back([&squarer, &crc2]()
+    {
+        while (squarer.Consume([&crc2](Event& event, int64_t, bool) { event.squared = (event.value % 100) * (event.value % 100); crc2 += event.squared; }) > 0);
+    });
+    consumers.emplace_back([&joiner, &crc3]()
+    {
+        while (joiner.Consume([&crc3](Event& event, int64_t, bool) { crc3 += event.value + event.doubled + event.squared; }) > 0);
+    });
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&disruptor, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                if (!disruptor.Produce([=](Event& event, int64_t) { event.value = (producer * items) + i; }))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the disruptor
+    disruptor.Close();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check results
+    REQUIRE(crc1 == result1);
+    REQUIRE(crc2 == result2);
+    REQUIRE(crc3 == result3);
+    REQUIRE(joiner.sequence() == (items_to_produce - 1));
+}
+
+} // namespace
+
+TEST_CASE("Disruptor", "[CppCommon][Threads]")
+{
+    Disruptor<int> disruptor(4);
+
+    auto& stage1 = disruptor.AddConsumer();
+    auto& stage2 = disruptor.AddConsumer({ &stage1 });
+
+    REQUIRE(!disruptor.closed());
+    REQUIRE(disruptor.capacity() == 4);
+    REQUIRE(disruptor.cursor() == -1);
+    REQUIRE(stage1.sequence() == -1);
+    REQUIRE(stage2.sequence() == -1);
+
+    // Claim and publish the batch of items
+    int64_t first = disruptor.Claim(3);
+    REQUIRE(first == 0);
+    for (int i = 0; i < 3; ++i)
+        disruptor[first + i] = i;
+    disruptor.Publish(first, 3);
+    REQUIRE(disruptor.cursor() == 2);
+
+    // The second stage waits for the first one
+    REQUIRE(stage2.TryConsume([](int&, int64_t, bool) {}) == 0);
+
+    // The first stage consumes the whole batch
+    int sum = 0;
+    bool end = false;
+    REQUIRE(stage1.TryConsume([&](int& item, int64_t sequence, bool end_of_batch) { sum += item; item *= 10; end = end_of_batch; REQUIRE(sequence == item / 10); }) == 3);
+    REQUIRE(((sum == 3) && end));
+    REQUIRE(stage1.sequence() == 2);
+
+    // The second stage observes items modified by the first stage
+    sum = 0;
+    REQUIRE(stage2.TryConsume([&](int& item, int64_t, bool) { sum += item; }) == 3);
+    REQUIRE(sum == 30);
+    REQUIRE(stage2.sequence() == 2);
+
+    // Produce items around the ring end
+    REQUIRE(disruptor.Produce([](int& item, int64_t sequence) { item = (int)sequence; }));
+    REQUIRE(disruptor.Produce([](int& item, int64_t sequence) { item = (int)sequence; }));
+    REQUIRE(stage1.Consume([](int&, int64_t, bool) {}) == 2);
+    REQUIRE(stage2.Consume([](int& item, int64_t sequence, bool) { REQUIRE(item == sequence); }) == 2);
+
+    disruptor.Close();
+
+    REQUIRE(disruptor.closed());
+    REQUIRE(disruptor.Claim() == -1);
+    REQUIRE(stage1.Consume([](int&, int64_t, bool) {}) == 0);
+    REQUIRE(stage2.Consume([](int&, int64_t, bool) {}) == 0);
+}
+
+TEST_CASE("Disruptor threads", "[CppCommon][Threads]")
+{
+    diamond<BlockingWaitStrategy>(1, false);
+    diamond<YieldingWaitStrategy>(1, false);
+}
+
+TEST_CASE("Disruptor multiple producers threads", "[CppCommon][Threads]")
+{
+    diamond<BlockingWaitStrategy>(4, true);
+    diamond<YieldingWaitStrategy>(4, true);
+}
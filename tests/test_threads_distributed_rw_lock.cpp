@@ -0,0 +1,185 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/distributed_rw_lock.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Distributed read/write lock", "[CppCommon][Threads]")
+{
+    DistributedRWLock lock;
+
+    // Test TryLockRead() method
+    REQUIRE(lock.TryLockRead());
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockRead();
+
+    // Test TryLockWrite() method
+    REQUIRE(lock.TryLockWrite());
+    REQUIRE(!lock.TryLockRead());
+    lock.UnlockWrite();
+
+    // Test LockRead()/UnlockRead() methods
+    lock.LockRead();
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockRead();
+
+    // Test LockWrite()/UnlockWrite() methods
+    lock.LockWrite();
+    REQUIRE(!lock.TryLockRead());
+    lock.UnlockWrite();
+}
+
+TEST_CASE("Distributed read/write locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10;
+    int consumers_count = 4;
+    int crc = 0;
+    std::vector<int> crcs;
+    int current = 0;
+
+    DistributedRWLock lock;
+
+    // Reset consumers' results
+    for (int i = 0; i < consumers_count; ++i)
+        crcs.push_back(0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producer thread
+    std::thread producer = std::thread([&lock, &crc, &current, items_to_produce]()
+    {
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            // Use a write locker to produce the item
+            {
+                WriteLocker<DistributedRWLock> locker(lock);
+
+                // Update the current produced item and produced crc
+                current = i;
+                crc += current;
+            }
+
+            // Sleep for a while...
+            Thread::Sleep(10);
+        }
+    });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&lock, &crcs, &current, consumer, items_to_produce]()
+        {
+            int item = 0;
+            while (item < (items_to_produce - 1))
+            {
+                // Use a read locker to consume the item
+                {
+                    ReadLocker<DistributedRWLock> locker(lock);
+
+                    // Check for the current item changed
+                    if (item != current)
+                    {
+                        // Update consumed crc
+                        item = current;
+                        crcs[consumer] += item;
+                    }
+                }
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+    for (int i = 0; i < consumers_count; ++i)
+        REQUIRE(crcs[i] > 0);
+}
+
+TEST_CASE("Distributed read/write lock preference", "[CppCommon][Threads]")
+{
+    for (bool writer_preference : { true, false })
+    {
+        int items_to_produce = 1000;
+        int readers_count = 4;
+        int writers_count = 2;
+        int64_t first = 0;
+        int64_t second = 0;
+        std::atomic<bool> stop(false);
+        std::atomic<int> torn(0);
+
+        DistributedRWLock lock(writer_preference);
+        REQUIRE(lock.writer_preference() == writer_preference);
+        REQUIRE(lock.slots() > 0);
+
+        // Start readers threads
+        std::vector<std::thread> readers;
+        for (int reader = 0; reader < readers_count; ++reader)
+        {
+            readers.emplace_back([&lock, &first, &second, &stop, &torn]()
+            {
+                while (!stop)
+                {
+                    // Readers must never observe the partial write
+                    {
+                        ReadLocker<DistributedRWLock> locker(lock);
+                        if (first != second)
+                            ++torn;
+                    }
+                    Thread::Yield();
+                }
+            });
+        }
+
+        // Start writers threads
+        std::vector<std::thread> writers;
+        for (int writer = 0; writer < writers_count; ++writer)
+        {
+            writers.emplace_back([&lock, &first, &second, items_to_produce, writers_count]()
+            {
+                for (int i = 0; i < (items_to_produce / writers_count); ++i)
+                {
+                    WriteLocker<DistributedRWLock> locker(lock);
+                    ++first;
+                    Thread::Yield();
+                    ++second;
+                }
+            });
+        }
+
+        // Wait for all writers threads
+        for (auto& writer : writers)
+            writer.join();
+
+        // Wait for all readers threads
+        stop = true;
+        for (auto& reader : readers)
+            reader.join();
+
+        // Check result
+        REQUIRE(torn == 0);
+        REQUIRE(first == items_to_produce);
+        REQUIRE(second == items_to_produce);
+    }
+}
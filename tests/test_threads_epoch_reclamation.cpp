@@ -0,0 +1,122 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/epoch_reclamation.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Node
+{
+    static std::atomic<int> deleted;
+
+    int value;
+
+    explicit Node(int v) : value(v) {}
+    ~Node() { ++deleted; }
+};
+
+std::atomic<int> Node::deleted(0);
+
+} // namespace
+
+TEST_CASE("Epoch-based reclamation", "[CppCommon][Threads]")
+{
+    Node::deleted = 0;
+
+    {
+        EpochReclamation domain(1);
+
+        std::atomic<Node*> source(new Node(1));
+
+        {
+            // Enter the read-side critical section
+            EpochReclamation::Guard reader(domain);
+            Node* node = source.load();
+            REQUIRE(node->value == 1);
+
+            // Retire the accessed node from another thread
+            std::thread([&domain, &source]()
+            {
+                domain.Retire(source.exchange(new Node(2)));
+                domain.Reclaim();
+            }).join();
+
+            // Accessed node must stay alive while the reader is inside the critical section
+            REQUIRE(Node::deleted == 0);
+            REQUIRE(node->value == 1);
+            REQUIRE(domain.records() == 2);
+
+            // Nested guard does not change the announced epoch
+            EpochReclamation::Guard nested(domain);
+            domain.Reclaim();
+            REQUIRE(Node::deleted == 0);
+        }
+
+        // Retire one more node outside of the read-side critical section
+        uint64_t epoch = domain.epoch();
+        domain.Retire(source.exchange(nullptr));
+        domain.Reclaim();
+        REQUIRE(domain.epoch() > epoch);
+        REQUIRE(Node::deleted == 1);
+    }
+
+    REQUIRE(Node::deleted == 2);
+}
+
+TEST_CASE("Epoch-based reclamation threads", "[CppCommon][Threads]")
+{
+    Node::deleted = 0;
+
+    int readers_count = 4;
+    int updates = 10000;
+    std::atomic<bool> stop(false);
+    std::atomic<int> errors(0);
+
+    {
+        EpochReclamation domain;
+
+        std::atomic<Node*> source(new Node(0));
+
+        // Start readers threads
+        std::vector<std::thread> readers;
+        for (int reader = 0; reader < readers_count; ++reader)
+        {
+            readers.emplace_back([&domain, &source, &stop, &errors]()
+            {
+                while (!stop)
+                {
+                    EpochReclamation::Guard guard(domain);
+                    Node* node = source.load(std::memory_order_acquire);
+                    if (node->value < 0)
+                        ++errors;
+                }
+            });
+        }
+
+        // Update the node with a single writer
+        for (int i = 1; i <= updates; ++i)
+        {
+            EpochReclamation::Guard guard(domain);
+            guard.Retire(source.exchange(new Node(i)));
+        }
+
+        stop = true;
+        for (auto& reader : readers)
+            reader.join();
+
+        REQUIRE(errors == 0);
+        REQUIRE(Node::deleted > 0);
+
+        delete source.load();
+    }
+
+    REQUIRE(Node::deleted == updates + 1);
+}
@@ -0,0 +1,117 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/event_count.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Event count", "[CppCommon][Threads]")
+{
+    EventCount event;
+
+    // Test PrepareWait()/CancelWait() methods
+    uint32_t key = event.PrepareWait();
+    REQUIRE(event.waiters() == 1);
+    event.CancelWait();
+    REQUIRE(event.waiters() == 0);
+
+    // Test CommitWaitFor() method with timeout
+    key = event.PrepareWait();
+    REQUIRE(!event.CommitWaitFor(key, Timespan::milliseconds(10)));
+    REQUIRE(event.waiters() == 0);
+
+    // Test notification after the wait preparation
+    key = event.PrepareWait();
+    event.NotifyOne();
+    event.CommitWait(key);
+    REQUIRE(event.waiters() == 0);
+}
+
+TEST_CASE("Event count wait", "[CppCommon][Threads]")
+{
+    EventCount event;
+    REQUIRE(!event.shared());
+
+    // Test Wait() method with the satisfied condition
+    event.Wait([]() { return true; }, 10);
+    REQUIRE(event.waiters() == 0);
+
+    // Test Wait() method with the condition changed by another thread
+    std::atomic<bool> flag(false);
+    std::thread waiter([&event, &flag]() { event.Wait([&flag]() { return flag.load(); }); });
+    flag = true;
+    event.NotifyAll();
+    waiter.join();
+    REQUIRE(event.waiters() == 0);
+}
+
+TEST_CASE("Event count producer/consumers", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int consumers_count = 4;
+    std::atomic<int> items(0);
+    std::atomic<int> consumed(0);
+
+    EventCount event;
+
+    // Try to consume one produced item
+    auto consume = [&items]()
+    {
+        int available = items.load();
+        while (available > 0)
+            if (items.compare_exchange_weak(available, available - 1))
+                return true;
+        return false;
+    };
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&event, &items, &consumed, &consume, items_to_produce]()
+        {
+            while (consumed < items_to_produce)
+            {
+                if (consume())
+                {
+                    // Wake other consumers after the last item
+                    if (++consumed == items_to_produce)
+                        event.NotifyAll();
+                    continue;
+                }
+
+                // Prepare to wait and re-check the condition
+                uint32_t key = event.PrepareWait();
+                if ((items > 0) || (consumed == items_to_produce))
+                {
+                    event.CancelWait();
+                    continue;
+                }
+                event.CommitWait(key);
+            }
+        });
+    }
+
+    // Produce items in batches
+    for (int i = 0; i < items_to_produce; i += 10)
+    {
+        items += 10;
+        event.Notify(10);
+    }
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check results
+    REQUIRE(consumed == items_to_produce);
+    REQUIRE(items == 0);
+    REQUIRE(event.waiters() == 0);
+}
@@ -0,0 +1,95 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/futex_event_auto_reset.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Futex auto-reset event", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+
+    FutexEventAutoReset event;
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&event, &count, thread]()
+        {
+            // Sleep for a while...
+            Thread::Sleep(thread * 10);
+
+            // Wait for the event
+            event.Wait();
+
+            // Increment threads counter
+            ++count;
+        });
+    }
+
+    // Allow threads to start
+    Thread::Sleep(100);
+
+    // Signal the event for each thread that waits
+    for (int thread = 0; thread < concurrency; ++thread)
+        event.Signal();
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency);
+}
+
+TEST_CASE("Futex auto-reset event batched signal", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+
+    FutexEventAutoReset event;
+
+    // Test TryWait()/TryWaitFor() methods
+    REQUIRE(!event.TryWait());
+    REQUIRE(!event.TryWaitFor(Timespan::milliseconds(10)));
+    event.Signal();
+    REQUIRE(event.TryWait());
+    REQUIRE(!event.TryWait());
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&event, &count]()
+        {
+            // Wait for the event
+            event.Wait();
+
+            // Increment threads counter
+            ++count;
+        });
+    }
+
+    // Allow threads to start
+    Thread::Sleep(100);
+
+    // Signal the event for all threads that wait at once
+    event.Signal(concurrency);
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency);
+    REQUIRE(!event.TryWait());
+}
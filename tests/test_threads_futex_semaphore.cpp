@@ -0,0 +1,127 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/futex_semaphore.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Futex semaphore", "[CppCommon][Threads]")
+{
+    FutexSemaphore lock(4);
+
+    // Test TryLock() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.TryLock());
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+    lock.Unlock();
+    lock.Unlock();
+    lock.Unlock();
+
+    // Test Lock()/Unlock() methods
+    lock.Lock();
+    lock.Lock();
+    lock.Lock();
+    lock.Lock();
+    REQUIRE(!lock.TryLock());
+    lock.Unlock();
+    lock.Unlock();
+    lock.Unlock();
+    lock.Unlock();
+    REQUIRE(lock.TryLock());
+    lock.Unlock();
+
+    // Test bulk Unlock() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.TryLock());
+    REQUIRE(lock.available() == 1);
+    lock.Unlock(3);
+    REQUIRE(lock.available() == lock.resources());
+}
+
+TEST_CASE("Futex semaphore locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 8;
+    std::atomic<int> crc(0);
+
+    FutexSemaphore lock(4);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, &crc, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+            {
+                Locker<FutexSemaphore> locker(lock);
+                crc += (producer * items) + i;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
+
+TEST_CASE("Futex semaphore bulk unlock", "[CppCommon][Threads]")
+{
+    int concurrency = 8;
+    std::atomic<int> count(0);
+
+    FutexSemaphore lock(concurrency);
+
+    // Acquire all semaphore resources
+    for (int i = 0; i < concurrency; ++i)
+        REQUIRE(lock.TryLock());
+    REQUIRE(!lock.TryLockFor(Timespan::milliseconds(10)));
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&lock, &count]()
+        {
+            // Wait for the semaphore
+            lock.Lock();
+
+            // Increment threads counter
+            ++count;
+        });
+    }
+
+    // Allow threads to start
+    Thread::Sleep(100);
+
+    // Release all semaphore resources at once
+    lock.Unlock(concurrency);
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency);
+    REQUIRE(lock.available() == 0);
+}
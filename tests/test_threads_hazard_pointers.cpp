@@ -0,0 +1,65 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/hazard_pointers.h"
+
+#include <thread>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Node
+{
+    static int deleted;
+
+    int value;
+
+    explicit Node(int v) : value(v) {}
+    ~Node() { ++deleted; }
+};
+
+int Node::deleted = 0;
+
+} // namespace
+
+TEST_CASE("Hazard pointers", "[CppCommon][Threads]")
+{
+    Node::deleted = 0;
+
+    {
+        HazardPointers domain(1);
+
+        std::atomic<Node*> source(new Node(1));
+
+        HazardPointers::Guard reader(domain);
+        Node* protected_node = reader.Protect(0, source);
+        REQUIRE(protected_node->value == 1);
+
+        // Retire the protected node from another thread
+        std::thread([&domain, &source]()
+        {
+            HazardPointers::Guard writer(domain);
+            writer.Retire(source.exchange(new Node(2)));
+            domain.Reclaim();
+        }).join();
+
+        // Protected node must stay alive
+        REQUIRE(Node::deleted == 0);
+        REQUIRE(protected_node->value == 1);
+        REQUIRE(domain.records() == 2);
+
+        // Clear the hazard pointer and retire one more node from the reader thread
+        reader.Clear();
+        reader.Retire(source.exchange(nullptr));
+        domain.Reclaim();
+
+        // Only the retire list of the current thread is scanned, the first node is still pending
+        REQUIRE(Node::deleted == 1);
+    }
+
+    REQUIRE(Node::deleted == 2);
+}
@@ -0,0 +1,124 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/critical_section.h"
+#include "threads/lock_profiler.h"
+#include "threads/rw_lock.h"
+#include "threads/spin_lock.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+uint64_t Total(const uint64_t (&histogram)[LockProfiler::HISTOGRAM_SIZE])
+{
+    uint64_t total = 0;
+    for (auto bucket : histogram)
+        total += bucket;
+    return total;
+}
+
+} // namespace
+
+TEST_CASE("Lock contention profiler", "[CppCommon][Threads]")
+{
+    LockProfiler::Enable();
+    LockProfiler::SetStackTraces(4);
+    LockProfiler::Reset();
+
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int crc = 0;
+
+    // Two locks share the same lock site
+    ProfiledLock<CriticalSection> lock1("lock_profiler_test");
+    ProfiledLock<SpinLock> lock2("lock_profiler_test");
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock1, &crc, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+            {
+                Locker<ProfiledLock<CriticalSection>> locker(lock1);
+                ++crc;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    REQUIRE(lock2.TryLock());
+    lock2.Unlock();
+
+    LockProfiler::SetStackTraces(0);
+    LockProfiler::Disable();
+
+    // Disabled profiler does not record acquisitions
+    lock2.Lock();
+    lock2.Unlock();
+
+    REQUIRE(crc == items_to_produce);
+
+    auto statistics = LockProfiler::GetStatistics("lock_profiler_test");
+    REQUIRE(statistics.name == "lock_profiler_test");
+    REQUIRE(statistics.acquisitions == (uint64_t)(items_to_produce + 1));
+    REQUIRE(statistics.contentions <= statistics.acquisitions);
+    REQUIRE(statistics.holds == statistics.acquisitions);
+    REQUIRE(Total(statistics.wait_histogram) == statistics.contentions);
+    REQUIRE(Total(statistics.hold_histogram) == statistics.holds);
+    REQUIRE(statistics.max_wait_time <= statistics.wait_time);
+    REQUIRE(statistics.max_hold_time <= statistics.hold_time);
+    REQUIRE(statistics.samples.size() <= 4);
+    REQUIRE(statistics.samples.size() <= statistics.contentions);
+    for (size_t i = 1; i < statistics.samples.size(); ++i)
+        REQUIRE(statistics.samples[i - 1].wait_time >= statistics.samples[i].wait_time);
+
+    // Check the dump of lock sites
+    REQUIRE(LockProfiler::Dump().find("Lock: lock_profiler_test") != std::string::npos);
+
+    // Check unknown lock site
+    REQUIRE(LockProfiler::GetStatistics("lock_profiler_unknown").acquisitions == 0);
+
+    // Check statistics reset
+    LockProfiler::Reset();
+    statistics = LockProfiler::GetStatistics("lock_profiler_test");
+    REQUIRE(statistics.acquisitions == 0);
+    REQUIRE(statistics.samples.empty());
+}
+
+TEST_CASE("Lock contention profiler with read/write lock", "[CppCommon][Threads]")
+{
+    LockProfiler::Enable();
+
+    ProfiledLock<RWLock> lock("lock_profiler_rw_test");
+
+    lock.LockRead();
+    REQUIRE(lock.TryLockRead());
+    REQUIRE(!lock.TryLockWrite());
+    lock.UnlockRead();
+    lock.UnlockRead();
+
+    {
+        WriteLocker<ProfiledLock<RWLock>> locker(lock);
+        REQUIRE(!lock.TryLockRead());
+    }
+
+    LockProfiler::Disable();
+
+    auto statistics = LockProfiler::GetStatistics("lock_profiler_rw_test");
+    REQUIRE(statistics.acquisitions == 3);
+    REQUIRE(statistics.contentions == 0);
+    REQUIRE(statistics.holds == 1);
+}
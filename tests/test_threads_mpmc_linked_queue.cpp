@@ -0,0 +1,128 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/mpmc_linked_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue", "[CppCommon][Threads]")
+{
+    MPMCLinkedQueue<int> queue(2);
+
+    REQUIRE(queue.segment() == 2);
+
+    int v = -1;
+
+    REQUIRE(!queue.Dequeue(v));
+
+    REQUIRE(queue.Enqueue(0));
+    REQUIRE(queue.Enqueue(1));
+    REQUIRE(queue.Enqueue(2));
+
+    REQUIRE(((queue.Dequeue(v) && (v == 0))));
+    REQUIRE(((queue.Dequeue(v) && (v == 1))));
+
+    REQUIRE(queue.Enqueue(3));
+    REQUIRE(queue.Enqueue(4));
+
+    REQUIRE(((queue.Dequeue(v) && (v == 2))));
+    REQUIRE(((queue.Dequeue(v) && (v == 3))));
+    REQUIRE(((queue.Dequeue(v) && (v == 4))));
+    REQUIRE(!queue.Dequeue(v));
+
+    REQUIRE(queue.Enqueue(5));
+
+    REQUIRE((queue.Dequeue(v) && (v == 5)));
+    REQUIRE(!queue.Dequeue(v));
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue destroys items", "[CppCommon][Threads]")
+{
+    auto item = std::make_shared<int>(0);
+
+    {
+        MPMCLinkedQueue<std::shared_ptr<int>> queue(4);
+
+        // Fill several segments
+        for (int i = 0; i < 10; ++i)
+            REQUIRE(queue.Enqueue(item));
+        REQUIRE(item.use_count() == 11);
+
+        std::shared_ptr<int> v;
+        for (int i = 0; i < 5; ++i)
+            REQUIRE(queue.Dequeue(v));
+        v.reset();
+        REQUIRE(item.use_count() == 6);
+    }
+
+    // Remaining items are destroyed with the queue
+    REQUIRE(item.use_count() == 1);
+}
+
+TEST_CASE("Multiple producers / multiple consumers lock-free linked queue threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 100000;
+    int producers_count = 4;
+    int consumers_count = 4;
+    std::atomic<int64_t> crc(0);
+    std::atomic<int> consumed(0);
+
+    // Small segments to stress segments linking, retiring and recycling
+    MPMCLinkedQueue<int> queue(16);
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&queue, &crc, &consumed, items_to_produce]()
+        {
+            int item;
+            while (consumed < items_to_produce)
+            {
+                if (queue.Dequeue(item))
+                {
+                    crc += item;
+                    ++consumed;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+        {
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                queue.Enqueue((producer * items) + i);
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
@@ -6,6 +6,9 @@
 
 #include "threads/mpmc_ring_queue.h"
 
+#include <iterator>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppCommon][Threads]")
@@ -48,3 +51,34 @@ TEST_CASE("Multiple producers / multiple consumers wait-free ring queue", "[CppC
     REQUIRE(queue.capacity() == 4);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Multiple producers / multiple consumers wait-free ring queue with bulk operations", "[CppCommon][Threads]")
+{
+    MPMCRingQueue<int> queue(8);
+
+    int items[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int result[10] = { 0 };
+
+    REQUIRE(queue.DequeueBulk(result, 10) == 0);
+
+    // Enqueue a bulk which is bigger than the ring queue capacity
+    REQUIRE(queue.EnqueueBulk(items, 10) == 8);
+    REQUIRE(queue.size() == 8);
+    REQUIRE(queue.EnqueueBulk(items, 1) == 0);
+
+    // Dequeue a part of the bulk
+    REQUIRE(queue.DequeueBulk(result, 5) == 5);
+    REQUIRE(queue.size() == 3);
+    for (int i = 0; i < 5; ++i)
+        REQUIRE(result[i] == i);
+
+    // Enqueue a bulk with the ring queue wrap around
+    REQUIRE(queue.EnqueueBulk(items, 5) == 5);
+    REQUIRE(queue.size() == 8);
+
+    // Dequeue the rest of items into the container
+    std::vector<int> rest;
+    REQUIRE(queue.DequeueBulk(std::back_inserter(rest), 100) == 8);
+    REQUIRE(queue.size() == 0);
+    REQUIRE(rest == std::vector<int>({ 5, 6, 7, 0, 1, 2, 3, 4 }));
+}
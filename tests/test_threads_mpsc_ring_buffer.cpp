@@ -43,3 +43,34 @@ TEST_CASE("Multiple producers / single consumer wait-free ring buffer", "[CppCom
     REQUIRE(buffer.capacity() == 3);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring buffer with zero-copy access", "[CppCommon][Threads]")
+{
+    MPSCRingBuffer buffer(8, 4);
+
+    size_t size;
+    size_t producer;
+
+    REQUIRE(buffer.Peek(size) == nullptr);
+
+    // Reserve and commit
+    char* data = (char*)buffer.Reserve(size = 3, producer);
+    REQUIRE(data != nullptr);
+    REQUIRE(size == 3);
+    REQUIRE(producer < 4);
+    data[0] = 'a';
+    data[1] = 'b';
+    data[2] = 'c';
+    buffer.Commit(size, producer);
+    REQUIRE(buffer.size() == 3);
+
+    // Peek and release
+    const char* peeked = (const char*)buffer.Peek(size);
+    REQUIRE(peeked != nullptr);
+    REQUIRE(size == 3);
+    REQUIRE(((peeked[0] == 'a') && (peeked[1] == 'b') && (peeked[2] == 'c')));
+    buffer.Release(size);
+    REQUIRE(buffer.size() == 0);
+
+    REQUIRE(buffer.Peek(size) == nullptr);
+}
@@ -6,6 +6,11 @@
 
 #include "threads/mpsc_ring_queue.h"
 
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Multiple producers / single consumer wait-free ring queue", "[CppCommon][Threads]")
@@ -71,3 +76,222 @@ TEST_CASE("Multiple producers / single consumer wait-free ring queue (batch mode
     REQUIRE(batcher.capacity() == 3);
     REQUIRE(batcher.size() == 0);
 }
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue (bulk mode)", "[CppCommon][Threads]")
+{
+    MPSCRingQueue<int> queue(8, 1);
+
+    REQUIRE(queue.capacity() == 7);
+    REQUIRE(queue.size() == 0);
+
+    int items[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int result[10] = { 0 };
+
+    REQUIRE(queue.DequeueBulk(result, 10) == 0);
+
+    REQUIRE(queue.EnqueueBulk(items, 10) == 7);
+    REQUIRE(queue.size() == 7);
+
+    REQUIRE(queue.DequeueBulk(result, 5) == 5);
+    REQUIRE(queue.size() == 2);
+    for (int i = 0; i < 5; ++i)
+        REQUIRE(result[i] == i);
+
+    REQUIRE(queue.EnqueueBulk(items, 5) == 5);
+    REQUIRE(queue.DequeueBulk(result, 10) == 7);
+    REQUIRE(queue.size() == 0);
+    REQUIRE(!queue.Dequeue());
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue (dedicated lanes)", "[CppCommon][Threads]")
+{
+    int producers_count = 4;
+
+    MPSCRingQueue<int> queue(4, producers_count);
+
+    // Every producer thread fills its own lane up to the lane capacity
+    std::vector<int> enqueued(producers_count, 0);
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&queue, &enqueued, producer]()
+        {
+            while (queue.Enqueue((producer * 3) + enqueued[producer]))
+                ++enqueued[producer];
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    for (int producer = 0; producer < producers_count; ++producer)
+        REQUIRE(enqueued[producer] == 3);
+    REQUIRE(queue.size() == 12);
+
+    // Consumer visits non-empty lanes in round-robin order
+    int crc = 0;
+    int v = -1;
+    std::vector<int> lanes;
+    for (int i = 0; i < 12; ++i)
+    {
+        REQUIRE(queue.Dequeue(v));
+        crc += v;
+        if (i < producers_count)
+            lanes.push_back(v / 3);
+    }
+    REQUIRE(!queue.Dequeue(v));
+
+    REQUIRE(crc == 66);
+    std::sort(lanes.begin(), lanes.end());
+    for (int i = 0; i < producers_count; ++i)
+        REQUIRE(lanes[i] == i);
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue (ordered mode)", "[CppCommon][Threads]")
+{
+    MPSCRingQueue<int> queue(8, 4, true);
+
+    REQUIRE(queue.ordered());
+
+    // Interleave enqueues from different producer threads
+    int item = 0;
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int producer = 0; producer < 3; ++producer)
+        {
+            std::thread([&queue, &item]()
+            {
+                queue.Enqueue(item++);
+                queue.Enqueue(item++);
+            }).join();
+        }
+    }
+
+    // Items are dequeued in the global order
+    int v = -1;
+    for (int i = 0; i < 9; ++i)
+        REQUIRE((queue.Dequeue(v) && (v == i)));
+
+    int result[9] = { 0 };
+    REQUIRE(queue.DequeueBulk(result, 9) == 9);
+    for (int i = 0; i < 9; ++i)
+        REQUIRE(result[i] == (9 + i));
+
+    REQUIRE(!queue.Dequeue(v));
+    REQUIRE(queue.size() == 0);
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+
+    for (bool ordered : { false, true })
+    {
+        int crc = 0;
+        bool fifo = true;
+
+        MPSCRingQueue<int> queue(64, producers_count, ordered);
+
+        // Calculate result value
+        int result = 0;
+        for (int i = 0; i < items_to_produce; ++i)
+            result += i;
+
+        // Start consumer thread
+        auto consumer = std::thread([&queue, &crc, &fifo, items_to_produce, producers_count]()
+        {
+            // Items of the same producer must be dequeued in FIFO order
+            std::vector<int> last(producers_count, -1);
+            for (int i = 0; i < items_to_produce;)
+            {
+                int item;
+                if (!queue.Dequeue(item))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                int producer = item / (items_to_produce / producers_count);
+                fifo = fifo && (item > last[producer]);
+                last[producer] = item;
+                crc += item;
+                ++i;
+            }
+        });
+
+        // Start producers threads
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < producers_count; ++producer)
+        {
+            producers.emplace_back([&queue, producer, items_to_produce, producers_count]()
+            {
+                int items = (items_to_produce / producers_count);
+                for (int i = 0; i < items; ++i)
+                    while (!queue.Enqueue((producer * items) + i))
+                        std::this_thread::yield();
+            });
+        }
+
+        // Wait for all producers threads
+        for (auto& producer : producers)
+            producer.join();
+
+        // Wait for the consumer thread
+        consumer.join();
+
+        // Check result
+        REQUIRE(crc == result);
+        REQUIRE(fifo);
+    }
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue (colliding lanes cache)", "[CppCommon][Threads]")
+{
+    // Create enough queues to collide in the thread local lanes cache
+    std::vector<std::unique_ptr<MPSCRingQueue<int>>> queues;
+    for (int i = 0; i < 17; ++i)
+        queues.emplace_back(std::make_unique<MPSCRingQueue<int>>(8, 2));
+
+    // Interleave enqueues of the same producer thread into colliding queues
+    for (int i = 0; i < 4; ++i)
+    {
+        REQUIRE(queues[0]->Enqueue(i));
+        REQUIRE(queues[16]->Enqueue(i));
+    }
+
+    // Items of the same producer must be dequeued in FIFO order
+    for (auto index : { 0, 16 })
+    {
+        int result[4] = { 0 };
+        REQUIRE(queues[index]->DequeueBulk(result, 4) == 4);
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(result[i] == i);
+        REQUIRE(!queues[index]->Dequeue());
+    }
+}
+
+TEST_CASE("Multiple producers / single consumer wait-free ring queue (lanes of exited producers)", "[CppCommon][Threads]")
+{
+    MPSCRingQueue<int> queue(4, 2);
+
+    // Live producer fills its own lane
+    for (int i = 0; i < 3; ++i)
+        REQUIRE(queue.Enqueue(i));
+    REQUIRE(!queue.Enqueue(3));
+
+    // Short-lived producer takes the free lane and returns it on exit
+    std::thread([&queue]() { REQUIRE(queue.Enqueue(10)); }).join();
+
+    // The next producer must take the returned lane instead of the lane of the live producer
+    int enqueued = 0;
+    std::thread([&queue, &enqueued]()
+    {
+        while (queue.Enqueue(20 + enqueued))
+            ++enqueued;
+    }).join();
+
+    // The returned lane still holds the item of the exited producer
+    REQUIRE(enqueued == 2);
+    REQUIRE(queue.size() == 6);
+}
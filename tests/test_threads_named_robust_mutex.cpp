@@ -0,0 +1,156 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/named_robust_mutex.h"
+
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+#if defined(__linux__) || defined(_WIN32) || defined(_WIN64)
+
+TEST_CASE("Named robust mutex", "[CppCommon][Threads]")
+{
+    NamedRobustMutex lock("named_robust_mutex_test");
+    REQUIRE(lock.name() == "named_robust_mutex_test");
+
+    // Test TryLock() method
+    REQUIRE(lock.TryLock());
+    REQUIRE(!lock.recovered());
+    bool locked = true;
+    std::thread([&locked]()
+    {
+        NamedRobustMutex lock_slave("named_robust_mutex_test");
+        locked = lock_slave.TryLock() || lock_slave.TryLockFor(Timespan::milliseconds(10));
+    }).join();
+    REQUIRE(!locked);
+    lock.Unlock();
+
+    // Test Lock()/Unlock() methods
+    lock.Lock();
+    REQUIRE(!lock.recovered());
+    lock.Unlock();
+}
+
+TEST_CASE("Named robust mutex owner died", "[CppCommon][Threads]")
+{
+    NamedRobustMutex lock("named_robust_mutex_died_test");
+
+    NamedRobustMutex lock_slave("named_robust_mutex_died_test");
+
+    // Lock the mutex in the thread which exits without unlocking it
+    std::thread([&lock_slave]() { lock_slave.Lock(); }).join();
+
+    // The mutex is recovered from the dead owner
+    REQUIRE(lock.TryLockFor(Timespan::seconds(1)));
+    REQUIRE(lock.recovered());
+    lock.Unlock();
+
+    // The next lock is not recovered
+    lock.Lock();
+    REQUIRE(!lock.recovered());
+    lock.Unlock();
+}
+
+#if defined(__linux__)
+
+TEST_CASE("Named robust mutex owner process died and its thread id is reused", "[CppCommon][Threads]")
+{
+    NamedRobustMutex lock("named_robust_mutex_reused_test");
+
+    // Lock the mutex in the child process which exits without unlocking it
+    pid_t owner = fork();
+    if (owner == 0)
+    {
+        NamedRobustMutex lock_slave("named_robust_mutex_reused_test");
+        lock_slave.Lock();
+        _exit(0);
+    }
+    REQUIRE(owner > 0);
+    int status = 0;
+    REQUIRE(waitpid(owner, &status, 0) == owner);
+
+    // Recycle the thread id of the dead owner with a live process
+    std::ofstream("/proc/sys/kernel/ns_last_pid") << (owner - 1);
+    pid_t reused = fork();
+    if (reused == 0)
+    {
+        pause();
+        _exit(0);
+    }
+    REQUIRE(reused > 0);
+    if (reused != owner)
+        WARN("Failed to reuse the thread id of the dead owner!");
+
+    // The mutex is recovered from the dead owner
+    bool locked = lock.TryLockFor(Timespan::seconds(1));
+    bool recovered = locked && lock.recovered();
+    if (locked)
+        lock.Unlock();
+
+    kill(reused, SIGKILL);
+    REQUIRE(waitpid(reused, &status, 0) == reused);
+
+    REQUIRE(locked);
+    REQUIRE(recovered);
+
+    // The next lock is not recovered
+    lock.Lock();
+    REQUIRE(!lock.recovered());
+    lock.Unlock();
+}
+
+#endif
+
+TEST_CASE("Named robust mutex locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int crc = 0;
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Named robust mutex master
+    NamedRobustMutex lock_master("named_robust_mutex_locker_test");
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&crc, producer, items_to_produce, producers_count]()
+        {
+            // Named robust mutex slave
+            NamedRobustMutex lock_slave("named_robust_mutex_locker_test");
+
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+            {
+                Locker<NamedRobustMutex> locker(lock_slave);
+                crc += (producer * items) + i;
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
+
+#endif
@@ -0,0 +1,67 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/quiescent_reclamation.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace CppCommon;
+
+namespace {
+
+struct Node
+{
+    static int deleted;
+
+    int value;
+
+    explicit Node(int v) : value(v) {}
+    ~Node() { ++deleted; }
+};
+
+int Node::deleted = 0;
+
+} // namespace
+
+TEST_CASE("Quiescent state based reclamation", "[CppCommon][Threads]")
+{
+    Node::deleted = 0;
+
+    {
+        QuiescentReclamation domain(1);
+
+        std::atomic<Node*> source(new Node(1));
+
+        // Put the reader thread online and access the node
+        domain.Online();
+        Node* node = source.load();
+        REQUIRE(node->value == 1);
+
+        // Retire the accessed node from another thread
+        std::thread([&domain, &source]()
+        {
+            domain.Retire(source.exchange(new Node(2)));
+            domain.Reclaim();
+        }).join();
+
+        // Accessed node must stay alive until the reader reports the quiescent state
+        REQUIRE(Node::deleted == 0);
+        REQUIRE(node->value == 1);
+        REQUIRE(domain.records() == 2);
+
+        // Report the quiescent state, then retire and reclaim from the reader thread
+        domain.Quiescent();
+        domain.Retire(source.exchange(nullptr));
+        domain.Reclaim();
+        REQUIRE(Node::deleted == 1);
+
+        // Offline thread does not block the reclamation
+        domain.Offline();
+    }
+
+    REQUIRE(Node::deleted == 2);
+}
@@ -7,6 +7,8 @@
 #include "threads/seq_lock.h"
 #include "threads/thread.h"
 
+#include <atomic>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -24,6 +26,13 @@ struct Data
     { return ((data1.a == data2.a) && (data1.b == data2.b) && (data1.c == data2.c)); }
 };
 
+struct Price
+{
+    explicit Price(double v) : value(v) {}
+
+    double value;
+};
+
 } // namespace
 
 TEST_CASE("SeqLock base", "[CppCommon][Threads]")
@@ -42,6 +51,30 @@ TEST_CASE("SeqLock base", "[CppCommon][Threads]")
     lock = data;
     REQUIRE(lock.Read() == data);
     REQUIRE(lock.Read() == data);
+
+    // Test field Read() method
+    REQUIRE(lock.Read(&Data::a) == 987);
+    REQUIRE(lock.Read(&Data::b) == 654);
+    REQUIRE(lock.Read(&Data::c) == 321);
+
+    // Test Update() method
+    lock.Update([](Data& item) { item.c = 123; });
+    REQUIRE(lock.Read() == Data{ 987, 654, 123 });
+
+    // Test Update() method with the throwing updater
+    REQUIRE_THROWS(lock.Update([](Data& item) { item.a = 0; throw std::runtime_error("Update failed!"); }));
+    REQUIRE(lock.Read() == Data{ 987, 654, 123 });
+    lock.Write(data);
+    REQUIRE(lock.Read() == data);
+}
+
+TEST_CASE("SeqLock non default constructible data", "[CppCommon][Threads]")
+{
+    SeqLock<Price> lock(Price(1.5));
+    REQUIRE(lock.Read().value == 1.5);
+
+    lock.Update([](Price& price) { price.value *= 2; });
+    REQUIRE(lock.Read(&Price::value) == 3.0);
 }
 
 TEST_CASE("SeqLock random", "[CppCommon][Threads]")
@@ -86,3 +119,85 @@ TEST_CASE("SeqLock random", "[CppCommon][Threads]")
     for (auto& consumer : consumers)
         consumer.join();
 }
+
+TEST_CASE("SeqLock field read", "[CppCommon][Threads]")
+{
+    struct Range
+    {
+        double low;
+        double high;
+    };
+
+    struct Wide
+    {
+        char tag;
+        Range range;
+        int last;
+    };
+
+    SeqLock<Wide> lock(Wide{ 'x', { 1.0, 2.0 }, 3 });
+    REQUIRE(lock.Read(&Wide::tag) == 'x');
+    REQUIRE(lock.Read(&Wide::last) == 3);
+
+    // Field could span several data words
+    Range range = lock.Read(&Wide::range);
+    REQUIRE(range.low == 1.0);
+    REQUIRE(range.high == 2.0);
+}
+
+TEST_CASE("SeqLock multiple writers", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int consumers_count = 4;
+    std::atomic<bool> stop(false);
+    std::atomic<int> torn(0);
+
+    SeqLock<Data> lock(Data{ 0, 100, 200 });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&lock, &stop, &torn]()
+        {
+            while (!stop)
+            {
+                // Readers must never observe the partial update
+                Data data = lock.Read();
+                if ((data.b != data.a + 100) || (data.c != data.b + 100))
+                    ++torn;
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&lock, items_to_produce, producers_count]()
+        {
+            for (int i = 0; i < (items_to_produce / producers_count); ++i)
+            {
+                // Concurrent writers are serialized
+                lock.Update([](Data& data) { ++data.a; ++data.b; ++data.c; });
+            }
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Wait for all consumers threads
+    stop = true;
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(torn == 0);
+    REQUIRE(lock.Read() == Data{ items_to_produce, items_to_produce + 100, items_to_produce + 200 });
+}
@@ -0,0 +1,169 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_file_lock.h"
+#include "threads/thread.h"
+
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+TEST_CASE("Shared memory file-lock", "[CppCommon][Threads]")
+{
+    SharedFileLock lock1(".shared_lock");
+    SharedFileLock lock2(".shared_lock");
+
+    // Test TryLockRead() method
+    REQUIRE(lock1.TryLockRead());
+    REQUIRE(!lock2.TryLockWrite());
+    lock1.UnlockRead();
+
+    // Test TryLockWrite() method
+    REQUIRE(lock1.TryLockWrite());
+    REQUIRE(!lock2.TryLockRead());
+    lock1.UnlockWrite();
+
+    // Test LockRead()/UnlockRead() methods
+    lock1.LockRead();
+    REQUIRE(!lock2.TryLockWrite());
+    lock1.UnlockRead();
+
+    // Test LockWrite()/UnlockWrite() methods
+    lock1.LockWrite();
+    REQUIRE(!lock2.TryLockRead());
+    lock1.UnlockWrite();
+}
+
+TEST_CASE("Shared memory file-locker", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10;
+    int consumers_count = 4;
+    int crc = 0;
+    std::vector<int> crcs;
+    int current = 0;
+
+    SharedFileLock lock_master(".shared_lock");
+
+    // Reset consumers' results
+    for (int i = 0; i < consumers_count; ++i)
+        crcs.push_back(0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start producer thread
+    std::thread producer = std::thread([&crc, &current, items_to_produce]()
+    {
+        SharedFileLock lock_slave(".shared_lock");
+
+        for (int i = 0; i < items_to_produce; ++i)
+        {
+            // Use a write locker to produce the item
+            {
+                WriteLocker<SharedFileLock> locker(lock_slave);
+
+                // Update the current produced item and produced crc
+                current = i;
+                crc += current;
+            }
+
+            // Sleep for a while...
+            Thread::Sleep(10);
+        }
+    });
+
+    // Start consumers threads
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&crcs, &current, consumer, items_to_produce]()
+        {
+            SharedFileLock lock_slave(".shared_lock");
+
+            int item = 0;
+            while (item < (items_to_produce - 1))
+            {
+                // Use a read locker to consume the item
+                {
+                    ReadLocker<SharedFileLock> locker(lock_slave);
+
+                    // Check for the current item changed
+                    if (item != current)
+                    {
+                        // Update consumed crc
+                        item = current;
+                        crcs[consumer] += item;
+                    }
+                }
+
+                // Yield to another thread...
+                Thread::Yield();
+            }
+        });
+    }
+
+    // Wait for producer thread
+    producer.join();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+    for (int i = 0; i < consumers_count; ++i)
+        REQUIRE(crcs[i] > 0);
+}
+
+#if defined(__linux__)
+
+TEST_CASE("Shared memory file-lock owner died", "[CppCommon][Threads]")
+{
+    SharedFileLock lock(".shared_lock_died");
+
+    // Lock the file-lock in the child process which exits without unlocking it
+    pid_t child = fork();
+    if (child == 0)
+    {
+        SharedFileLock lock_slave(".shared_lock_died");
+        lock_slave.LockWrite();
+        _exit(0);
+    }
+    REQUIRE(child > 0);
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+
+    // The write lock of the dead process is recovered
+    REQUIRE(!lock.TryLockRead());
+    REQUIRE(lock.TryLockReadFor(Timespan::seconds(10)));
+    lock.UnlockRead();
+
+    // Lock the file-lock for read in the child process which exits without unlocking it
+    child = fork();
+    if (child == 0)
+    {
+        SharedFileLock lock_slave(".shared_lock_died");
+        lock_slave.LockRead();
+        _exit(0);
+    }
+    REQUIRE(child > 0);
+    REQUIRE(waitpid(child, &status, 0) == child);
+
+    // The read lock of the dead process is recovered
+    REQUIRE(!lock.TryLockWrite());
+    REQUIRE(lock.TryLockWriteFor(Timespan::seconds(10)));
+    lock.UnlockWrite();
+}
+
+#endif
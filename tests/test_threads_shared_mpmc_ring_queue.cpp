@@ -0,0 +1,113 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_mpmc_ring_queue.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Shared memory multiple producers / multiple consumers wait-free ring queue", "[CppCommon][Threads]")
+{
+    std::string name = "shared_mpmc_ring_queue_test";
+
+    SharedMPMCRingQueue<int> producer(name, 4);
+    SharedMPMCRingQueue<int> consumer(name, 4);
+
+    REQUIRE(producer.owner());
+    REQUIRE(!consumer.owner());
+    REQUIRE(consumer.capacity() == 4);
+    REQUIRE(consumer.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!consumer.TryDequeue(v));
+
+    REQUIRE((producer.TryEnqueue(0) && (consumer.size() == 1)));
+    REQUIRE((producer.TryEnqueue(1) && (consumer.size() == 2)));
+    REQUIRE((producer.Enqueue(2) && (consumer.size() == 3)));
+    REQUIRE((producer.Enqueue(3) && (consumer.size() == 4)));
+    REQUIRE(!producer.TryEnqueue(4));
+
+    REQUIRE(((consumer.TryDequeue(v) && (v == 0)) && (producer.size() == 3)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 1)) && (producer.size() == 2)));
+
+    REQUIRE((producer.TryEnqueue(4) && (consumer.size() == 3)));
+
+    consumer.Close();
+
+    REQUIRE(producer.closed());
+    REQUIRE(!producer.Enqueue(5));
+
+    // Items left in the closed queue are still available
+    REQUIRE(((consumer.Dequeue(v) && (v == 2)) && (consumer.size() == 2)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 3)) && (consumer.size() == 1)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 4)) && (consumer.size() == 0)));
+    REQUIRE(!consumer.Dequeue(v));
+}
+
+TEST_CASE("Shared memory multiple producers / multiple consumers ring queue threads", "[CppCommon][Threads]")
+{
+    std::string name = "shared_mpmc_ring_queue_threads_test";
+    int items_to_produce = 10000;
+    int producers_count = 4;
+    int consumers_count = 2;
+    std::atomic<int> crc(0);
+
+    // Small capacity and no spinning to exercise parking of both producers and consumers
+    SharedMPMCRingQueue<int> queue(name, 16, 0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumers threads with their own views of the shared memory ring queue
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < consumers_count; ++consumer)
+    {
+        consumers.emplace_back([&name, &crc]()
+        {
+            SharedMPMCRingQueue<int> consumer_queue(name, 16, 0);
+
+            int item;
+            while (consumer_queue.Dequeue(item))
+                crc += item;
+        });
+    }
+
+    // Start producers threads with their own views of the shared memory ring queue
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < producers_count; ++producer)
+    {
+        producers.emplace_back([&name, producer, items_to_produce, producers_count]()
+        {
+            SharedMPMCRingQueue<int> producer_queue(name, 16, 0);
+
+            int items = (items_to_produce / producers_count);
+            for (int i = 0; i < items; ++i)
+                if (!producer_queue.Enqueue((producer * items) + i))
+                    break;
+        });
+    }
+
+    // Wait for all producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Close the ring queue
+    queue.Close();
+
+    // Wait for all consumers threads
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
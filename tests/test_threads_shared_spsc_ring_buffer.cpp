@@ -0,0 +1,94 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include <string>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Shared memory single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
+{
+    std::string name = "shared_spsc_ring_buffer_test";
+
+    SharedSPSCRingBuffer producer(name, 16);
+    SharedSPSCRingBuffer consumer(name, 16);
+
+    REQUIRE(producer.owner());
+    REQUIRE(!consumer.owner());
+    REQUIRE(consumer.capacity() == 16);
+    REQUIRE(consumer.size() == 0);
+
+    char buffer[16];
+    size_t size;
+
+    REQUIRE(!consumer.TryDequeue(buffer, size = sizeof(buffer)));
+
+    REQUIRE((producer.TryEnqueue("test", 4) && (consumer.size() == 4)));
+    REQUIRE((producer.Enqueue("0123456789", 10) && (consumer.size() == 14)));
+    REQUIRE(!producer.TryEnqueue("test", 4));
+
+    REQUIRE(((consumer.TryDequeue(buffer, size = 6) && (size == 6)) && (producer.size() == 8)));
+    REQUIRE(std::string(buffer, size) == "test01");
+
+    // Enqueue with the ring buffer wrap around
+    REQUIRE((producer.Enqueue("abcdef", 6) && (consumer.size() == 14)));
+
+    producer.Close();
+
+    REQUIRE(consumer.closed());
+    REQUIRE(!producer.Enqueue("x", 1));
+
+    // Bytes left in the closed buffer are still available
+    REQUIRE(((consumer.Dequeue(buffer, size = sizeof(buffer)) && (size == 14)) && (consumer.size() == 0)));
+    REQUIRE(std::string(buffer, size) == "23456789abcdef");
+    REQUIRE(!consumer.Dequeue(buffer, size = sizeof(buffer)));
+}
+
+TEST_CASE("Shared memory single producer / single consumer ring buffer threads", "[CppCommon][Threads]")
+{
+    std::string name = "shared_spsc_ring_buffer_threads_test";
+    int items_to_produce = 10000;
+    int crc = 0;
+
+    // Small capacity and no spinning to exercise parking of both producer and consumer
+    SharedSPSCRingBuffer buffer(name, 64, 0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i % 256;
+
+    // Start consumer thread with its own view of the shared memory ring buffer
+    auto consumer = std::thread([&name, &crc]()
+    {
+        SharedSPSCRingBuffer consumer_buffer(name, 64, 0);
+
+        uint8_t items[32];
+        size_t size;
+        while (consumer_buffer.Dequeue(items, size = sizeof(items)))
+            for (size_t i = 0; i < size; ++i)
+                crc += items[i];
+    });
+
+    // Produce items
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        uint8_t item = (uint8_t)i;
+        if (!buffer.Enqueue(&item, sizeof(item)))
+            break;
+    }
+
+    // Close the ring buffer
+    buffer.Close();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
@@ -0,0 +1,100 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_spsc_ring_queue.h"
+
+#include <string>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Shared memory single producer / single consumer wait-free ring queue", "[CppCommon][Threads]")
+{
+    std::string name = "shared_spsc_ring_queue_test";
+
+    SharedSPSCRingQueue<int> producer(name, 4);
+    SharedSPSCRingQueue<int> consumer(name, 4);
+
+    REQUIRE(producer.owner());
+    REQUIRE(!consumer.owner());
+    REQUIRE(consumer.capacity() == 4);
+    REQUIRE(consumer.size() == 0);
+
+    int v = -1;
+
+    REQUIRE(!consumer.TryDequeue(v));
+
+    REQUIRE((producer.TryEnqueue(0) && (consumer.size() == 1)));
+    REQUIRE((producer.TryEnqueue(1) && (consumer.size() == 2)));
+    REQUIRE((producer.Enqueue(2) && (consumer.size() == 3)));
+    REQUIRE((producer.Enqueue(3) && (consumer.size() == 4)));
+    REQUIRE(!producer.TryEnqueue(4));
+
+    REQUIRE(((consumer.TryDequeue(v) && (v == 0)) && (producer.size() == 3)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 1)) && (producer.size() == 2)));
+
+    REQUIRE((producer.TryEnqueue(4) && (consumer.size() == 3)));
+
+    producer.Close();
+
+    REQUIRE(consumer.closed());
+    REQUIRE(!producer.Enqueue(5));
+
+    // Items left in the closed queue are still available
+    REQUIRE(((consumer.Dequeue(v) && (v == 2)) && (consumer.size() == 2)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 3)) && (consumer.size() == 1)));
+    REQUIRE(((consumer.Dequeue(v) && (v == 4)) && (consumer.size() == 0)));
+    REQUIRE(!consumer.Dequeue(v));
+}
+
+TEST_CASE("Shared memory ring queue header validation", "[CppCommon][Threads]")
+{
+    std::string name = "shared_spsc_ring_queue_header_test";
+
+    SharedSPSCRingQueue<int> queue(name, 4);
+
+    // Ring queue of another item type with the same shared memory size
+    REQUIRE_THROWS(SharedSPSCRingQueue<short>(name, 8));
+}
+
+TEST_CASE("Shared memory single producer / single consumer ring queue threads", "[CppCommon][Threads]")
+{
+    std::string name = "shared_spsc_ring_queue_threads_test";
+    int items_to_produce = 10000;
+    int crc = 0;
+
+    // Small capacity and no spinning to exercise parking of both producer and consumer
+    SharedSPSCRingQueue<int> queue(name, 16, 0);
+
+    // Calculate result value
+    int result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start consumer thread with its own view of the shared memory ring queue
+    auto consumer = std::thread([&name, &crc]()
+    {
+        SharedSPSCRingQueue<int> consumer_queue(name, 16, 0);
+
+        int item;
+        while (consumer_queue.Dequeue(item))
+            crc += item;
+    });
+
+    // Produce items
+    for (int i = 0; i < items_to_produce; ++i)
+        if (!queue.Enqueue(i))
+            break;
+
+    // Close the ring queue
+    queue.Close();
+
+    // Wait for the consumer thread
+    consumer.join();
+
+    // Check result
+    REQUIRE(crc == result);
+}
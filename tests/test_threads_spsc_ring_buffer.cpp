@@ -6,6 +6,9 @@
 
 #include "threads/spsc_ring_buffer.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
@@ -59,3 +62,114 @@ TEST_CASE("Single producer / single consumer wait-free ring buffer", "[CppCommon
     REQUIRE(buffer.capacity() == 4);
     REQUIRE(buffer.size() == 0);
 }
+
+TEST_CASE("Single producer / single consumer wait-free ring buffer with zero-copy access", "[CppCommon][Threads]")
+{
+    SPSCRingBuffer buffer(8);
+
+    REQUIRE(!buffer.mirrored());
+
+    size_t size;
+
+    REQUIRE(buffer.Peek(size) == nullptr);
+    REQUIRE(size == 0);
+
+    // Reserve and commit
+    uint8_t* data = (uint8_t*)buffer.Reserve(size = 6);
+    REQUIRE(data != nullptr);
+    REQUIRE(size == 6);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = (uint8_t)i;
+    buffer.Commit(size);
+    REQUIRE(buffer.size() == 6);
+
+    REQUIRE(buffer.Reserve(size = 3) == nullptr);
+
+    // Peek and release
+    const uint8_t* peeked = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(peeked == data);
+    REQUIRE(size == 6);
+    buffer.Release(4);
+    REQUIRE(buffer.size() == 2);
+
+    // Reserved region is limited with the ring buffer end
+    data = (uint8_t*)buffer.Reserve(size = 4);
+    REQUIRE(data != nullptr);
+    REQUIRE(size == 2);
+    data[0] = 6;
+    data[1] = 7;
+    buffer.Commit(size);
+
+    data = (uint8_t*)buffer.Reserve(size = 2);
+    REQUIRE(data != nullptr);
+    REQUIRE(size == 2);
+    data[0] = 8;
+    data[1] = 9;
+    buffer.Commit(size);
+    REQUIRE(buffer.size() == 6);
+
+    // Peeked region is limited with the cached producer cursor
+    peeked = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(size == 2);
+    REQUIRE(((peeked[0] == 4) && (peeked[1] == 5)));
+    buffer.Release(size);
+
+    // Peeked region is limited with the ring buffer end
+    peeked = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(size == 2);
+    REQUIRE(((peeked[0] == 6) && (peeked[1] == 7)));
+    buffer.Release(size);
+
+    peeked = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(size == 2);
+    REQUIRE(((peeked[0] == 8) && (peeked[1] == 9)));
+    buffer.Release(size);
+
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.Peek(size) == nullptr);
+}
+
+TEST_CASE("Single producer / single consumer wait-free mirrored ring buffer", "[CppCommon][Threads]")
+{
+    const size_t capacity = MirroredMemory::Granularity();
+
+    SPSCRingBuffer buffer(capacity, true);
+
+    REQUIRE(buffer.mirrored());
+    REQUIRE(buffer.capacity() == capacity);
+
+    std::vector<uint8_t> chunk(capacity / 2 + 1);
+    for (size_t i = 0; i < chunk.size(); ++i)
+        chunk[i] = (uint8_t)i;
+
+    // Move cursors to the middle of the ring buffer
+    size_t size;
+    REQUIRE(buffer.Enqueue(chunk.data(), chunk.size()));
+    REQUIRE(buffer.Dequeue(chunk.data(), size = chunk.size()));
+    REQUIRE(size == chunk.size());
+
+    // Reserved region wrapped around the ring buffer end is contiguous
+    uint8_t* data = (uint8_t*)buffer.Reserve(size = capacity);
+    REQUIRE(data != nullptr);
+    REQUIRE(size == capacity);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = (uint8_t)(i * 3);
+    buffer.Commit(size);
+    REQUIRE(buffer.size() == capacity);
+
+    // Peeked region wrapped around the ring buffer end is contiguous
+    const uint8_t* peeked = (const uint8_t*)buffer.Peek(size);
+    REQUIRE(peeked == data);
+    REQUIRE(size == capacity);
+    for (size_t i = 0; i < size; ++i)
+        REQUIRE(peeked[i] == (uint8_t)(i * 3));
+    buffer.Release(size);
+    REQUIRE(buffer.size() == 0);
+
+    // Copy operations also work with the mirrored ring buffer
+    std::vector<uint8_t> result(capacity);
+    REQUIRE(buffer.Enqueue(chunk.data(), chunk.size()));
+    REQUIRE(buffer.Dequeue(result.data(), size = capacity));
+    REQUIRE(size == chunk.size());
+    REQUIRE(std::equal(chunk.begin(), chunk.end(), result.begin()));
+}
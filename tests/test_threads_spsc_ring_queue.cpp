@@ -6,6 +6,9 @@
 
 #include "threads/spsc_ring_queue.h"
 
+#include <iterator>
+#include <vector>
+
 using namespace CppCommon;
 
 TEST_CASE("Single producer / single consumer wait-free ring queue", "[CppCommon][Threads]")
@@ -44,3 +47,34 @@ TEST_CASE("Single producer / single consumer wait-free ring queue", "[CppCommon]
     REQUIRE(queue.capacity() == 3);
     REQUIRE(queue.size() == 0);
 }
+
+TEST_CASE("Single producer / single consumer wait-free ring queue with bulk operations", "[CppCommon][Threads]")
+{
+    SPSCRingQueue<int> queue(8);
+
+    int items[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int result[10] = { 0 };
+
+    REQUIRE(queue.DequeueBulk(result, 10) == 0);
+
+    // Enqueue a bulk which is bigger than the ring queue capacity
+    REQUIRE(queue.EnqueueBulk(items, 10) == 7);
+    REQUIRE(queue.size() == 7);
+    REQUIRE(queue.EnqueueBulk(items, 1) == 0);
+
+    // Dequeue a part of the bulk
+    REQUIRE(queue.DequeueBulk(result, 5) == 5);
+    REQUIRE(queue.size() == 2);
+    for (int i = 0; i < 5; ++i)
+        REQUIRE(result[i] == i);
+
+    // Enqueue a bulk with the ring queue wrap around
+    REQUIRE(queue.EnqueueBulk(items, 5) == 5);
+    REQUIRE(queue.size() == 7);
+
+    // Dequeue the rest of items into the container
+    std::vector<int> rest;
+    REQUIRE(queue.DequeueBulk(std::back_inserter(rest), 100) == 7);
+    REQUIRE(queue.size() == 0);
+    REQUIRE(rest == std::vector<int>({ 5, 6, 0, 1, 2, 3, 4 }));
+}
@@ -0,0 +1,79 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/async_latch.h"
+#include "threads/scheduler.h"
+#include "threads/task.h"
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace CppCommon;
+
+namespace {
+
+Task<int> Value(int value)
+{
+    co_return value;
+}
+
+Task<int> Sum(int count)
+{
+    int sum = 0;
+    for (int i = 0; i < count; ++i)
+        sum += co_await Value(i);
+    co_return sum;
+}
+
+Task<> Throw()
+{
+    throw std::runtime_error("Task exception");
+    co_return;
+}
+
+Task<> Work(Scheduler& scheduler, std::atomic<int>& counter, AsyncLatch& latch)
+{
+    co_await scheduler.Schedule();
+    ++counter;
+    latch.CountDown();
+}
+
+Task<int> Spawn(Scheduler& scheduler, std::atomic<int>& counter, int count)
+{
+    AsyncLatch latch(count);
+    for (int i = 0; i < count; ++i)
+        scheduler.Spawn(Work(scheduler, counter, latch));
+    co_await latch.Wait();
+    co_return counter.load();
+}
+
+} // namespace
+
+TEST_CASE("Coroutine task", "[CppCommon][Threads]")
+{
+    // Tasks are started lazily
+    Task<int> task = Sum(10000);
+    REQUIRE(task);
+    REQUIRE(!task.done());
+
+    // Awaited tasks resume the awaiting task directly
+    REQUIRE(task.Get() == 49995000);
+    REQUIRE(task.done());
+
+    // Exceptions are re-thrown in the awaiting code
+    Task<> failed = Throw();
+    REQUIRE_THROWS_AS(failed.Get(), std::runtime_error);
+}
+
+TEST_CASE("Coroutine scheduler", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false);
+    PoolScheduler scheduler(pool);
+
+    // Thousands of coroutines are multiplexed onto a few threads
+    std::atomic<int> counter(0);
+    REQUIRE(Spawn(scheduler, counter, 10000).Get() == 10000);
+}
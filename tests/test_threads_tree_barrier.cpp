@@ -0,0 +1,73 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/tree_barrier.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Tree barrier single thread", "[CppCommon][Threads]")
+{
+    TreeBarrier barrier(1);
+
+    // Test Wait() methods
+    REQUIRE(barrier.Wait());
+    REQUIRE(barrier.Wait(0));
+}
+
+TEST_CASE("Tree barrier multiple threads", "[CppCommon][Threads]")
+{
+    int concurrency = 7;
+    int episodes = 1000;
+    std::atomic<bool> failed(false);
+    std::atomic<int> count(0);
+    std::atomic<int> last(0);
+
+    TreeBarrier barrier1(concurrency, 2);
+    TreeBarrier barrier2(concurrency, 2);
+
+    // Start some threads
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < concurrency; ++thread)
+    {
+        threads.emplace_back([&barrier1, &barrier2, &count, &last, &failed, concurrency, episodes, thread]()
+        {
+            // Sleep for a while...
+            Thread::Sleep(thread * 10);
+
+            for (int episode = 0; episode < episodes; ++episode)
+            {
+                // Increment threads counter
+                ++count;
+
+                // Wait for all other threads at the first barrier with the thread index
+                if (barrier1.Wait(thread))
+                    ++last;
+
+                // Check result in each thread
+                if (count < concurrency * (episode + 1))
+                    failed = true;
+
+                // Wait for all other threads at the second barrier with the ticket
+                if (barrier2.Wait())
+                    ++last;
+            }
+        });
+    }
+
+    // Wait for all threads to complete
+    for (auto& thread : threads)
+        thread.join();
+
+    // Check results
+    REQUIRE(count == concurrency * episodes);
+    REQUIRE(last == 2 * episodes);
+    REQUIRE(!failed);
+}
@@ -0,0 +1,103 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/work_stealing_deque.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Work-stealing deque", "[CppCommon][Threads]")
+{
+    WorkStealingDeque<int> deque(4);
+
+    REQUIRE(deque.capacity() == 4);
+    REQUIRE(deque.empty());
+
+    int v = -1;
+
+    REQUIRE(!deque.Pop(v));
+    REQUIRE(!deque.Steal(v));
+
+    // Deque grows when it is full
+    for (int i = 0; i < 6; ++i)
+        deque.Push(i);
+    REQUIRE(deque.size() == 6);
+    REQUIRE(deque.capacity() == 8);
+
+    // Owner pops in LIFO order, thieves steal in FIFO order
+    REQUIRE((deque.Pop(v) && (v == 5)));
+    REQUIRE((deque.Steal(v) && (v == 0)));
+    REQUIRE((deque.Pop(v) && (v == 4)));
+    REQUIRE((deque.Steal(v) && (v == 1)));
+    REQUIRE((deque.Pop(v) && (v == 3)));
+    REQUIRE((deque.Pop(v) && (v == 2)));
+    REQUIRE(!deque.Pop(v));
+    REQUIRE(!deque.Steal(v));
+    REQUIRE(deque.empty());
+}
+
+TEST_CASE("Work-stealing deque threads", "[CppCommon][Threads]")
+{
+    int items_to_produce = 10000;
+    int thieves_count = 4;
+    std::atomic<int64_t> crc(0);
+    std::atomic<int> consumed(0);
+
+    WorkStealingDeque<int> deque(16);
+
+    // Calculate result value
+    int64_t result = 0;
+    for (int i = 0; i < items_to_produce; ++i)
+        result += i;
+
+    // Start thieves threads
+    std::vector<std::thread> thieves;
+    for (int thief = 0; thief < thieves_count; ++thief)
+    {
+        thieves.emplace_back([&deque, &crc, &consumed, items_to_produce]()
+        {
+            int item;
+            while (consumed < items_to_produce)
+            {
+                if (deque.Steal(item))
+                {
+                    crc += item;
+                    ++consumed;
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    // Push items and pop every second one by the owner
+    int item;
+    for (int i = 0; i < items_to_produce; ++i)
+    {
+        deque.Push(i);
+        if (((i % 2) == 0) && deque.Pop(item))
+        {
+            crc += item;
+            ++consumed;
+        }
+    }
+    while (deque.Pop(item))
+    {
+        crc += item;
+        ++consumed;
+    }
+
+    // Wait for all thieves threads
+    for (auto& thief : thieves)
+        thief.join();
+
+    // Check result
+    REQUIRE(consumed == items_to_produce);
+    REQUIRE(crc == result);
+}
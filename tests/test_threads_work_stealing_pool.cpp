@@ -0,0 +1,121 @@
+//
+// Created by Ivan Shynkarenka on 19.10.2026
+//
+
+#include "test.h"
+
+#include "threads/work_stealing_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+using namespace CppCommon;
+
+namespace {
+
+uint64_t Fibonacci(WorkStealingPool& pool, int n)
+{
+    if (n < 10)
+        return (n < 2) ? n : Fibonacci(pool, n - 1) + Fibonacci(pool, n - 2);
+
+    uint64_t x, y;
+    pool.Invoke([&]() { x = Fibonacci(pool, n - 1); }, [&]() { y = Fibonacci(pool, n - 2); });
+    return x + y;
+}
+
+} // namespace
+
+TEST_CASE("Work-stealing pool submit", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false, 64);
+
+    REQUIRE(pool.workers() == 4);
+    REQUIRE(pool.worker() == -1);
+
+    std::atomic<int64_t> crc(0);
+    std::atomic<int> workers(0);
+
+    // Submit more tasks than the tasks table could hold
+    for (int i = 0; i < 1000; ++i)
+    {
+        pool.Submit([&pool, &crc, &workers, i]()
+        {
+            if (pool.worker() >= 0)
+                ++workers;
+
+            // Nested task is submitted to the worker deque
+            pool.Submit([&crc, i]() { crc += i; });
+        });
+    }
+
+    pool.Wait();
+
+    REQUIRE(pool.pending() == 0);
+    REQUIRE(workers == 1000);
+    REQUIRE(crc == 499500);
+}
+
+TEST_CASE("Work-stealing pool wait inside of tasks", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(2, false, 64);
+
+    std::atomic<int> nested(0);
+    std::atomic<int> waited(0);
+
+    // Tasks wait for their nested tasks
+    for (int i = 0; i < 10; ++i)
+    {
+        pool.Submit([&pool, &nested, &waited]()
+        {
+            for (int j = 0; j < 10; ++j)
+                pool.Submit([&nested]() { ++nested; });
+
+            pool.Wait();
+
+            // Nested waits of the same worker
+            pool.Submit([&pool, &nested]() { pool.Wait(); ++nested; });
+            pool.Wait();
+
+            ++waited;
+        });
+    }
+
+    pool.Wait();
+
+    REQUIRE(pool.pending() == 0);
+    REQUIRE(nested == 110);
+    REQUIRE(waited == 10);
+}
+
+TEST_CASE("Work-stealing pool fork/join", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false);
+
+    uint64_t result = 0;
+    pool.Run([&pool, &result]() { result = Fibonacci(pool, 25); });
+    REQUIRE(result == 75025);
+
+    // Fork/join from the external thread
+    int x = 0, y = 0;
+    pool.Invoke([&x]() { x = 1; }, [&y]() { y = 2; });
+    REQUIRE(x == 1);
+    REQUIRE(y == 2);
+}
+
+TEST_CASE("Work-stealing pool parallel for", "[CppCommon][Threads]")
+{
+    WorkStealingPool pool(4, false);
+
+    std::vector<int> items(10000, 0);
+    pool.ParallelFor(0, items.size(), 64, [&items](size_t i) { items[i] = (int)i; });
+
+    int64_t crc = 0;
+    for (auto item : items)
+        crc += item;
+    REQUIRE(crc == 49995000);
+
+    // Empty range
+    pool.ParallelFor(0, 0, 1, [&items](size_t i) { items[i] = -1; });
+    REQUIRE(std::find(items.begin(), items.end(), -1) == items.end());
+}